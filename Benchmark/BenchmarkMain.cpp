@@ -0,0 +1,686 @@
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "headless.h"
+#include "renderPath.h"
+#include "vertexFormat.h"
+#include "vertexQuantize.h"
+#include "meshOptimize.h"
+#include "meshLod.h"
+#include "meshPool.h"
+#include "meshFile.h"
+#include "objLoader.h"
+#include "indirectRenderer.h"
+#include "uniformBlocks.h"
+#include "frameProfiler.h"
+#include "glState.h"
+#include "sceneGenerator.h"
+
+// Sweeps procedural scenes from 1 to maxTriangles triangles (x10 each step) and reports fps, CPU submit time and GPU time as JSON
+// Runs headless, so it works the same on a CI box with llvmpipe as on a desktop GPU
+// --lod swaps the grids for spheres moving towards and away from the camera, and runs every scene without and then with LODs
+// --load-compare FILE.obj times loading one mesh instead, from the OBJ and from a .mesh converted from it (see meshFile.h)
+
+const char* benchVertexShaderSource = "#version 330 core\n"
+"layout (location = 0) in vec3 aPos;\n"
+"uniform vec3 positionScale;\n" // Undoes --compact-vertices quantization, 1 and 0 for float positions
+"uniform vec3 positionBias;\n"
+"layout (location = 1) in vec3 aColor;\n"
+"out vec3 ourColor;\n"
+"void main()\n"
+"{\n"
+"   gl_Position = vec4(positionBias + aPos * positionScale, 1.0);\n"
+"   ourColor = aColor;\n"
+"}\0";
+
+// --multi-draw version, scale and bias come from a storage buffer indexed by gl_DrawID instead of uniforms (see BenchDrawData)
+const char* benchMultiDrawVertexShaderSource = "#version 330 core\n"
+"#extension GL_ARB_shader_draw_parameters : require\n"
+"#extension GL_ARB_shader_storage_buffer_object : require\n"
+"layout (location = 0) in vec3 aPos;\n"
+"layout (location = 1) in vec3 aColor;\n"
+"struct DrawData {\n"
+"   vec4 positionScale;\n"
+"   vec4 positionBias;\n"
+"};\n"
+"layout (std430) buffer DrawDataBlock {\n"
+"   DrawData draws[];\n"
+"};\n"
+"out vec3 ourColor;\n"
+"void main()\n"
+"{\n"
+"   gl_Position = vec4(draws[gl_DrawIDARB].positionBias.xyz + aPos * draws[gl_DrawIDARB].positionScale.xyz, 1.0);\n"
+"   ourColor = aColor;\n"
+"}\0";
+
+// One draw's data for the --multi-draw shader
+struct BenchDrawData {
+     float positionScale[4];
+     float positionBias[4];
+};
+
+const char* benchFragmentShaderSource = "#version 330 core\n"
+"out vec4 FragColor;\n"
+"in vec3 ourColor;\n"
+"void main() {\n"
+"    FragColor = vec4(ourColor, 1.0);\n"
+"}\n\0";
+
+struct BenchOptions {
+     int meshes = 1;                  // --meshes M : how many meshes the triangles are spread over
+     int drawsPerMesh = 1;            // --draws-per-mesh N : each mesh's index buffer is split into this many draw calls
+     int frames = 200;                // --frames F : measured frames per scene
+     int warmupFrames = 10;
+     long long maxTriangles = 1000000; // --max-triangles T
+     int width = 800;                 // --size WxH
+     int height = 600;
+     bool legacyGL = false;           // --legacy-gl
+     VertexStorage vertexStorage = VertexStorage::Interleaved; // --vertex-storage interleaved|split
+     bool compactVertices = false;    // --compact-vertices
+     bool optimizeIndices = false;    // --optimize-indices : reorder triangles and vertices for the post-transform cache before uploading
+     bool pooled = false;             // --pooled : every mesh goes into one MeshPool instead of its own VAO, VBO and EBO
+     bool multiDraw = false;          // --multi-draw : pooled, and every draw of a frame goes out in one glMultiDrawElementsIndirect
+     bool lod = false;                // --lod : sphere scenes at changing distances, each run with full meshes and then with a LOD picked per mesh per frame
+     std::string outPath;             // --out file.json : stdout when empty
+     std::string loadCompare;         // --load-compare FILE.obj : skip the sweep, time loading FILE.obj against loading it as a .mesh
+     int loadRuns = 20;               // --load-runs N : timed loads of each
+};
+
+struct SceneResult {
+     long long triangles = 0;
+     int meshes = 0;
+     int drawCalls = 0;      // Per mesh draws a frame, what the scene asks for
+     double glCalls = 0.0;   // Draw calls per frame that reached GL, fewer than drawCalls when --multi-draw collapses them
+     long long vertexBytes = 0;
+     long long indexBytes = 0;
+     double acmrBefore = 0.0, acmrAfter = 0.0; // Over all meshes, the same when --optimize-indices is off
+     double acmrReordered = 0.0;               // What reordering every mesh would have given, including the ones that kept their input order
+     int meshesReordered = 0;                  // How many meshes took the new triangle order
+     bool lod = false;
+     double trianglesSubmitted = 0.0; // Per frame, the same as triangles unless LODs are on
+     int frames = 0;
+     double fps = 0.0;
+     double cpuSubmitP50 = 0.0, cpuSubmitP95 = 0.0;
+     double gpuP50 = 0.0, gpuP95 = 0.0;
+     double stateIssued = 0.0, stateElided = 0.0; // GL state calls per frame that went to the driver, and that the state cache dropped
+};
+
+static BenchOptions parseBenchOptions(int argc, char* argv[]) {
+     BenchOptions options;
+     for (int i = 1; i < argc; i++) {
+          const char* arg = argv[i];
+          bool hasValue = i + 1 < argc;
+          if (strcmp(arg, "--meshes") == 0 && hasValue) {
+               options.meshes = atoi(argv[++i]);
+          }
+          else if (strcmp(arg, "--draws-per-mesh") == 0 && hasValue) {
+               options.drawsPerMesh = atoi(argv[++i]);
+          }
+          else if (strcmp(arg, "--frames") == 0 && hasValue) {
+               options.frames = atoi(argv[++i]);
+          }
+          else if (strcmp(arg, "--max-triangles") == 0 && hasValue) {
+               options.maxTriangles = atoll(argv[++i]);
+          }
+          else if (strcmp(arg, "--size") == 0 && hasValue) {
+               char* end = NULL;
+               options.width = (int)strtol(argv[++i], &end, 10);
+               options.height = *end == 'x' ? (int)strtol(end + 1, NULL, 10) : 0;
+          }
+          else if (strcmp(arg, "--legacy-gl") == 0) {
+               options.legacyGL = true;
+          }
+          else if (strcmp(arg, "--vertex-storage") == 0 && hasValue) {
+               const char* storage = argv[++i];
+               if (strcmp(storage, "split") == 0) {
+                    options.vertexStorage = VertexStorage::Split;
+               }
+               else if (strcmp(storage, "interleaved") != 0) {
+                    std::cerr << "WARNING::BENCHMARK::UNKNOWN_VERTEX_STORAGE " << storage << std::endl;
+               }
+          }
+          else if (strcmp(arg, "--compact-vertices") == 0) {
+               options.compactVertices = true;
+          }
+          else if (strcmp(arg, "--optimize-indices") == 0) {
+               options.optimizeIndices = true;
+          }
+          else if (strcmp(arg, "--pooled") == 0) {
+               options.pooled = true;
+          }
+          else if (strcmp(arg, "--multi-draw") == 0) {
+               options.multiDraw = true;
+               options.pooled = true;
+          }
+          else if (strcmp(arg, "--lod") == 0) {
+               options.lod = true;
+          }
+          else if (strcmp(arg, "--load-compare") == 0 && hasValue) {
+               options.loadCompare = argv[++i];
+          }
+          else if (strcmp(arg, "--load-runs") == 0 && hasValue) {
+               options.loadRuns = atoi(argv[++i]);
+          }
+          else if (strcmp(arg, "--out") == 0 && hasValue) {
+               options.outPath = argv[++i];
+          }
+          else {
+               std::cerr << "WARNING::BENCHMARK::UNKNOWN_ARGUMENT " << arg << std::endl;
+          }
+     }
+     if (options.meshes < 1) options.meshes = 1;
+     if (options.drawsPerMesh < 1) options.drawsPerMesh = 1;
+     if (options.frames < 1) options.frames = 1;
+     if (options.loadRuns < 1) options.loadRuns = 1;
+     if (options.pooled && options.vertexStorage == VertexStorage::Split) {
+          std::cerr << "WARNING::BENCHMARK::POOLED_MESHES_ARE_INTERLEAVED" << std::endl;
+          options.vertexStorage = VertexStorage::Interleaved;
+     }
+     if (options.width <= 0 || options.height <= 0) {
+          options.width = 800;
+          options.height = 600;
+     }
+     return options;
+}
+
+static unsigned int compileProgram(const char* vertexSource, const char* fragmentSource) {
+     int success;
+     char infoLog[512];
+
+     unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+     glShaderSource(vertexShader, 1, &vertexSource, NULL);
+     glCompileShader(vertexShader);
+     glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
+     if (!success) {
+          glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
+          std::cerr << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+     }
+
+     unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+     glShaderSource(fragmentShader, 1, &fragmentSource, NULL);
+     glCompileShader(fragmentShader);
+     glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
+     if (!success) {
+          glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
+          std::cerr << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+     }
+
+     unsigned int program = glCreateProgram();
+     glAttachShader(program, vertexShader);
+     glAttachShader(program, fragmentShader);
+     glLinkProgram(program);
+     glGetProgramiv(program, GL_LINK_STATUS, &success);
+     if (!success) {
+          glGetProgramInfoLog(program, 512, NULL, infoLog);
+          std::cerr << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+     }
+     glDeleteShader(vertexShader);
+     glDeleteShader(fragmentShader);
+     return program;
+}
+
+// How far --lod meshes get, 1 is the size generateSphereScene made them
+const float lodMaxDistance = 8.0f;
+
+// multiDrawProgram is 0 unless --multi-draw is on and the context can run it, lod picks a level per mesh per frame (--lod scenes only)
+static SceneResult runScene(const BenchOptions& options, RenderPath path, unsigned int program, unsigned int multiDrawProgram, long long triangles, bool lod) {
+     std::vector<GeneratedMesh> generated = options.lod ? generateSphereScene(triangles, options.meshes) : generateScene(triangles, options.meshes);
+     double missesBefore = 0.0, missesAfter = 0.0, missesReordered = 0.0;
+     int meshesReordered = 0;
+     for (GeneratedMesh& mesh : generated) {
+          double meshTriangles = (double)(mesh.indices.size() / 3);
+          if (options.optimizeIndices) {
+               MeshOptimizeStats stats = optimizeMesh(mesh.vertices, mesh.indices);
+               missesBefore += stats.acmrBefore * meshTriangles;
+               missesAfter += stats.acmrAfter * meshTriangles;
+               missesReordered += stats.acmrReordered * meshTriangles;
+               meshesReordered += stats.reordered ? 1 : 0;
+          }
+          else {
+               double acmr = computeACMR(mesh.indices.data(), mesh.indices.size(), mesh.vertices.size());
+               missesBefore += acmr * meshTriangles;
+               missesAfter += acmr * meshTriangles;
+               missesReordered += acmr * meshTriangles;
+          }
+     }
+
+     // Levels go after the full mesh in the same index buffer, so they upload with it below and only change a draw's range
+     std::vector<LodChain> chains;
+     for (GeneratedMesh& mesh : generated) {
+          chains.push_back(lod
+               ? buildLodChain(mesh.vertices[0].position, sizeof(PositionColorVertex), mesh.vertices.size(), mesh.indices)
+               : singleLevelChain((int)mesh.indices.size()));
+     }
+
+     SceneResult result;
+     std::vector<Mesh> meshes;
+     MeshPool pool;
+     std::vector<PooledMesh> pooledMeshes;
+     if (options.pooled) {
+          // Sized to fit the whole scene, with room for 32 bit indices and a vertex of alignment slack per mesh
+          size_t vertexCapacity = 0, indexCapacity = 0;
+          size_t stride = options.compactVertices ? sizeof(CompactVertex) : sizeof(PositionColorVertex);
+          for (const GeneratedMesh& mesh : generated) {
+               vertexCapacity += (mesh.vertices.size() + 1) * stride;
+               indexCapacity += mesh.indices.size() * sizeof(unsigned int);
+          }
+          pool.init(path, options.compactVertices ? vertexFormat<CompactVertex>() : vertexFormat<PositionColorVertex>(), vertexCapacity, indexCapacity);
+
+          for (const GeneratedMesh& mesh : generated) {
+               PooledMesh pooledMesh;
+               if (options.compactVertices) {
+                    QuantizedVertices quantized = quantizeVertices(mesh.vertices.data(), mesh.vertices.size());
+                    pooledMesh = pool.add(quantized.vertices.data(), quantized.vertices.size(), mesh.indices.data(), mesh.indices.size());
+                    pooledMesh.quantization = quantized.quantization;
+               }
+               else {
+                    pooledMesh = pool.add(mesh.vertices.data(), mesh.vertices.size(), mesh.indices.data(), mesh.indices.size());
+               }
+               result.vertexBytes += pooledMesh.vertexBytes;
+               result.indexBytes += pooledMesh.indexBytes;
+               pooledMeshes.push_back(pooledMesh);
+          }
+     }
+     else {
+          for (const GeneratedMesh& mesh : generated) {
+               meshes.push_back(options.compactVertices
+                    ? createQuantizedMesh(path, mesh.vertices.data(), mesh.vertices.size(), mesh.indices.data(), mesh.indices.size(), options.vertexStorage)
+                    : createMesh(path, mesh.vertices.data(), mesh.vertices.size(), mesh.indices.data(), mesh.indices.size(), options.vertexStorage));
+               result.vertexBytes += meshes.back().vertexBytes;
+               result.indexBytes += meshes.back().indexBytes;
+          }
+     }
+
+     result.triangles = triangles;
+     result.lod = lod;
+     result.meshes = (int)generated.size();
+     result.acmrBefore = missesBefore / triangles;
+     result.acmrAfter = missesAfter / triangles;
+     result.acmrReordered = missesReordered / triangles;
+     result.meshesReordered = meshesReordered;
+     result.frames = options.frames;
+
+     int scaleLocation = glGetUniformLocation(program, "positionScale");
+     int biasLocation = glGetUniformLocation(program, "positionBias");
+
+     FrameProfiler profiler;
+     int submitScope = profiler.addScope("submit");
+
+     // Whole triangles per draw, the last draw takes whatever is left
+     long long frameTriangles = 0;
+     auto forEachDraw = [&](const LodLevel& level, auto&& draw) {
+          int trianglesPerDraw = (level.indexCount / 3 + options.drawsPerMesh - 1) / options.drawsPerMesh;
+          for (int first = 0; first < level.indexCount; first += trianglesPerDraw * 3) {
+               draw(level.firstIndex + first, level.indexCount - first < trianglesPerDraw * 3 ? level.indexCount - first : trianglesPerDraw * 3);
+          }
+          frameTriangles += level.indexCount / 3;
+     };
+
+     for (const LodChain& chain : chains) {
+          forEachDraw(chain.levels[0], [&](int, int) { result.drawCalls++; });
+     }
+
+     // --lod scenes shrink each mesh about its cell's middle by its distance, like a perspective camera would, on a cycle of its own
+          // Everything else draws exactly as generated
+     int animationFrame = 0;
+     std::vector<int> levels(generated.size(), 0);
+     auto placeMesh = [&](size_t i, const PositionQuantization& quantization, BenchDrawData& data) {
+          memcpy(data.positionScale, quantization.scale, sizeof(data.positionScale));
+          memcpy(data.positionBias, quantization.bias, sizeof(data.positionBias));
+          if (!options.lod) {
+               return chains[i].levels[0];
+          }
+          float distance = 1.0f + (lodMaxDistance - 1.0f) * (0.5f + 0.5f * std::sin(animationFrame * 0.02f + i * 2.4f));
+          for (int axis = 0; axis < 3; axis++) {
+               data.positionScale[axis] /= distance;
+               data.positionBias[axis] = generated[i].center[axis] + (data.positionBias[axis] - generated[i].center[axis]) / distance;
+          }
+          // Clip space is 2 units tall, so a unit of the mesh covers half the viewport height at distance 1
+          levels[i] = selectLod(chains[i], options.height * 0.5f / distance, levels[i]);
+          return chains[i].levels[levels[i]];
+     };
+
+     IndirectRenderer indirect;
+     if (options.multiDraw) {
+          indirect.init(path, result.drawCalls, sizeof(BenchDrawData));
+     }
+
+     long long frameGlCalls = 0;
+     auto drawFrame = [&]() {
+          glClear(GL_COLOR_BUFFER_BIT);
+          animationFrame++;
+          frameTriangles = 0;
+          frameGlCalls = 0;
+          profiler.beginScope(submitScope);
+          if (options.multiDraw) {
+               glState.useProgram(indirect.multiDraw() ? multiDrawProgram : program);
+               for (size_t i = 0; i < pooledMeshes.size(); i++) {
+                    const PooledMesh& mesh = pooledMeshes[i];
+                    BenchDrawData data = {};
+                    forEachDraw(placeMesh(i, mesh.quantization, data), [&](int first, int count) {
+                         indirect.add(mesh, first, count, &data);
+                    });
+               }
+               long long callsBefore = indirect.glCalls();
+               indirect.submit(pool, [&](const void* drawData) {
+                    const BenchDrawData* data = (const BenchDrawData*)drawData;
+                    glUniform3fv(scaleLocation, 1, data->positionScale);
+                    glUniform3fv(biasLocation, 1, data->positionBias);
+               });
+               frameGlCalls = indirect.glCalls() - callsBefore;
+               profiler.endScope(submitScope);
+               return;
+          }
+          glState.useProgram(program);
+          for (size_t i = 0; i < meshes.size(); i++) {
+               const Mesh& mesh = meshes[i];
+               BenchDrawData data = {};
+               const LodLevel& level = placeMesh(i, mesh.quantization, data);
+               glState.bindVertexArray(mesh.VAO);
+               glUniform3fv(scaleLocation, 1, data.positionScale);
+               glUniform3fv(biasLocation, 1, data.positionBias);
+               forEachDraw(level, [&](int first, int count) {
+                    glDrawElements(GL_TRIANGLES, count, mesh.indexType, (void*)((size_t)first * indexSize(mesh)));
+                    frameGlCalls++;
+               });
+          }
+          for (size_t i = 0; i < pooledMeshes.size(); i++) {
+               const PooledMesh& mesh = pooledMeshes[i];
+               BenchDrawData data = {};
+               const LodLevel& level = placeMesh(i, mesh.quantization, data);
+               glUniform3fv(scaleLocation, 1, data.positionScale);
+               glUniform3fv(biasLocation, 1, data.positionBias);
+               forEachDraw(level, [&](int first, int count) {
+                    pool.draw(mesh, first, count);
+                    frameGlCalls++;
+               });
+          }
+          profiler.endScope(submitScope);
+     };
+
+     // Warmup frames aren't profiled, they soak up shader and buffer first-use costs
+     for (int frame = 0; frame < options.warmupFrames; frame++) {
+          drawFrame();
+          glState.endFrame();
+     }
+     glFinish();
+
+     profiler.init("");
+     auto start = std::chrono::steady_clock::now();
+     long long stateIssued = 0, stateElided = 0;
+     long long trianglesSubmitted = 0;
+     long long glCalls = 0;
+     for (int frame = 0; frame < options.frames; frame++) {
+          profiler.beginFrame();
+          drawFrame();
+          profiler.endFrame();
+          trianglesSubmitted += frameTriangles;
+          glCalls += frameGlCalls;
+          stateIssued += glState.frameIssued();
+          stateElided += glState.frameElided();
+          glState.endFrame();
+     }
+     glFinish();
+     double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+     profiler.shutdown();
+
+     result.fps = seconds > 0.0 ? options.frames / seconds : 0.0;
+     result.cpuSubmitP50 = profiler.cpuPercentile(submitScope, 0.50);
+     result.cpuSubmitP95 = profiler.cpuPercentile(submitScope, 0.95);
+     result.gpuP50 = profiler.gpuPercentile(submitScope, 0.50);
+     result.gpuP95 = profiler.gpuPercentile(submitScope, 0.95);
+     result.trianglesSubmitted = options.frames > 0 ? (double)trianglesSubmitted / options.frames : 0.0;
+     result.glCalls = options.frames > 0 ? (double)glCalls / options.frames : 0.0;
+     result.stateIssued = options.frames > 0 ? (double)stateIssued / options.frames : 0.0;
+     result.stateElided = options.frames > 0 ? (double)stateElided / options.frames : 0.0;
+
+     glState.bindVertexArray(0);
+     for (Mesh& mesh : meshes) {
+          deleteMesh(mesh);
+     }
+     indirect.shutdown();
+     pool.shutdown();
+     return result;
+}
+
+struct LoadResult {
+     std::string error;               // Set when either file didn't load, the times are meaningless then
+     size_t vertexCount = 0;
+     size_t indexCount = 0;
+     long long objBytes = 0;
+     long long meshBytes = 0;
+     double objMsP50 = 0.0, objMsP95 = 0.0;   // Read, parse, optimize, quantize and upload
+     double meshMsP50 = 0.0, meshMsP95 = 0.0; // Map, check and upload
+};
+
+static double percentile(std::vector<double> values, double p) {
+     if (values.empty()) {
+          return 0.0;
+     }
+     size_t index = (size_t)(p * (values.size() - 1) + 0.5);
+     std::nth_element(values.begin(), values.begin() + index, values.end());
+     return values[index];
+}
+
+// Both ways end with glFinish, so the upload is in the time and not left for the first draw to pay
+     // The first load of each is untimed, after it the file is in the OS cache for both and the comparison is parse against no parse
+static LoadResult runLoadCompare(const BenchOptions& options, RenderPath path) {
+     LoadResult result;
+     std::string meshPath = (std::filesystem::temp_directory_path() / "benchmark_load_compare.mesh").string();
+
+     // The same steps MeshConvert takes, so both loads end up with the same buffers
+     std::vector<PositionColorVertex> vertices;
+     std::vector<unsigned int> indices;
+     if (!loadObj(options.loadCompare, vertices, indices, result.error)) {
+          return result;
+     }
+     optimizeMesh(vertices, indices);
+     if (!writeMeshFile(meshPath, vertices.data(), vertices.size(), indices.data(), indices.size(), options.compactVertices, result.error)) {
+          return result;
+     }
+     result.vertexCount = vertices.size();
+     result.indexCount = indices.size();
+     std::error_code sizeError;
+     result.objBytes = (long long)std::filesystem::file_size(options.loadCompare, sizeError);
+     result.meshBytes = (long long)std::filesystem::file_size(meshPath, sizeError);
+
+     std::vector<double> objMs, meshMs;
+     for (int run = 0; run <= options.loadRuns; run++) {
+          auto start = std::chrono::steady_clock::now();
+          std::vector<PositionColorVertex> objVertices;
+          std::vector<unsigned int> objIndices;
+          loadObj(options.loadCompare, objVertices, objIndices, result.error);
+          optimizeMesh(objVertices, objIndices);
+          Mesh mesh = options.compactVertices
+               ? createQuantizedMesh(path, objVertices.data(), objVertices.size(), objIndices.data(), objIndices.size())
+               : createMesh(path, objVertices.data(), objVertices.size(), objIndices.data(), objIndices.size());
+          glFinish();
+          double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+          deleteMesh(mesh);
+          if (run > 0) {
+               objMs.push_back(ms);
+          }
+
+          start = std::chrono::steady_clock::now();
+          MeshFile file;
+          if (!file.open(meshPath, result.error)) {
+               break;
+          }
+          mesh = createMesh(path, file);
+          glFinish();
+          ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+          deleteMesh(mesh);
+          if (run > 0) {
+               meshMs.push_back(ms);
+          }
+     }
+     std::filesystem::remove(meshPath, sizeError);
+
+     result.objMsP50 = percentile(objMs, 0.50);
+     result.objMsP95 = percentile(objMs, 0.95);
+     result.meshMsP50 = percentile(meshMs, 0.50);
+     result.meshMsP95 = percentile(meshMs, 0.95);
+     return result;
+}
+
+// Strings from the driver can have anything in them
+static std::string jsonEscape(const char* text) {
+     std::string escaped;
+     for (const char* c = text; c != NULL && *c != '\0'; c++) {
+          if (*c == '"' || *c == '\\') {
+               escaped += '\\';
+          }
+          if ((unsigned char)*c >= 0x20) {
+               escaped += *c;
+          }
+     }
+     return escaped;
+}
+
+static void writeJson(std::ostream& out, const BenchOptions& options, RenderPath path, const std::vector<SceneResult>& results) {
+     out << "{\n";
+     out << "  \"renderer\": \"" << jsonEscape((const char*)glGetString(GL_RENDERER)) << "\",\n";
+     out << "  \"version\": \"" << jsonEscape((const char*)glGetString(GL_VERSION)) << "\",\n";
+     out << "  \"render_path\": \"" << renderPathName(path) << "\",\n";
+     out << "  \"vertex_storage\": \"" << (options.vertexStorage == VertexStorage::Split ? "split" : "interleaved") << "\",\n";
+     out << "  \"compact_vertices\": " << (options.compactVertices ? "true" : "false") << ",\n";
+     out << "  \"optimize_indices\": " << (options.optimizeIndices ? "true" : "false") << ",\n";
+     out << "  \"pooled\": " << (options.pooled ? "true" : "false") << ",\n";
+     out << "  \"lod\": " << (options.lod ? "true" : "false") << ",\n";
+     out << "  \"multi_draw\": \"" << (!options.multiDraw ? "off" : IndirectRenderer::supported(path) ? "indirect" : "cpu loop") << "\",\n";
+     out << "  \"width\": " << options.width << ",\n";
+     out << "  \"height\": " << options.height << ",\n";
+     out << "  \"scenes\": [\n";
+     for (size_t i = 0; i < results.size(); i++) {
+          const SceneResult& r = results[i];
+          out << "    { \"triangles\": " << r.triangles
+               << ", \"lod\": " << (r.lod ? "true" : "false")
+               << ", \"triangles_submitted\": " << r.trianglesSubmitted
+               << ", \"meshes\": " << r.meshes
+               << ", \"draw_calls\": " << r.drawCalls
+               << ", \"gl_calls\": " << r.glCalls
+               << ", \"vertex_bytes\": " << r.vertexBytes
+               << ", \"index_bytes\": " << r.indexBytes
+               << ", \"acmr_before\": " << r.acmrBefore
+               << ", \"acmr_after\": " << r.acmrAfter
+               << ", \"acmr_reordered\": " << r.acmrReordered
+               << ", \"meshes_reordered\": " << r.meshesReordered
+               << ", \"frames\": " << r.frames
+               << ", \"fps\": " << r.fps
+               << ", \"cpu_submit_ms_p50\": " << r.cpuSubmitP50
+               << ", \"cpu_submit_ms_p95\": " << r.cpuSubmitP95
+               << ", \"gpu_ms_p50\": " << r.gpuP50
+               << ", \"gpu_ms_p95\": " << r.gpuP95
+               << ", \"state_calls_issued\": " << r.stateIssued
+               << ", \"state_calls_elided\": " << r.stateElided
+               << " }" << (i + 1 < results.size() ? "," : "") << "\n";
+     }
+     out << "  ]\n";
+     out << "}\n";
+}
+
+static void writeLoadJson(std::ostream& out, const BenchOptions& options, RenderPath path, const LoadResult& result) {
+     out << "{\n";
+     out << "  \"renderer\": \"" << jsonEscape((const char*)glGetString(GL_RENDERER)) << "\",\n";
+     out << "  \"version\": \"" << jsonEscape((const char*)glGetString(GL_VERSION)) << "\",\n";
+     out << "  \"render_path\": \"" << renderPathName(path) << "\",\n";
+     out << "  \"compact_vertices\": " << (options.compactVertices ? "true" : "false") << ",\n";
+     out << "  \"file\": \"" << jsonEscape(options.loadCompare.c_str()) << "\",\n";
+     if (!result.error.empty()) {
+          out << "  \"error\": \"" << jsonEscape(result.error.c_str()) << "\"\n";
+          out << "}\n";
+          return;
+     }
+     out << "  \"vertices\": " << result.vertexCount << ",\n";
+     out << "  \"triangles\": " << result.indexCount / 3 << ",\n";
+     out << "  \"runs\": " << options.loadRuns << ",\n";
+     out << "  \"obj\": { \"file_bytes\": " << result.objBytes << ", \"load_ms_p50\": " << result.objMsP50 << ", \"load_ms_p95\": " << result.objMsP95 << " },\n";
+     out << "  \"mesh\": { \"file_bytes\": " << result.meshBytes << ", \"load_ms_p50\": " << result.meshMsP50 << ", \"load_ms_p95\": " << result.meshMsP95 << " },\n";
+     out << "  \"speedup_p50\": " << (result.meshMsP50 > 0.0 ? result.objMsP50 / result.meshMsP50 : 0.0) << "\n";
+     out << "}\n";
+}
+
+int main(int argc, char* argv[]) {
+     // stdout is only the JSON, so it parses as a whole
+          // The shared FirstProject code prints its errors to std::cout, pointing that at stderr keeps them out of the JSON too
+     std::ostream json(std::cout.rdbuf());
+     std::cout.rdbuf(std::cerr.rdbuf());
+
+     BenchOptions options = parseBenchOptions(argc, argv);
+
+     glfwInit(); // Only needed when the headless context falls back to a hidden window
+     HeadlessContext context;
+     if (!createHeadlessContext(context)) {
+          glfwTerminate();
+          return -1;
+     }
+     if (!gladLoadGLLoader(headlessLoader(context))) {
+          std::cerr << "Failed to initialize GLAD" << std::endl;
+          destroyHeadlessContext(context);
+          glfwTerminate();
+          return -1;
+     }
+
+     unsigned int program = compileProgram(benchVertexShaderSource, benchFragmentShaderSource);
+     OffscreenTarget target = createOffscreenTarget(options.width, options.height);
+     glState.viewport(0, 0, options.width, options.height);
+     glState.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+     RenderPath path = chooseRenderPath(options.legacyGL);
+     unsigned int multiDrawProgram = 0;
+     if (options.multiDraw && IndirectRenderer::supported(path)) {
+          multiDrawProgram = compileProgram(benchMultiDrawVertexShaderSource, benchFragmentShaderSource);
+          glShaderStorageBlockBinding(multiDrawProgram, glGetProgramResourceIndex(multiDrawProgram, GL_SHADER_STORAGE_BLOCK, "DrawDataBlock"), DrawDataBinding);
+     }
+
+     if (!options.loadCompare.empty()) {
+          LoadResult result = runLoadCompare(options, path);
+          if (!result.error.empty()) {
+               std::cerr << "ERROR::BENCHMARK::LOAD_COMPARE " << result.error << std::endl;
+          }
+          if (options.outPath.empty()) {
+               writeLoadJson(json, options, path, result);
+          }
+          else {
+               std::ofstream out(options.outPath);
+               writeLoadJson(out, options, path, result);
+          }
+     }
+     else {
+          std::vector<SceneResult> results;
+          for (long long triangles = 1; triangles <= options.maxTriangles; triangles *= 10) {
+               // --lod runs the same scene twice so the JSON has both sides of the comparison next to each other
+               for (int pass = 0; pass < (options.lod ? 2 : 1); pass++) {
+                    results.push_back(runScene(options, path, program, multiDrawProgram, triangles, pass == 1));
+                    const SceneResult& r = results.back();
+                    std::cerr << r.triangles << " triangles" << (r.lod ? " with LODs, " : ", ") << r.drawCalls << " draws in " << r.glCalls << " GL calls: " << r.fps << " fps, "
+                         << r.trianglesSubmitted << " triangles submitted a frame" << std::endl; // Progress, stdout may be the JSON
+               }
+          }
+
+          if (options.outPath.empty()) {
+               writeJson(json, options, path, results);
+          }
+          else {
+               std::ofstream out(options.outPath);
+               writeJson(out, options, path, results);
+          }
+     }
+
+     deleteOffscreenTarget(target);
+     glDeleteProgram(program);
+     if (multiDrawProgram != 0) {
+          glDeleteProgram(multiDrawProgram);
+     }
+     destroyHeadlessContext(context);
+     glfwTerminate();
+     return 0;
+}
@@ -0,0 +1,133 @@
+#include "sceneGenerator.h"
+#include <cmath>
+
+static GeneratedMesh generateGrid(long long triangles, float left, float bottom, float size) {
+     GeneratedMesh mesh;
+     mesh.center[0] = left + size * 0.5f;
+     mesh.center[1] = bottom + size * 0.5f;
+     long long quads = (triangles + 1) / 2;
+     int side = (int)std::ceil(std::sqrt((double)quads));
+     if (side < 1) {
+          side = 1;
+     }
+
+     // (side + 1)^2 vertices so neighbouring quads share corners like a real mesh would
+     mesh.vertices.reserve((size_t)(side + 1) * (side + 1));
+     for (int y = 0; y <= side; y++) {
+          for (int x = 0; x <= side; x++) {
+               float u = (float)x / side;
+               float v = (float)y / side;
+               mesh.vertices.push_back({ { left + u * size, bottom + v * size, 0.0f }, { u, v, 1.0f - u } });
+          }
+     }
+
+     mesh.indices.reserve((size_t)triangles * 3);
+     long long emitted = 0;
+     for (int y = 0; y < side && emitted < triangles; y++) {
+          for (int x = 0; x < side && emitted < triangles; x++) {
+               unsigned int bottomLeft = y * (side + 1) + x;
+               unsigned int bottomRight = bottomLeft + 1;
+               unsigned int topLeft = bottomLeft + side + 1;
+               unsigned int topRight = topLeft + 1;
+
+               mesh.indices.push_back(bottomLeft);
+               mesh.indices.push_back(bottomRight);
+               mesh.indices.push_back(topLeft);
+               emitted++;
+               if (emitted < triangles) {
+                    mesh.indices.push_back(topRight);
+                    mesh.indices.push_back(topLeft);
+                    mesh.indices.push_back(bottomRight);
+                    emitted++;
+               }
+          }
+     }
+     return mesh;
+}
+
+// Rows of latitude between single pole vertices, twice as many segments round as rows so the quads are roughly square
+     // 4 * rows^2 triangles for the whole sphere, the longitude seam shares its vertices so the surface is closed
+static GeneratedMesh generateSphere(long long triangles, float left, float bottom, float size) {
+     GeneratedMesh mesh;
+     mesh.center[0] = left + size * 0.5f;
+     mesh.center[1] = bottom + size * 0.5f;
+     int rows = (int)std::ceil(std::sqrt((double)triangles / 4.0));
+     if (rows < 2) {
+          rows = 2;
+     }
+     int segments = rows * 2;
+     float radius = size * 0.45f;
+     const float pi = 3.14159265f;
+
+     // Colored by normal so every part of the surface looks different
+     auto addVertex = [&](float x, float y, float z) {
+          mesh.vertices.push_back({ { mesh.center[0] + x * radius, mesh.center[1] + y * radius, z * radius }, { 0.5f + 0.5f * x, 0.5f + 0.5f * y, 0.5f + 0.5f * z } });
+     };
+     addVertex(0.0f, 1.0f, 0.0f);
+     for (int row = 1; row <= rows; row++) {
+          float latitude = pi * row / (rows + 1);
+          for (int segment = 0; segment < segments; segment++) {
+               float longitude = 2.0f * pi * segment / segments;
+               addVertex(std::sin(latitude) * std::cos(longitude), std::cos(latitude), std::sin(latitude) * std::sin(longitude));
+          }
+     }
+     addVertex(0.0f, -1.0f, 0.0f);
+     unsigned int bottomPole = (unsigned int)mesh.vertices.size() - 1;
+
+     // Like the grid, the last triangles are left off so the total is exact
+     long long emitted = 0;
+     auto addTriangle = [&](unsigned int a, unsigned int b, unsigned int c) {
+          if (emitted < triangles) {
+               mesh.indices.push_back(a);
+               mesh.indices.push_back(b);
+               mesh.indices.push_back(c);
+               emitted++;
+          }
+     };
+     auto ringVertex = [&](int row, int segment) { return (unsigned int)(1 + (row - 1) * segments + segment % segments); };
+     for (int segment = 0; segment < segments; segment++) {
+          addTriangle(0, ringVertex(1, segment + 1), ringVertex(1, segment));
+     }
+     for (int row = 1; row < rows; row++) {
+          for (int segment = 0; segment < segments; segment++) {
+               addTriangle(ringVertex(row, segment), ringVertex(row, segment + 1), ringVertex(row + 1, segment));
+               addTriangle(ringVertex(row + 1, segment), ringVertex(row, segment + 1), ringVertex(row + 1, segment + 1));
+          }
+     }
+     for (int segment = 0; segment < segments; segment++) {
+          addTriangle(bottomPole, ringVertex(rows, segment), ringVertex(rows, segment + 1));
+     }
+     return mesh;
+}
+
+static std::vector<GeneratedMesh> generateCells(long long triangleCount, int meshCount, bool spheres) {
+     if (meshCount < 1) {
+          meshCount = 1;
+     }
+     if (meshCount > triangleCount) {
+          meshCount = (int)triangleCount;
+     }
+
+     // Meshes get laid out on a square grid covering -1 to 1 in both directions
+     int cells = (int)std::ceil(std::sqrt((double)meshCount));
+     float cellSize = 2.0f / cells;
+
+     std::vector<GeneratedMesh> meshes;
+     meshes.reserve(meshCount);
+     for (int i = 0; i < meshCount; i++) {
+          // The first few meshes take the remainder so the total is exact
+          long long triangles = triangleCount / meshCount + (i < triangleCount % meshCount ? 1 : 0);
+          float left = -1.0f + (i % cells) * cellSize;
+          float bottom = -1.0f + (i / cells) * cellSize;
+          meshes.push_back(spheres ? generateSphere(triangles, left, bottom, cellSize) : generateGrid(triangles, left, bottom, cellSize));
+     }
+     return meshes;
+}
+
+std::vector<GeneratedMesh> generateScene(long long triangleCount, int meshCount) {
+     return generateCells(triangleCount, meshCount, false);
+}
+
+std::vector<GeneratedMesh> generateSphereScene(long long triangleCount, int meshCount) {
+     return generateCells(triangleCount, meshCount, true);
+}
@@ -0,0 +1,20 @@
+#ifndef SCENE_GENERATOR_H
+#define SCENE_GENERATOR_H
+
+#include <vector>
+#include "vertexFormat.h"
+
+// Same vertex type as triVertices in CodeFile.cpp
+struct GeneratedMesh {
+     std::vector<PositionColorVertex> vertices;
+     std::vector<unsigned int> indices;
+     float center[3] = {}; // Middle of the mesh's cell
+};
+
+// Spreads triangleCount triangles over meshCount meshes, each mesh is a grid of quads in its own cell of clip space
+std::vector<GeneratedMesh> generateScene(long long triangleCount, int meshCount);
+
+// Same cells, but each mesh is a sphere, curved so simplifying it costs something (a flat grid simplifies to 2 triangles for free)
+std::vector<GeneratedMesh> generateSphereScene(long long triangleCount, int meshCount);
+
+#endif
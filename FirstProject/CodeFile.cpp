@@ -2,64 +2,107 @@
 #include <GLFW/glfw3.h>
 #include <custom/program.h>
 #include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+#include "appOptions.h"
+#include "extensionBenchmark.h"
+#include "renderPath.h"
+#include "vertexFormat.h"
+#include "vertexQuantize.h"
+#include "headless.h"
+#include "frameProfiler.h"
+#include "programCache.h"
+#include "shaderBatch.h"
+#include "shaderReloader.h"
+#include "uniformRing.h"
+#include "uniformBlocks.h"
+#include "shaderPreprocessor.h"
+#include "embeddedShaders.h"
+#include "glState.h"
+#include "instanceRenderer.h"
+#include "indirectRenderer.h"
+#include "streamBuffer.h"
+#include "meshLoader.h"
+#include "textureManager.h"
 
 void framebufferSizeCallback(GLFWwindow* window, int width, int height);
 void processInput(GLFWwindow* window);
 
-// Shader definitions
-     // General/rectangle
-const char* vertexShaderSource = "#version 460 core\n"
-"layout (location = 0) in vec3 aPos;\n"
-"void main()\n"
-"{\n"
-"   gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
-"}\0";
-
-const char* fragmentShaderSource = "#version 460 core\n"
-"out vec4 FragColor;\n"
-"uniform vec4 ourColor;\n"
-"void main() {\n"
-"    FragColor = ourColor;\n"
-"}\n\0";
-
 // This initialization stuff is all one time things so I'll probably leave it here for now, but for other hints I may move them into other functions
-int main() {
+int main(int argc, char* argv[]) {
+     AppOptions options = parseOptions(argc, argv);
+     auto startTime = std::chrono::steady_clock::now(); // Used to report how long it takes to get the first frame out
+
      // Initialize GLFW, this makes it so GLFW functions can be used
      glfwInit(); 
 
-     // Setup some "hints" for GLFW about openGL
-     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4); // We are using OpenGL 3.x
-     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6); // We are using OpenGL x.3, so in total 3.3
-     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE); // We are using the Core profile for OpenGL, not the other one
-     // glfwWindowHint takes 2 values; the first is an option value from a list of enums, and the second are values for that option, which are usually integers
-     // It is used to setup lots of options, not just the general stuff we have setup 
-
-     // Create a window, this is necessary for other GLFW stuff to work
-     GLFWwindow* window = glfwCreateWindow(800, 600, "WindownTitle", NULL, NULL);
-          // width, height, name, and two variables we are ignoring for now (they need to be set to NULL)
-     if (window == NULL) {
-          std::cout << "Failed to create GLFW window" << std::endl;
-          glfwTerminate();
-          return -1;
+     GLFWwindow* window = NULL;
+     HeadlessContext headlessContext;
+     GLADloadproc loader = (GLADloadproc)glfwGetProcAddress;
+     if (options.headless) { // No window at all, see headless.h
+          if (!createHeadlessContext(headlessContext)) {
+               glfwTerminate();
+               return -1;
+          }
+          window = headlessContext.window; // Only set when it had to fall back to a hidden GLFW window
+          loader = headlessLoader(headlessContext);
+     }
+     else {
+          // Setup some "hints" for GLFW about openGL
+          glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4); // We are using OpenGL 3.x
+          glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6); // We are using OpenGL x.3, so in total 3.3
+          glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE); // We are using the Core profile for OpenGL, not the other one
+          // glfwWindowHint takes 2 values; the first is an option value from a list of enums, and the second are values for that option, which are usually integers
+          // It is used to setup lots of options, not just the general stuff we have setup 
+
+          // Create a window, this is necessary for other GLFW stuff to work
+          window = glfwCreateWindow(800, 600, "WindownTitle", NULL, NULL);
+               // width, height, name, and two variables we are ignoring for now (they need to be set to NULL)
+          if (window == NULL) { // No 4.6 driver, try again with 3.3 and the bind-to-edit path
+               glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+               glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+               window = glfwCreateWindow(800, 600, "WindownTitle", NULL, NULL);
+          }
+          if (window == NULL) {
+               std::cout << "Failed to create GLFW window" << std::endl;
+               glfwTerminate();
+               return -1;
+          }
+          glfwMakeContextCurrent(window); // Makes the current thread use this window
+               // More specifically, sets the main context for this thread this window's context
+               // Each thread can only have one window at a time
+               // Calling this with another window will push this one out of the context and initlaize some flush stuff
+               // It can accept Null to set the current context to nothing
+               // If you want to move a window from one thread to another, the first context should be set to Null
+                // before setting the window in the second context
      }
-     glfwMakeContextCurrent(window); // Makes the current thread use this window
-          // More specifically, sets the main context for this thread this window's context
-          // Each thread can only have one window at a time
-          // Calling this with another window will push this one out of the context and initlaize some flush stuff
-          // It can accept Null to set the current context to nothing
-          // If you want to move a window from one thread to another, the first context should be set to Null
-           // before setting the window in the second context
 
 
      // GLAD manages function pointers for OpenGL and so we want to initialize it before calling any OpenGL function, this does that
-     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) { // glfw... gives the function pointers for this OS, which we then pass to glad
+     // The lazy version only looks up a function the first time it is called, so startup doesn't pay for the few hundred we never use
+     auto loadStart = std::chrono::steady_clock::now();
+     int gladLoaded = options.lazyGL ? gladLoadGLLoaderLazy(loader) : gladLoadGLLoader(loader);
+     if (!gladLoaded) { // glfw... gives the function pointers for this OS, which we then pass to glad (EGL gives them for headless runs)
           std::cout << "Failed to initialize GLAD" << std::endl;
           return -1;
      }
+     const char* loadMode = options.lazyGL ? "lazy" : "eager";
+     std::cout << "GLAD load (" << loadMode << "): " << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count() << " ms" << std::endl;
+
+     // Extension queries can be made through gladHasExtension() from here on, the list is kept after loading
+     if (options.benchExtensions) {
+          runExtensionBenchmark(10000);
+          glfwTerminate();
+          return 0;
+     }
 
      // Before we can render, we have to tell OpenGL the size of the rendering window
       // This tells OGL how we want to display the data and coordinates with respect to the window
-     glViewport(0, 0, 800, 600);
+     glState.viewport(0, 0, 800, 600); // Through the state cache like every other state change, see glState.h
           // The first two set the location of the lower left corner of the window
           // The third sets the width, the fourth height
      // In this case we set the viewport as the same size as the window we created, but that isn't necessary
@@ -85,50 +128,50 @@ int main() {
      There are lots of callback functions which can be used
      They should be set after the window it needs is created, and before the render loop is initiated
      */
-     glfwSetFramebufferSizeCallback(window, framebufferSizeCallback);
+     if (!options.headless) {
+          glfwSetFramebufferSizeCallback(window, framebufferSizeCallback);
+     }
 
      // Shaders
-     int success;
-     char infoLog[512];
-          // Vertex
-     unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
-     glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-     glCompileShader(vertexShader);
-     
-     glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-     if (!success)
-     {
-          glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-          std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
-     }
-          // Fragment
-     unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-     glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-     glCompileShader(fragmentShader);
-
-     glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-     if (!success)
-     {
-          glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-          std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
-     }
-          // Shader program
-     unsigned int shaderProgram = glCreateProgram();
-     glAttachShader(shaderProgram, vertexShader);
-     glAttachShader(shaderProgram, fragmentShader);
-     glLinkProgram(shaderProgram);
-
-     glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-     if (!success) {
-          glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-          std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
-     }
-          // Delete shaders
-     glDeleteShader(vertexShader);
-     glDeleteShader(fragmentShader);
+     // Compiling and linking lives in programCache.cpp now, so both programs can come from the on-disk binary cache instead
+     ProgramCache programCache(options.shaderCacheDir);
+     setShaderOverrideDirectory(options.shaderDir); // Embedded copies are used for anything not found here, see embeddedShaders.h
+     // Both programs are submitted together and compile while the meshes get set up, nothing waits on them until they're drawn with
+     ShaderBatch shaderBatch(&programCache);
 
           // Shaders via the shader class instead of inside this code
-     Program triProgram("vertexShader.txt", "fragmentShader.txt");
+          // The general/rectangle shader that used to be written out here is the same files without VERTEX_COLOR, it colors with the ourColor uniform
+     ShaderVariants shaderVariants("vertexShader.txt", "fragmentShader.txt", shaderBatch);
+     Program& flatProgram = shaderVariants.get(0);
+     Program& triProgram = shaderVariants.get(ShaderFeatureVertexColor);
+     // Only built when --instances asks for it, it reads a transform and tint per copy
+     Program* instancedProgram = options.instances > 0 ? &shaderVariants.get(ShaderFeatureVertexColor | ShaderFeatureInstanced) : nullptr;
+     // Only with --multi-draw, and the gl_DrawID variant only when the context can run it, IndirectRenderer loops over plain draws otherwise
+     unsigned int multiDrawFeatures = ShaderFeatureVertexColor;
+     if (options.multiDraw && IndirectRenderer::supported(chooseRenderPath(options.legacyGL))) {
+          multiDrawFeatures |= ShaderFeatureMultiDraw;
+     }
+     Program* multiDrawProgram = options.multiDraw ? &shaderVariants.get(multiDrawFeatures) : nullptr;
+     // Only with --texture, it samples diffuseTexture from unit 0
+     Program* texturedProgram = !options.textures.empty() ? &shaderVariants.get(ShaderFeatureVertexColor | ShaderFeatureTextured) : nullptr;
+
+     // Edits to the shader files get compiled on a second context in the background, see shaderReloader.h
+     ShaderReloader shaderReloader;
+     HeadlessContext reloadContext;
+     if (options.hotReload && createSharedContext(window, headlessContext, reloadContext)) {
+          shaderReloader.watch(triProgram, "vertexShader.txt", "fragmentShader.txt", ShaderFeatureVertexColor);
+          shaderReloader.watch(flatProgram, "vertexShader.txt", "fragmentShader.txt", 0);
+          if (instancedProgram != nullptr) {
+               shaderReloader.watch(*instancedProgram, "vertexShader.txt", "fragmentShader.txt", ShaderFeatureVertexColor | ShaderFeatureInstanced);
+          }
+          if (multiDrawProgram != nullptr) {
+               shaderReloader.watch(*multiDrawProgram, "vertexShader.txt", "fragmentShader.txt", multiDrawFeatures);
+          }
+          if (texturedProgram != nullptr) {
+               shaderReloader.watch(*texturedProgram, "vertexShader.txt", "fragmentShader.txt", ShaderFeatureVertexColor | ShaderFeatureTextured);
+          }
+          shaderReloader.start(reloadContext);
+     }
 
 
      // Make triangle data
@@ -144,11 +187,11 @@ int main() {
           2, 3, 1, // Top triangle
      };
 
-     float triVertices[] = {
-          // positions        // colors
-          0.5f, -0.5f, 0.0f,  1.0f, 0.0f, 0.0f, // bottom right
-         -0.5f, -0.5f, 0.0f,  0.0f, 1.0f, 0.0f, // bottom left
-          0.0f,  0.5f, 0.0f,  0.0f, 0.0f, 1.0f  // top
+     PositionColorVertex triVertices[] = {
+          // positions            // colors
+          { { 0.5f, -0.5f, 0.0f}, {1.0f, 0.0f, 0.0f} }, // bottom right
+          { {-0.5f, -0.5f, 0.0f}, {0.0f, 1.0f, 0.0f} }, // bottom left
+          { { 0.0f,  0.5f, 0.0f}, {0.0f, 0.0f, 1.0f} }  // top
      };
 
      unsigned int triIndices[] = {
@@ -173,100 +216,420 @@ int main() {
      * 
      * glBindVertexArray(VAOs[object1]);
      * etc.
+     * 
+     * Past a handful of objects MeshPool (meshPool.h) is the better way, every mesh shares one VBO, one EBO and one VAO
+     * and gets drawn with glDrawElementsBaseVertex, so there's one bind no matter how many objects there are
      */
-     unsigned int VAO, VBO, EBO;
-     glGenVertexArrays(1, &VAO);
-     glGenBuffers(1, &VBO);
-     glGenBuffers(1, &EBO);
+     // The bind-to-edit setup from the tutorial lives in renderPath.cpp now, next to the DSA version used on 4.5+
+     RenderPath renderPath = chooseRenderPath(options.legacyGL);
+     // Strides, offsets and types come from PositionColorVertex's layout in vertexFormat.h
+     VertexStorage vertexStorage = options.splitVertices ? VertexStorage::Split : VertexStorage::Interleaved;
+     Mesh triMesh = options.compactVertices
+          ? createQuantizedMesh(renderPath, triVertices, 3, triIndices, 3, vertexStorage)
+          : createMesh(renderPath, triVertices, 3, triIndices, 3, vertexStorage);
+
+     // --multi-draw : the triangle goes into a MeshPool too, every draw from a pool shares its VAO so one indirect call can cover them all
+     MeshPool meshPool;
+     PooledMesh triPooled;
+     IndirectRenderer indirectRenderer;
+     if (options.multiDraw) {
+          if (options.compactVertices) {
+               QuantizedVertices quantized = quantizeVertices(triVertices, 3);
+               meshPool.init(renderPath, vertexFormat<CompactVertex>(), 1 << 16, 1 << 16);
+               triPooled = meshPool.add(quantized.vertices.data(), quantized.vertices.size(), triIndices, 3);
+               triPooled.quantization = quantized.quantization;
+          }
+          else {
+               meshPool.init(renderPath, vertexFormat<PositionColorVertex>(), 1 << 16, 1 << 16);
+               triPooled = meshPool.add(triVertices, 3, triIndices, 3);
+          }
+          indirectRenderer.init(renderPath, 64, sizeof(DrawBlock));
+     }
+     shaderBatch.poll(); // Picks up whatever finished during the mesh setup
 
-     // Binding
-     glBindVertexArray(VAO);
+     // glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); // Lets you see how shapes are drawn with lines, good for seeing how stuff fits together
 
-     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-     glBufferData(GL_ARRAY_BUFFER, sizeof(triVertices), triVertices, GL_STATIC_DRAW);
+     // Timing for each part of the frame, only does anything with --profile
+     FrameProfiler profiler;
+     int inputScope = profiler.addScope("input");
+     int clearScope = profiler.addScope("clear");
+     int uploadScope = profiler.addScope("upload");
+     int drawScope = profiler.addScope("draw");
+     int swapScope = profiler.addScope("swap");
+     if (options.profile) {
+          profiler.init(options.profileCsv);
+     }
 
-     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(triIndices), triIndices, GL_STATIC_DRAW);
+     // --load DIR : every .obj and .mesh in DIR is parsed (or mapped) on worker threads and streamed into a MeshPool a budget at a time, frames keep drawing meanwhile
+     MeshLoader meshLoader;
+     std::vector<int> loadedMeshes;
+     std::vector<int> loadedLevels; // The LOD each mesh drew with last frame, selectLod needs it for hysteresis
+     long long lodTriangles = 0, fullTriangles = 0; // Drawn and what the full meshes would have been, last frame
+     if (!options.loadDir.empty()) {
+          MeshLoaderSettings loaderSettings;
+          loaderSettings.uploadBudgetBytes = (size_t)(options.uploadBudgetKB > 0 ? options.uploadBudgetKB : 1) * 1024;
+          loaderSettings.compactVertices = options.compactVertices;
+          loaderSettings.lodLevels = options.lod ? maxLodLevels : 1;
+          meshLoader.init(renderPath, loaderSettings);
+          std::vector<std::string> paths;
+          std::error_code error;
+          for (const auto& entry : std::filesystem::directory_iterator(options.loadDir, error)) {
+               if (entry.path().extension() == ".obj" || entry.path().extension() == ".mesh") {
+                    paths.push_back(entry.path().string());
+               }
+          }
+          std::sort(paths.begin(), paths.end()); // Directory order isn't stable, the grid should be
+          for (const std::string& path : paths) {
+               loadedMeshes.push_back(meshLoader.load(path));
+               loadedLevels.push_back(0);
+          }
+          std::cout << "Loading " << paths.size() << " meshes from " << options.loadDir << std::endl;
+     }
 
-     // Vertex Attribute
-     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
-     glEnableVertexAttribArray(0);
-     glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
-     glEnableVertexAttribArray(1);
+     // --texture FILE : each file is decoded on a worker thread and streamed into its texture through a pixel unpack buffer, its quad draws untextured until then
+     TextureManager textureManager;
+     std::vector<int> loadedTextures;
+     Mesh quadMesh;
+     if (!options.textures.empty()) {
+          TextureManagerSettings textureSettings;
+          textureSettings.uploadBudgetBytes = (size_t)(options.uploadBudgetKB > 0 ? options.uploadBudgetKB : 1) * 1024;
+          textureManager.init(renderPath, textureSettings);
+          for (const std::string& path : options.textures) {
+               loadedTextures.push_back(textureManager.load(path)); // The same file twice gets the same handle, and is only decoded once
+          }
+          PositionColorTexVertex quadVertices[] = {
+               // positions             // colors           // texture coordinates
+               { {-0.5f, -0.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f} }, // bottom left
+               { { 0.5f, -0.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, {1.0f, 0.0f} }, // bottom right
+               { { 0.5f,  0.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, {1.0f, 1.0f} }, // top right
+               { {-0.5f,  0.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, {0.0f, 1.0f} }  // top left
+          };
+          unsigned int quadIndices[] = { 0, 1, 3, 2, 3, 1 };
+          quadMesh = createMesh(renderPath, quadVertices, 4, quadIndices, 6, vertexStorage);
+          std::cout << "Loading " << options.textures.size() << " textures" << std::endl;
+     }
 
-     glBindBuffer(GL_ARRAY_BUFFER, 0); // We can unbind the array buffer because VBO/EBO are noted inside VAO, they will bind and unbind via VAO
-     glBindVertexArray(0); // This isn't directly necessary because when you are binding to a VAO, you have to call glBindVertexArray() anyway which will unbind the current ont
+     // Per frame and per draw uniforms are whole blocks copied into a ring buffer, instead of a glUniform call for each value
+     UniformRing uniformRing;
+     uniformRing.init(sizeof(FrameBlock) > sizeof(DrawBlock) ? sizeof(FrameBlock) : sizeof(DrawBlock), 4 + (int)loadedMeshes.size() + (int)loadedTextures.size());
+     const float identity[16] = { 1, 0, 0, 0,  0, 1, 0, 0,  0, 0, 1, 0,  0, 0, 0, 1 };
+
+     // --instances N : N shrunk copies of the triangle on a grid, each with its own tint, drawn with one instanced draw
+     InstanceRenderer instanceRenderer;
+     std::vector<InstanceData> instances;
+     if (options.instances > 0) {
+          instanceRenderer.init(renderPath, uniformRing, options.instances);
+          int side = (int)std::ceil(std::sqrt((double)options.instances));
+          float cell = 2.0f / side;
+          for (int i = 0; i < options.instances; i++) {
+               float u = (float)(i % side) / side;
+               float v = (float)(i / side) / side;
+               InstanceData instance = {};
+               instance.model[0][0] = cell;
+               instance.model[1][1] = cell;
+               instance.model[2][2] = 1.0f;
+               instance.model[3][0] = -1.0f + (u + 0.5f / side) * 2.0f; // Translation is the last column
+               instance.model[3][1] = -1.0f + (v + 0.5f / side) * 2.0f;
+               instance.model[3][3] = 1.0f;
+               instance.tint[0] = 0.5f + 0.5f * u;
+               instance.tint[1] = 0.5f + 0.5f * v;
+               instance.tint[2] = 1.0f - 0.5f * u;
+               instance.tint[3] = 1.0f;
+               instances.push_back(instance);
+          }
+     }
 
-     // glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); // Lets you see how shapes are drawn with lines, good for seeing how stuff fits together
+     // --particles N : geometry that changes every frame, written straight into mapped buffer memory instead of re-uploaded
+     StreamBuffer particleStream;
+     if (options.particles > 0) {
+          particleStream.init(renderPath, vertexFormat<PositionColorVertex>(), (size_t)options.particles * 3);
+     }
 
-     // The actual loop for rendering a window
-     while (!glfwWindowShouldClose(window)) { // This is called the Render Loop, it will go until we tell glfw to stop the loop
-               // The above function checks if the given window has been told to close; if not continue the loop, if so stop it
-          
-          // Every frame, check what input needs to be processeds
-          processInput(window);
+     bool firstFrameReported = false;
+     auto reportFirstFrame = [&]() {
+          std::cout << "Time to first frame (" << loadMode << "): " << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count() << " ms" << std::endl;
+     };
 
+     // Everything that gets drawn each frame, shared by the window's render loop and headless runs
+     auto drawScene = [&]() {
+          shaderReloader.apply(); // Between frames is the only place a program can change without a frame using two of them
+          uniformRing.beginFrame();
+          particleStream.beginFrame();
           // Rendering commands
           /*
           * There is some rendering we may want to do every frame so the current buffer has a base level
           * We can do other rendering here as well, but it will be dependent on the state
           */
           // You always want to clear the screen
-          glClearColor(0.2f, 0.3f, 0.3f, 1.0f); // This sets the color we want to clear the screen to whenever glClear is called with the color buffer bit
+          profiler.beginScope(clearScope);
+          glState.clearColor(0.2f, 0.3f, 0.3f, 1.0f); // This sets the color we want to clear the screen to whenever glClear is called with the color buffer bit
                // RGB, A
           glClear(GL_COLOR_BUFFER_BIT); // Since we give glCLear the buffer bit, this will clear the screen's color AND replace it with the set clearColor
                // glClearColor is a state-setting function
+               // Going through glState means it only reaches the driver when the color actually changes, so once for the whole run here
                // glClear is a state-using function
+          profiler.endScope(clearScope);
+
+          if (!loadedMeshes.empty() || !loadedTextures.empty()) {
+               // Outside the draw scope so the scopes still add up to the frame, both return right away when they have nothing to do, or weren't started
+               profiler.beginScope(uploadScope);
+               meshLoader.update();
+               textureManager.update();
+               profiler.endScope(uploadScope);
+          }
 
           // Draw the triangle
+          profiler.beginScope(drawScope);
           //glUseProgram(shaderProgram);
 
+          FrameBlock frameBlock;
+          memcpy(frameBlock.viewProjection, identity, sizeof(identity));
+          frameBlock.time[0] = (float)std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+          uniformRing.push(FrameBinding, &frameBlock, sizeof(frameBlock));
+
+          if (options.particles > 0) {
+               // Small triangles circling the middle, every vertex is rebuilt from the time each frame
+               StreamAllocation allocation;
+               PositionColorVertex* particle = particleStream.allocate<PositionColorVertex>((size_t)options.particles * 3, allocation);
+               for (int i = 0; particle != nullptr && i < options.particles; i++) {
+                    float angle = frameBlock.time[0] * 0.5f + 6.2831853f * i / options.particles;
+                    float radius = 0.6f + 0.2f * std::sin(frameBlock.time[0] + i);
+                    float x = radius * std::cos(angle), y = radius * std::sin(angle);
+                    float shade = (float)i / options.particles;
+                    *particle++ = { { x - 0.02f, y - 0.02f, 0.0f }, { 1.0f, shade, 0.0f } };
+                    *particle++ = { { x + 0.02f, y - 0.02f, 0.0f }, { 1.0f, shade, 0.0f } };
+                    *particle++ = { { x, y + 0.02f, 0.0f }, { 1.0f, 1.0f, shade } };
+               }
+               triProgram.use();
+               DrawBlock particleBlock; // Float positions, already where they go
+               uniformRing.push(DrawBinding, &particleBlock, sizeof(particleBlock));
+               particleStream.draw(GL_TRIANGLES, allocation);
+               particleStream.endFrame(); // Nothing else draws from this frame's region, so it can be fenced now
+          }
+
+          if (!loadedMeshes.empty()) {
+               // A cell per file in load order, each mesh shows up the frame its upload finishes
+               triProgram.use();
+               int side = (int)std::ceil(std::sqrt((double)loadedMeshes.size()));
+               float cell = 2.0f / side;
+               lodTriangles = fullTriangles = 0;
+               for (size_t i = 0; i < loadedMeshes.size(); i++) {
+                    if (!meshLoader.ready(loadedMeshes[i])) {
+                         continue;
+                    }
+                    const PooledMesh& mesh = meshLoader.mesh(loadedMeshes[i]);
+                    const MeshBounds& bounds = meshLoader.bounds(loadedMeshes[i]);
+                    float scale = bounds.radius > 0.0f ? cell * 0.45f / bounds.radius : 1.0f;
+                    DrawBlock meshBlock = makeDrawBlock(NULL, mesh.quantization);
+                    meshBlock.model[0] = meshBlock.model[5] = meshBlock.model[10] = scale;
+                    meshBlock.model[12] = -1.0f + cell * (i % side + 0.5f) - bounds.center[0] * scale;
+                    meshBlock.model[13] = -1.0f + cell * (i / side + 0.5f) - bounds.center[1] * scale;
+                    meshBlock.model[14] = -bounds.center[2] * scale;
+                    uniformRing.push(DrawBinding, &meshBlock, sizeof(meshBlock));
+                    // Clip space is 2 units tall whatever the viewport is, and the view projection is the identity
+                    const LodChain& lods = meshLoader.lods(loadedMeshes[i]);
+                    loadedLevels[i] = selectLod(lods, scale * glState.viewportHeight() * 0.5f, loadedLevels[i]);
+                    const LodLevel& level = lods.levels[loadedLevels[i]];
+                    meshLoader.pool().draw(mesh, level.firstIndex, level.indexCount);
+                    lodTriangles += level.indexCount / 3;
+                    fullTriangles += mesh.indexCount / 3;
+               }
+          }
+
+          if (!loadedTextures.empty()) {
+               // A cell per --texture, sized to the image's aspect ratio once it's known
+               texturedProgram->use();
+               texturedProgram->set("diffuseTexture", 0); // Sampler uniforms hold a texture unit, not a texture
+               int side = (int)std::ceil(std::sqrt((double)loadedTextures.size()));
+               float cell = 2.0f / side;
+               for (size_t i = 0; i < loadedTextures.size(); i++) {
+                    int texture = loadedTextures[i];
+                    float width = cell * 0.9f, height = cell * 0.9f;
+                    if (textureManager.ready(texture)) {
+                         float aspect = (float)textureManager.width(texture) / textureManager.height(texture);
+                         if (aspect > 1.0f) {
+                              height /= aspect;
+                         }
+                         else {
+                              width *= aspect;
+                         }
+                    }
+                    DrawBlock quadBlock = makeDrawBlock(NULL, quadMesh.quantization);
+                    quadBlock.model[0] = width;
+                    quadBlock.model[5] = height;
+                    quadBlock.model[12] = -1.0f + cell * (i % side + 0.5f);
+                    quadBlock.model[13] = -1.0f + cell * (i / side + 0.5f);
+                    uniformRing.push(DrawBinding, &quadBlock, sizeof(quadBlock));
+                    textureManager.bind(texture, 0); // The 1x1 white fallback until it's ready
+                    drawMesh(renderPath, quadMesh);
+               }
+          }
+
+          if (instancedProgram != nullptr) {
+               // Every submit of the same mesh and program lands in the same batch, flush turns each batch into one draw
+               for (const InstanceData& instance : instances) {
+                    instanceRenderer.submit(*instancedProgram, triMesh, instance);
+               }
+               instanceRenderer.flush();
+               uniformRing.endFrame();
+               profiler.endScope(drawScope);
+               return;
+          }
+
+          if (multiDrawProgram != nullptr) {
+               // The DrawBlock goes into the indirect renderer's storage buffer instead of the ring, submit is one call for the whole pass
+               multiDrawProgram->use();
+               DrawBlock drawBlock = makeDrawBlock(identity, triPooled.quantization);
+               indirectRenderer.add(triPooled, &drawBlock);
+               indirectRenderer.submit(meshPool, [&](const void* drawData) {
+                    uniformRing.push(DrawBinding, drawData, sizeof(DrawBlock));
+               });
+               uniformRing.endFrame();
+               profiler.endScope(drawScope);
+               return;
+          }
+
           triProgram.use();
 
+          DrawBlock drawBlock = makeDrawBlock(identity, triMesh.quantization);
+          uniformRing.push(DrawBinding, &drawBlock, sizeof(drawBlock));
+
           /*float timeValue = glfwGetTime();
           float greenValue = sin(timeValue) / 2.0f + 0.5f;
           float redValue = 1 - greenValue;
           int vertexColorLocation = glGetUniformLocation(shaderProgram, "ourColor");
           glUniform4f(vertexColorLocation, redValue, greenValue, 0.0f, 1.0f);*/
+          // With a Program the lookup is done once after linking, and the upload is skipped when the color hasn't changed:
+          // flatProgram.set("ourColor", redValue, greenValue, 0.0f, 1.0f);
 
 
-          glBindVertexArray(VAO); // We only have one VAO so we wouldn't have to do this everytime, but its good practice for later
-          glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0);
-          glBindVertexArray(0); // Restting it is good practice, though you can just bind another VAO as well
+          drawMesh(renderPath, triMesh); // The bind path binds and resets the VAO every draw, DSA only binds when it changes
+          uniformRing.endFrame();
+          profiler.endScope(drawScope);
           // int count = sizeof(vertices) / sizeof(vertices[0]); Get array size, I'm wondering if this can be done through the VAO instead
+     };
 
-
-          // This does a few things
-          glfwPollEvents();
+     if (options.headless) {
+          // No swapping or events, just draw into the FBO as many times as asked
+          OffscreenTarget target = createOffscreenTarget(options.width, options.height);
+          glState.viewport(0, 0, options.width, options.height);
+
+          auto runStart = std::chrono::steady_clock::now();
+          for (int frame = 0; frame < options.frames; frame++) {
+               profiler.beginFrame();
+               drawScene();
+               profiler.endFrame();
+               glState.endFrame();
+               if (frame == 0) {
+                    glFinish(); // Nothing is presented, so wait for the first frame to actually finish before calling it done
+                    reportFirstFrame();
+               }
+          }
+          glFinish(); // Same for the whole run, otherwise we'd only be timing how fast commands get queued
+          double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - runStart).count();
+          std::cout << "Headless: " << options.frames << " frames at " << options.width << "x" << options.height << " in " << seconds * 1000.0 << " ms ("
+               << (seconds > 0.0 ? options.frames / seconds : 0.0) << " fps)" << std::endl;
+          std::cout << "Renderer: " << (const char*)glGetString(GL_RENDERER) << std::endl;
+
+          if (!options.dumpPath.empty() && dumpOffscreenTarget(target, options.dumpPath.c_str())) {
+               std::cout << "Wrote " << options.dumpPath << std::endl;
+          }
+          deleteOffscreenTarget(target);
+     }
+     else {
+          // The actual loop for rendering a window
+          while (!glfwWindowShouldClose(window)) { // This is called the Render Loop, it will go until we tell glfw to stop the loop
+                    // The above function checks if the given window has been told to close; if not continue the loop, if so stop it
+          
+               profiler.beginFrame();
+
+               // This does a few things
+               profiler.beginScope(inputScope);
+               glfwPollEvents();
+                    /*
+                    * Checks if any events have been triggered, such as keyboard input or mouse movement events
+                    * Updates the window state
+                    * Calls corresponding functions, which are registered via callback methods
+                    */
+                    // Polling right before processInput means the keys it checks are this frame's
+
+               // Every frame, check what input needs to be processeds
+               processInput(window);
+               profiler.endScope(inputScope);
+
+               drawScene();
+
+               // This swaps the pixel buffer for the given window
+               profiler.beginScope(swapScope);
+               glfwSwapBuffers(window);
+               profiler.endScope(swapScope);
+               profiler.endFrame();
+               glState.endFrame();
+               if (!firstFrameReported) {
+                    reportFirstFrame();
+                    firstFrameReported = true;
+               }
                /*
-               * Checks if any events have been triggered, such as keyboard input or mouse movement events
-               * Updates the window state
-               * Calls corresponding functions, which are registered via callback methods
+               * Swaps the color buffer which is a large 2D buffer which contains color data for all pixels in the window
+               * The now selected buffer is used as output for this frame
                */
-
-          // This swaps the pixel buffer for the given window
-          glfwSwapBuffers(window);
-          /*
-          * Swaps the color buffer which is a large 2D buffer which contains color data for all pixels in the window
-          * The now selected buffer is used as output for this frame
-          */
-          /* Double buffer stuff
-          OpenGL uses a double buffer; a "front" buffer which contains what the user sees and a "back" buffer which is actually drawn to
-               Most windowing applications use this
-          This is done because drawing can't be done instantly, every pixel has to be drawn
-          If a single buffer is used, artifacts start appearing
-          So the front buffer is only ever a finished product, while commands are rendered (drawn) to the back buffer
-               Once all commands have finished rendering to the back buffer, the 2 swap places
-          */
+               /* Double buffer stuff
+               OpenGL uses a double buffer; a "front" buffer which contains what the user sees and a "back" buffer which is actually drawn to
+                    Most windowing applications use this
+               This is done because drawing can't be done instantly, every pixel has to be drawn
+               If a single buffer is used, artifacts start appearing
+               So the front buffer is only ever a finished product, while commands are rendered (drawn) to the back buffer
+                    Once all commands have finished rendering to the back buffer, the 2 swap places
+               */
+          }
      }
 
      // Best practice to cleanup resources once they are no longer used
-     glDeleteVertexArrays(1, &VAO);
-     glDeleteBuffers(1, &VBO);
-     glDeleteBuffers(1, &EBO);
-     glDeleteProgram(shaderProgram);
+     if (options.instances > 0) {
+          instanceRenderer.forgetMesh(triMesh);
+          instanceRenderer.shutdown();
+          instanceRenderer.printStats();
+     }
+     if (!loadedMeshes.empty()) {
+          meshLoader.shutdown();
+          meshLoader.printStats();
+          if (options.lod) {
+               std::cout << "LOD: " << lodTriangles << " of " << fullTriangles << " triangles drawn in the last frame" << std::endl;
+          }
+     }
+     if (!loadedTextures.empty()) {
+          textureManager.shutdown();
+          textureManager.printStats();
+          deleteMesh(quadMesh);
+     }
+     if (options.particles > 0) {
+          particleStream.shutdown();
+          particleStream.printStats();
+     }
+     if (options.multiDraw) {
+          indirectRenderer.shutdown();
+          indirectRenderer.printStats();
+          meshPool.remove(triPooled);
+          meshPool.shutdown();
+     }
+     uniformRing.shutdown();
+     uniformRing.printStats();
+     profiler.shutdown();
+     profiler.printSummary();
+     std::cout << "Render path: " << renderPathName(renderPath) << std::endl;
+     glState.printStats();
+     shaderReloader.stop();
+     destroyHeadlessContext(reloadContext);
+     shaderBatch.waitAll();
+     shaderBatch.printStats();
+     programCache.printStats();
+     deleteMesh(triMesh);
+     shaderVariants.release();
 
      // Once we're done with the program, we should cleanup GLFW stuff
+     if (options.headless) {
+          destroyHeadlessContext(headlessContext);
+     }
      glfwTerminate();
      return 0;
 }
@@ -274,7 +637,7 @@ int main() {
 
 // If the user resizes the window it should have it's width and height adjusted accordingly
 void framebufferSizeCallback(GLFWwindow* window, int width, int height) {
-     glViewport(0, 0, width, height);
+     glState.viewport(0, 0, width, height);
 }
 
 // A general function for handling all input processing
@@ -0,0 +1,106 @@
+#include "appOptions.h"
+#include <cstring>
+#include <cstdlib>
+#include <iostream>
+
+AppOptions parseOptions(int argc, char* argv[]) {
+     AppOptions options;
+
+     for (int i = 1; i < argc; i++) {
+          const char* arg = argv[i];
+
+          if (strcmp(arg, "--bench-extensions") == 0) {
+               options.benchExtensions = true;
+          }
+          else if (strcmp(arg, "--lazy-gl") == 0) {
+               options.lazyGL = true;
+          }
+          else if (strcmp(arg, "--legacy-gl") == 0) {
+               options.legacyGL = true;
+          }
+          else if (strcmp(arg, "--split-vertices") == 0) {
+               options.splitVertices = true;
+          }
+          else if (strcmp(arg, "--compact-vertices") == 0) {
+               options.compactVertices = true;
+          }
+          else if (strcmp(arg, "--instances") == 0 && i + 1 < argc) {
+               options.instances = atoi(argv[++i]);
+          }
+          else if (strcmp(arg, "--multi-draw") == 0) {
+               options.multiDraw = true;
+          }
+          else if (strcmp(arg, "--particles") == 0 && i + 1 < argc) {
+               options.particles = atoi(argv[++i]);
+          }
+          else if (strcmp(arg, "--load") == 0 && i + 1 < argc) {
+               options.loadDir = argv[++i];
+          }
+          else if (strcmp(arg, "--upload-budget") == 0 && i + 1 < argc) {
+               options.uploadBudgetKB = atoi(argv[++i]);
+          }
+          else if (strcmp(arg, "--lod") == 0) {
+               options.lod = true;
+          }
+          else if (strcmp(arg, "--texture") == 0 && i + 1 < argc) {
+               options.textures.push_back(argv[++i]);
+          }
+          else if (strcmp(arg, "--headless") == 0) {
+               options.headless = true;
+          }
+          else if (strcmp(arg, "--frames") == 0 && i + 1 < argc) {
+               options.frames = atoi(argv[++i]);
+          }
+          else if (strcmp(arg, "--size") == 0 && i + 1 < argc) {
+               // strtol instead of sscanf, MSVC's SDL checks reject sscanf
+               char* end = NULL;
+               options.width = (int)strtol(argv[++i], &end, 10);
+               options.height = *end == 'x' ? (int)strtol(end + 1, NULL, 10) : 0;
+               if (options.width <= 0 || options.height <= 0) {
+                    std::cout << "WARNING::OPTIONS::BAD_SIZE " << argv[i] << std::endl;
+                    options.width = 800;
+                    options.height = 600;
+               }
+          }
+          else if (strcmp(arg, "--dump") == 0 && i + 1 < argc) {
+               options.dumpPath = argv[++i];
+          }
+          else if (strcmp(arg, "--shader-cache") == 0 && i + 1 < argc) {
+               options.shaderCacheDir = argv[++i];
+          }
+          else if (strcmp(arg, "--no-shader-cache") == 0) {
+               options.shaderCacheDir.clear();
+          }
+          else if (strcmp(arg, "--hot-reload") == 0) {
+               options.hotReload = true;
+          }
+          else if (strcmp(arg, "--shader-dir") == 0 && i + 1 < argc) {
+               options.shaderDir = argv[++i];
+          }
+          else if (strcmp(arg, "--embedded-shaders") == 0) {
+               options.shaderDir.clear();
+          }
+          else if (strcmp(arg, "--profile") == 0) {
+               options.profile = true;
+               if (i + 1 < argc && strncmp(argv[i + 1], "--", 2) != 0) { // The CSV path is optional
+                    options.profileCsv = argv[++i];
+               }
+          }
+          else {
+               std::cout << "WARNING::OPTIONS::UNKNOWN_ARGUMENT " << arg << std::endl;
+          }
+     }
+
+     // Reloading only makes sense for files on disk
+     if (options.hotReload && options.shaderDir.empty()) {
+          options.shaderDir = ".";
+     }
+     // The reloader calls GL from its own thread, and a lazy entry point overwrites its global pointer on the first call without a lock
+          // Two threads taking that first call together is a data race, so reloading loads everything up front
+     if (options.hotReload && options.lazyGL) {
+          std::cout << "WARNING::OPTIONS::LAZY_GL_WITH_HOT_RELOAD --lazy-gl isn't thread safe, loading GL functions up front" << std::endl;
+          options.lazyGL = false;
+     }
+
+     return options;
+}
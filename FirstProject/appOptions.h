@@ -0,0 +1,46 @@
+#ifndef APP_OPTIONS_H
+#define APP_OPTIONS_H
+
+#include <string>
+#include <vector>
+
+// Everything that can be changed from the command line lives here so main() only has to check flags
+struct AppOptions {
+     bool benchExtensions = false; // --bench-extensions : time extension lookups and exit
+     bool lazyGL = false;          // --lazy-gl : resolve GL functions on their first call instead of all at startup, single threaded only so --hot-reload turns it off
+     bool legacyGL = false;        // --legacy-gl : use the 3.3 bind-to-edit path even when DSA is available
+     bool splitVertices = false;   // --split-vertices : store each vertex attribute in its own run instead of interleaved
+     bool compactVertices = false; // --compact-vertices : quantize positions to 16 bit and colors to 8 bit before uploading
+     int instances = 0;            // --instances N : draw N copies of the triangle with one instanced draw
+     bool multiDraw = false;       // --multi-draw : draw from a MeshPool with glMultiDrawElementsIndirect, gl_DrawID picks each draw's data
+     int particles = 0;            // --particles N : N small triangles rebuilt every frame in a persistently mapped stream buffer
+     std::string loadDir;          // --load DIR : stream every .obj in DIR in the background and draw them on a grid as they become ready
+     int uploadBudgetKB = 1024;    // --upload-budget KB : most mesh data --load (and pixel data --texture) uploads in one frame
+     bool lod = false;             // --lod : build a LOD chain for each --load mesh and draw the level its size on screen needs
+     std::vector<std::string> textures; // --texture FILE (repeatable) : decode a PNG or JPEG in the background and draw it on a quad once it's uploaded
+
+     // Headless runs draw into an FBO with no visible window, as fast as they can
+     bool headless = false;        // --headless
+     int frames = 100;             // --frames N : how many frames a headless run draws
+     int width = 800;              // --size WxH : framebuffer size for headless runs
+     int height = 600;
+     std::string dumpPath;         // --dump file.ppm : write the last headless frame out
+
+     bool profile = false;         // --profile [file.csv] : time each part of the frame, optionally writing every frame to a CSV
+     std::string profileCsv;
+
+     std::string shaderCacheDir = "shaderCache"; // --shader-cache DIR, --no-shader-cache : where linked program binaries are kept
+     bool hotReload = false;       // --hot-reload : recompile the shader files when they change on disk
+
+     // --shader-dir DIR : read shader files from DIR before falling back to the embedded copies, --embedded-shaders : never read them from disk
+          // Debug builds look in the working directory by default so shader edits show up without a rebuild
+#ifdef _DEBUG
+     std::string shaderDir = ".";
+#else
+     std::string shaderDir;
+#endif
+};
+
+AppOptions parseOptions(int argc, char* argv[]);
+
+#endif
@@ -0,0 +1,63 @@
+#include "embeddedShaders.h"
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+// Written by ShaderEmbed into the intermediate folder before anything compiles, see FirstProject.vcxproj
+#include "embeddedShaderData.h"
+
+static std::string overrideDirectory;
+
+const EmbeddedShader* findEmbeddedShader(const std::string& name) {
+     for (int i = 0; i < embeddedShaderCount; i++) {
+          if (name == embeddedShaderTable[i].name) {
+               return &embeddedShaderTable[i];
+          }
+     }
+     return NULL;
+}
+
+void setShaderOverrideDirectory(const std::string& directory) {
+     overrideDirectory = directory;
+}
+
+const std::string& shaderOverrideDirectory() {
+     return overrideDirectory;
+}
+
+static bool readFile(const std::string& path, std::string& source) {
+     std::ifstream file(path, std::ios::binary);
+     if (!file) {
+          return false;
+     }
+     std::stringstream stream;
+     stream << file.rdbuf();
+     source = stream.str();
+     return true;
+}
+
+bool loadShaderSource(const std::string& name, std::string& source, uint64_t& hash, std::string& path) {
+     if (!overrideDirectory.empty()) {
+          path = overrideDirectory + "/" + name;
+          if (readFile(path, source)) {
+               hash = hashShaderSource(source.data(), source.size());
+               return true;
+          }
+     }
+
+     const EmbeddedShader* embedded = findEmbeddedShader(name);
+     if (embedded != NULL) {
+          source.assign(embedded->source, embedded->length);
+          hash = embedded->hash;
+          path.clear();
+          return true;
+     }
+
+     path = name;
+     if (readFile(path, source)) {
+          hash = hashShaderSource(source.data(), source.size());
+          return true;
+     }
+     std::cout << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ " << name << std::endl;
+     return false;
+}
@@ -0,0 +1,38 @@
+#ifndef EMBEDDED_SHADERS_H
+#define EMBEDDED_SHADERS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// FNV-1a 64 over a shader's text, constexpr so embedded shaders get theirs from the compiler
+constexpr uint64_t hashShaderSource(const char* text, size_t length) {
+     uint64_t hash = 14695981039346656037ull;
+     for (size_t i = 0; i < length; i++) {
+          hash ^= (uint8_t)text[i];
+          hash *= 1099511628211ull;
+     }
+     return hash;
+}
+
+// A shader file compiled into the binary by the ShaderEmbed build step (every *.txt next to the project)
+struct EmbeddedShader {
+     const char* name;
+     const char* source;
+     size_t length;
+     uint64_t hash;
+};
+
+// NULL when there's no embedded shader with that file name
+const EmbeddedShader* findEmbeddedShader(const std::string& name);
+
+// Files in this folder win over the embedded copies, so shaders can be edited without rebuilding
+     // Empty means embedded only, which needs no file I/O at all
+void setShaderOverrideDirectory(const std::string& directory);
+const std::string& shaderOverrideDirectory();
+
+// Where a shader's text comes from: the override folder, then the embedded copy, then the working directory
+     // path is set to the file that was read, or left empty for an embedded shader
+bool loadShaderSource(const std::string& name, std::string& source, uint64_t& hash, std::string& path);
+
+#endif
@@ -0,0 +1,61 @@
+#include <glad/glad.h>
+#include "extensionBenchmark.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstring>
+
+// This is what has_ext() in glad.c used to do; kept here only so there is something to compare against
+static bool linearHasExtension(const char* ext) {
+     int count = gladGetExtensionCount();
+     for (int i = 0; i < count; i++) {
+          if (strcmp(gladGetExtension(i), ext) == 0) {
+               return true;
+          }
+     }
+     return false;
+}
+
+void runExtensionBenchmark(int rounds) {
+     // Query every extension the driver has plus a few it doesn't, since misses are the worst case for the linear scan
+     std::vector<std::string> queries;
+     int count = gladGetExtensionCount();
+     for (int i = 0; i < count; i++) {
+          queries.push_back(gladGetExtension(i));
+     }
+     queries.push_back("GL_FIRSTPROJECT_missing_extension");
+     queries.push_back("GL_ARB_not_a_real_extension");
+     queries.push_back("GL_KHR_does_not_exist");
+     queries.push_back("GL_EXT_nope");
+
+     // The hit counts are printed so the compiler can't throw the loops away
+     int linearHits = 0;
+     auto linearStart = std::chrono::steady_clock::now();
+     for (int round = 0; round < rounds; round++) {
+          for (const std::string& query : queries) {
+               linearHits += linearHasExtension(query.c_str());
+          }
+     }
+     auto linearEnd = std::chrono::steady_clock::now();
+
+     int hashedHits = 0;
+     auto hashedStart = std::chrono::steady_clock::now();
+     for (int round = 0; round < rounds; round++) {
+          for (const std::string& query : queries) {
+               hashedHits += gladHasExtension(query.c_str());
+          }
+     }
+     auto hashedEnd = std::chrono::steady_clock::now();
+
+     double lookups = (double)rounds * (double)queries.size();
+     double linearNs = std::chrono::duration<double, std::nano>(linearEnd - linearStart).count() / lookups;
+     double hashedNs = std::chrono::duration<double, std::nano>(hashedEnd - hashedStart).count() / lookups;
+
+     std::cout << "Extension lookup benchmark: " << count << " extensions, " << (long long)lookups << " lookups each" << std::endl;
+     std::cout << "     linear strcmp : " << linearNs << " ns/lookup (" << linearHits << " hits)" << std::endl;
+     std::cout << "     hash set      : " << hashedNs << " ns/lookup (" << hashedHits << " hits)" << std::endl;
+     if (linearHits != hashedHits) {
+          std::cout << "ERROR::BENCHMARK::EXTENSIONS::RESULTS_DIFFER" << std::endl;
+     }
+}
@@ -0,0 +1,8 @@
+#ifndef EXTENSION_BENCHMARK_H
+#define EXTENSION_BENCHMARK_H
+
+// Times extension lookups with the old linear strcmp scan and with glad's hash set
+// Needs a current context and gladLoadGLLoader() to have run
+void runExtensionBenchmark(int rounds);
+
+#endif
@@ -0,0 +1,109 @@
+#include "fileWatcher.h"
+#include <filesystem>
+#include <iostream>
+#include <thread>
+#include <chrono>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+static long long lastWriteTime(const std::string& path) {
+     std::error_code error;
+     auto time = std::filesystem::last_write_time(path, error);
+     return error ? 0 : (long long)time.time_since_epoch().count();
+}
+
+FileWatcher::FileWatcher() {
+#ifdef __linux__
+     inotifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+     if (inotifyFD == -1) {
+          std::cout << "WARNING::FILE_WATCHER::INOTIFY_UNAVAILABLE, polling modification times instead" << std::endl;
+     }
+#endif
+}
+
+FileWatcher::~FileWatcher() {
+#ifdef __linux__
+     if (inotifyFD != -1) {
+          close(inotifyFD);
+     }
+#endif
+}
+
+bool FileWatcher::watch(const std::string& path) {
+     for (const Watched& file : files) {
+          if (file.path == path) {
+               return true;
+          }
+     }
+     std::filesystem::path filePath(path);
+     Watched file;
+     file.path = path;
+     file.directory = filePath.has_parent_path() ? filePath.parent_path().string() : ".";
+     file.name = filePath.filename().string();
+     file.lastWrite = lastWriteTime(path);
+
+#ifdef __linux__
+     if (inotifyFD != -1) {
+          // Several files in one folder end up with the same descriptor, inotify hands back the existing one
+          file.watchDescriptor = inotify_add_watch(inotifyFD, file.directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+          if (file.watchDescriptor == -1) {
+               std::cout << "ERROR::FILE_WATCHER::WATCH_FAILED " << path << std::endl;
+               return false;
+          }
+     }
+#endif
+     files.push_back(file);
+     return true;
+}
+
+std::vector<std::string> FileWatcher::wait(int timeoutMs) {
+     std::vector<std::string> changed;
+     auto markChanged = [&](const Watched& file) {
+          for (const std::string& path : changed) {
+               if (path == file.path) {
+                    return;
+               }
+          }
+          changed.push_back(file.path);
+     };
+
+#ifdef __linux__
+     if (inotifyFD != -1) {
+          pollfd pollFD = { inotifyFD, POLLIN, 0 };
+          if (poll(&pollFD, 1, timeoutMs) <= 0) {
+               return changed;
+          }
+
+          alignas(inotify_event) char buffer[4096];
+          ssize_t length;
+          while ((length = read(inotifyFD, buffer, sizeof(buffer))) > 0) {
+               for (char* at = buffer; at < buffer + length;) {
+                    const inotify_event* event = (const inotify_event*)at;
+                    if (event->len > 0) {
+                         for (const Watched& file : files) {
+                              if (file.watchDescriptor == event->wd && file.name == event->name) {
+                                   markChanged(file);
+                              }
+                         }
+                    }
+                    at += sizeof(inotify_event) + event->len;
+               }
+          }
+          return changed;
+     }
+#endif
+
+     std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+     for (Watched& file : files) {
+          long long lastWrite = lastWriteTime(file.path);
+          if (lastWrite != file.lastWrite) {
+               file.lastWrite = lastWrite;
+               markChanged(file);
+          }
+     }
+     return changed;
+}
@@ -0,0 +1,36 @@
+#ifndef FILE_WATCHER_H
+#define FILE_WATCHER_H
+
+#include <string>
+#include <vector>
+
+// Tells you when files on disk change
+     // On Linux this is inotify on the folders holding the files, so editors that save by writing a new file and renaming it over the old one are still caught
+     // Everywhere else it falls back to comparing modification times each time wait() is called
+class FileWatcher {
+public:
+     FileWatcher();
+     ~FileWatcher();
+     FileWatcher(const FileWatcher&) = delete;
+     FileWatcher& operator=(const FileWatcher&) = delete;
+
+     // Watching a path twice is fine, it's only reported once
+     bool watch(const std::string& path);
+
+     // Waits up to timeoutMs for changes and returns the watched paths (as they were given to watch()) that changed
+     std::vector<std::string> wait(int timeoutMs);
+
+private:
+     struct Watched {
+          std::string path;
+          std::string directory;
+          std::string name;
+          int watchDescriptor = -1;
+          long long lastWrite = 0;
+     };
+
+     std::vector<Watched> files;
+     int inotifyFD = -1;
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include "frameFences.h"
+#include <cstddef>
+
+bool FrameFences::advance(bool wait) {
+     current = (current + 1) % regions;
+     GLsync& fence = fences[current];
+     if (fence == NULL) {
+          return true;
+     }
+     // Asking with no timeout first keeps the usual case (GPU already done) from counting as a stall
+     GLenum status = glClientWaitSync(fence, 0, 0);
+     if (status == GL_TIMEOUT_EXPIRED) {
+          stallCount++;
+          if (!wait) {
+               return false;
+          }
+          do {
+               status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+          } while (status == GL_TIMEOUT_EXPIRED);
+     }
+     glDeleteSync(fence);
+     fence = NULL;
+     return true;
+}
+
+void FrameFences::fence() {
+     if (fences[current] != NULL) {
+          glDeleteSync(fences[current]); // Only when the region was fenced twice in one frame, the later fence covers both
+     }
+     fences[current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void FrameFences::release() {
+     for (GLsync& fence : fences) {
+          if (fence != NULL) {
+               glDeleteSync(fence);
+               fence = NULL;
+          }
+     }
+}
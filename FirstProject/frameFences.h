@@ -0,0 +1,29 @@
+#ifndef FRAME_FENCES_H
+#define FRAME_FENCES_H
+
+#include <glad/glad.h>
+
+// The fences for a buffer split into a region per frame in flight (UniformRing, StreamBuffer, MeshLoader, TextureManager)
+     // advance() moves to the next region and checks that the GPU is done with what was last issued from it
+     // fence() marks the commands issued so far as the last ones that read the current region
+// A region that was never fenced is always free, so a buffer that doesn't need fencing can still use this to count regions
+class FrameFences {
+public:
+     static const int regions = 3;
+
+     // wait : block until the region is free, otherwise return false right away while the GPU still reads it (the region is skipped)
+     bool advance(bool wait);
+     void fence();
+     void release();
+
+     int region() const { return current; }
+     // Times advance() found its region still in use, whether it then waited or gave up
+     long long stalls() const { return stallCount; }
+
+private:
+     int current = 0;
+     GLsync fences[regions] = {};
+     long long stallCount = 0;
+};
+
+#endif
@@ -0,0 +1,179 @@
+#include <glad/glad.h>
+#include "frameProfiler.h"
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+
+void FrameProfiler::Samples::add(double value) {
+     if ((int)values.size() < sampleWindow) {
+          values.push_back(value);
+     }
+     else {
+          values[next] = value;
+     }
+     next = (next + 1) % sampleWindow;
+}
+
+double FrameProfiler::Samples::percentile(double p) const {
+     if (values.empty()) {
+          return 0.0;
+     }
+     std::vector<double> sorted = values;
+     size_t index = (size_t)(p * (sorted.size() - 1) + 0.5);
+     std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+     return sorted[index];
+}
+
+bool FrameProfiler::init(const std::string& csvPath) {
+     for (int i = 0; i < querySets; i++) {
+          glGenQueries(maxScopes * 2, &slots[i].queries[0][0]);
+     }
+     if (!csvPath.empty()) {
+          csv.open(csvPath);
+          if (!csv) {
+               std::cout << "ERROR::PROFILER::CSV_NOT_OPENED " << csvPath << std::endl;
+          }
+     }
+     active = true;
+     return true;
+}
+
+void FrameProfiler::shutdown() {
+     if (!active) {
+          return;
+     }
+     // Nothing is waiting on the frame anymore, so it's fine to block for the last results
+     for (int i = 0; i < querySets; i++) {
+          int slot = (int)((frame + i) % querySets); // Oldest first so the CSV stays in order
+          if (slots[slot].pending) {
+               collect(slots[slot], true);
+          }
+     }
+     for (int i = 0; i < querySets; i++) {
+          glDeleteQueries(maxScopes * 2, &slots[i].queries[0][0]);
+     }
+     csv.close();
+     active = false;
+}
+
+int FrameProfiler::addScope(const char* name) {
+     if ((int)scopes.size() >= maxScopes) {
+          std::cout << "ERROR::PROFILER::TOO_MANY_SCOPES " << name << std::endl;
+          return maxScopes - 1;
+     }
+     Scope scope;
+     scope.name = name;
+     scopes.push_back(scope);
+     return (int)scopes.size() - 1;
+}
+
+void FrameProfiler::beginFrame() {
+     if (!active) {
+          return;
+     }
+     FrameSlot& slot = slots[frame % querySets];
+     if (slot.pending) {
+          collect(slot, false);
+     }
+     slot.frame = frame;
+     std::fill(slot.used, slot.used + maxScopes, false);
+}
+
+void FrameProfiler::beginScope(int scope) {
+     if (!active) {
+          return;
+     }
+     FrameSlot& slot = slots[frame % querySets];
+     glQueryCounter(slot.queries[scope][0], GL_TIMESTAMP);
+     cpuStart[scope] = std::chrono::steady_clock::now();
+}
+
+void FrameProfiler::endScope(int scope) {
+     if (!active) {
+          return;
+     }
+     FrameSlot& slot = slots[frame % querySets];
+     slot.cpuMs[scope] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - cpuStart[scope]).count();
+     glQueryCounter(slot.queries[scope][1], GL_TIMESTAMP);
+     slot.used[scope] = true;
+}
+
+void FrameProfiler::endFrame() {
+     if (!active) {
+          return;
+     }
+     slots[frame % querySets].pending = true;
+     frame++;
+}
+
+void FrameProfiler::collect(FrameSlot& slot, bool wait) {
+     if (csv && !csvHeaderWritten) {
+          csv << "frame";
+          for (const Scope& scope : scopes) {
+               csv << "," << scope.name << "_cpu_ms," << scope.name << "_gpu_ms";
+          }
+          csv << "\n";
+          csvHeaderWritten = true;
+     }
+     if (csv) {
+          csv << slot.frame;
+     }
+
+     for (int i = 0; i < (int)scopes.size(); i++) {
+          if (!slot.used[i]) {
+               if (csv) {
+                    csv << ",,";
+               }
+               continue;
+          }
+
+          double gpuMs = -1.0;
+          GLint available = GL_TRUE;
+          if (!wait) {
+               // Two frames is almost always enough, if it isn't the sample gets dropped instead of stalling
+               glGetQueryObjectiv(slot.queries[i][1], GL_QUERY_RESULT_AVAILABLE, &available);
+          }
+          if (available) {
+               GLuint64 begin = 0, end = 0;
+               glGetQueryObjectui64v(slot.queries[i][0], GL_QUERY_RESULT, &begin);
+               glGetQueryObjectui64v(slot.queries[i][1], GL_QUERY_RESULT, &end);
+               gpuMs = (double)(end - begin) / 1000000.0;
+               scopes[i].gpu.add(gpuMs);
+          }
+          else {
+               gpuDropped++;
+          }
+          scopes[i].cpu.add(slot.cpuMs[i]);
+
+          if (csv) {
+               csv << "," << slot.cpuMs[i] << ",";
+               if (gpuMs >= 0.0) {
+                    csv << gpuMs;
+               }
+          }
+     }
+     if (csv) {
+          csv << "\n";
+     }
+     slot.pending = false;
+}
+
+void FrameProfiler::printSummary() const {
+     if (frame == 0) { // Never profiled anything
+          return;
+     }
+     std::cout << "Frame profile, last " << sampleWindow << " frames (ms), p50 / p95 / p99" << std::endl;
+     std::cout << std::fixed << std::setprecision(3);
+     for (const Scope& scope : scopes) {
+          if (scope.cpu.values.empty()) { // e.g. swap in a headless run
+               continue;
+          }
+          std::cout << "     " << std::left << std::setw(8) << scope.name << std::right
+               << " cpu " << scope.cpu.percentile(0.50) << " / " << scope.cpu.percentile(0.95) << " / " << scope.cpu.percentile(0.99)
+               << "   gpu " << scope.gpu.percentile(0.50) << " / " << scope.gpu.percentile(0.95) << " / " << scope.gpu.percentile(0.99) << std::endl;
+     }
+     if (gpuDropped > 0) {
+          std::cout << "     " << gpuDropped << " GPU samples weren't ready in time and were dropped" << std::endl;
+     }
+     std::cout << std::defaultfloat;
+}
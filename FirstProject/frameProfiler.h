@@ -0,0 +1,81 @@
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// CPU and GPU time for named parts of a frame
+     // CPU time comes from steady_clock
+     // GPU time comes from a pair of glQueryCounter timestamps per scope
+// Query results are read two frames late (one set is being filled while the other is read), so reading them never waits on the GPU
+class FrameProfiler {
+public:
+     static const int maxScopes = 16;
+     static const int querySets = 2;
+     static const int sampleWindow = 512; // How many frames the rolling percentiles look at
+
+     // Nothing is measured until this is called, so a disabled profiler costs one branch per scope
+     // csvPath can be empty to skip the per frame CSV
+     bool init(const std::string& csvPath);
+     void shutdown();
+     bool enabled() const { return active; }
+
+     int addScope(const char* name);
+
+     void beginFrame();
+     void beginScope(int scope);
+     void endScope(int scope);
+     void endFrame();
+
+     // p50/p95/p99 of the last sampleWindow frames for every scope, call after shutdown() to include the last frames
+     void printSummary() const;
+     double cpuPercentile(int scope, double p) const { return scopes[scope].cpu.percentile(p); }
+     double gpuPercentile(int scope, double p) const { return scopes[scope].gpu.percentile(p); }
+
+private:
+     struct Samples {
+          std::vector<double> values;
+          int next = 0;
+          void add(double value);
+          double percentile(double p) const;
+     };
+
+     struct Scope {
+          std::string name;
+          Samples cpu;
+          Samples gpu;
+     };
+
+     struct FrameSlot {
+          long long frame = -1;
+          bool pending = false;
+          bool used[maxScopes] = {};
+          double cpuMs[maxScopes] = {};
+          unsigned int queries[maxScopes][2] = {}; // begin and end timestamps
+     };
+
+     void collect(FrameSlot& slot, bool wait);
+
+     bool active = false;
+     std::vector<Scope> scopes;
+     FrameSlot slots[querySets];
+     std::chrono::steady_clock::time_point cpuStart[maxScopes];
+     long long frame = 0;
+     long long gpuDropped = 0;
+     std::ofstream csv;
+     bool csvHeaderWritten = false;
+};
+
+// Begins a scope when made and ends it when it goes out of scope
+class ProfileScope {
+public:
+     ProfileScope(FrameProfiler& profiler, int scope) : profiler(profiler), scope(scope) { profiler.beginScope(scope); }
+     ~ProfileScope() { profiler.endScope(scope); }
+private:
+     FrameProfiler& profiler;
+     int scope;
+};
+
+#endif
@@ -0,0 +1,285 @@
+#include "glState.h"
+#include <cstring>
+#include <iostream>
+
+GLStateCache glState;
+
+// Generic binding points that get shadowed, in slot order
+static const GLenum bufferTargets[8] = {
+     GL_ARRAY_BUFFER, GL_UNIFORM_BUFFER, GL_SHADER_STORAGE_BUFFER, GL_DRAW_INDIRECT_BUFFER,
+     GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER, GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER
+};
+static const GLenum textureTargets[4] = { GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY, GL_TEXTURE_CUBE_MAP, GL_TEXTURE_3D };
+static const GLenum capabilityList[6] = { GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE, GL_SCISSOR_TEST, GL_STENCIL_TEST, GL_FRAMEBUFFER_SRGB };
+
+bool GLStateCache::Rect::operator==(const Rect& other) const {
+     return memcmp(values, other.values, sizeof(values)) == 0;
+}
+
+bool GLStateCache::Color::operator==(const Color& other) const {
+     return memcmp(values, other.values, sizeof(values)) == 0;
+}
+
+template <typename T>
+bool GLStateCache::change(Shadowed<T>& shadow, const T& value) {
+     if (shadow.known && shadow.value == value) {
+          counters.elided++;
+          return false;
+     }
+     shadow.value = value;
+     shadow.known = true;
+     counters.issued++;
+     return true;
+}
+
+int GLStateCache::bufferSlot(GLenum target) const {
+     for (int i = 0; i < 8; i++) {
+          if (bufferTargets[i] == target) {
+               return i;
+          }
+     }
+     return -1;
+}
+
+int GLStateCache::textureSlot(GLenum target) const {
+     for (int i = 0; i < 4; i++) {
+          if (textureTargets[i] == target) {
+               return i;
+          }
+     }
+     return -1;
+}
+
+int GLStateCache::capabilitySlot(GLenum capability) const {
+     for (int i = 0; i < 6; i++) {
+          if (capabilityList[i] == capability) {
+               return i;
+          }
+     }
+     return -1;
+}
+
+void GLStateCache::reset() {
+     Counters kept = counters;
+     *this = GLStateCache();
+     counters = kept;
+}
+
+void GLStateCache::useProgram(unsigned int ID) {
+     if (change(program, ID)) {
+          glUseProgram(ID);
+     }
+}
+
+void GLStateCache::bindVertexArray(unsigned int VAO) {
+     if (change(vertexArray, VAO)) {
+          glBindVertexArray(VAO);
+     }
+}
+
+void GLStateCache::bindBuffer(GLenum target, unsigned int buffer) {
+     int slot = bufferSlot(target);
+     if (slot == -1) {
+          counters.issued++;
+          glBindBuffer(target, buffer);
+          return;
+     }
+     if (change(buffers[slot], buffer)) {
+          glBindBuffer(target, buffer);
+     }
+}
+
+void GLStateCache::bindBufferRange(GLenum target, GLuint index, unsigned int buffer, GLintptr offset, GLsizeiptr size) {
+     Shadowed<BufferRange>* ranges = target == GL_UNIFORM_BUFFER ? uniformRanges : target == GL_SHADER_STORAGE_BUFFER ? storageRanges : NULL;
+     BufferRange range;
+     range.buffer = buffer;
+     range.offset = offset;
+     range.size = size;
+     if (ranges == NULL || index >= (GLuint)maxIndexedBuffers) {
+          counters.issued++;
+          glBindBufferRange(target, index, buffer, offset, size);
+     }
+     else if (change(ranges[index], range)) {
+          glBindBufferRange(target, index, buffer, offset, size);
+     }
+     else {
+          return; // Elided, so the generic binding didn't move either
+     }
+
+     int slot = bufferSlot(target);
+     if (slot != -1) {
+          buffers[slot].value = buffer;
+          buffers[slot].known = true;
+     }
+}
+
+void GLStateCache::activeTexture(int unit) {
+     if (change(activeUnit, unit)) {
+          glActiveTexture(GL_TEXTURE0 + unit);
+     }
+}
+
+void GLStateCache::bindTexture(int unit, GLenum target, unsigned int texture) {
+     int slot = textureSlot(target);
+     if (slot == -1 || unit < 0 || unit >= maxTextureUnits) {
+          activeTexture(unit);
+          counters.issued++;
+          glBindTexture(target, texture);
+          return;
+     }
+     Shadowed<unsigned int>& bound = textures[unit][slot];
+     if (bound.known && bound.value == texture) {
+          counters.elided++;
+          return;
+     }
+     activeTexture(unit);
+     change(bound, texture);
+     glBindTexture(target, texture);
+}
+
+void GLStateCache::bindFramebuffer(GLenum target, unsigned int FBO) {
+     if (target == GL_FRAMEBUFFER) {
+          if (drawFramebuffer.known && readFramebuffer.known && drawFramebuffer.value == FBO && readFramebuffer.value == FBO) {
+               counters.elided++;
+               return;
+          }
+          drawFramebuffer.value = readFramebuffer.value = FBO;
+          drawFramebuffer.known = readFramebuffer.known = true;
+          counters.issued++;
+          glBindFramebuffer(target, FBO);
+          return;
+     }
+     if (change(target == GL_READ_FRAMEBUFFER ? readFramebuffer : drawFramebuffer, FBO)) {
+          glBindFramebuffer(target, FBO);
+     }
+}
+
+void GLStateCache::clearColor(float red, float green, float blue, float alpha) {
+     Color color;
+     color.values[0] = red;
+     color.values[1] = green;
+     color.values[2] = blue;
+     color.values[3] = alpha;
+     if (change(clear, color)) {
+          glClearColor(red, green, blue, alpha);
+     }
+}
+
+void GLStateCache::viewport(int x, int y, int width, int height) {
+     Rect rect;
+     rect.values[0] = x;
+     rect.values[1] = y;
+     rect.values[2] = width;
+     rect.values[3] = height;
+     if (change(view, rect)) {
+          glViewport(x, y, width, height);
+     }
+}
+
+void GLStateCache::enable(GLenum capability, bool enabled) {
+     int slot = capabilitySlot(capability);
+     if (slot != -1 && !change(capabilities[slot], enabled)) {
+          return;
+     }
+     if (slot == -1) {
+          counters.issued++;
+     }
+     if (enabled) {
+          glEnable(capability);
+     }
+     else {
+          glDisable(capability);
+     }
+}
+
+void GLStateCache::blendFunc(GLenum source, GLenum destination) {
+     BlendFunc func;
+     func.source = source;
+     func.destination = destination;
+     if (change(blend, func)) {
+          glBlendFunc(source, destination);
+     }
+}
+
+void GLStateCache::depthFunc(GLenum function) {
+     if (change(depth, function)) {
+          glDepthFunc(function);
+     }
+}
+
+void GLStateCache::depthMask(bool write) {
+     if (change(depthWrite, write)) {
+          glDepthMask(write ? GL_TRUE : GL_FALSE);
+     }
+}
+
+void GLStateCache::forgetProgram(unsigned int ID) {
+     if (program.value == ID) {
+          program.known = false;
+     }
+}
+
+void GLStateCache::forgetVertexArray(unsigned int VAO) {
+     if (vertexArray.value == VAO) {
+          vertexArray.known = false;
+     }
+}
+
+void GLStateCache::forgetBuffer(unsigned int buffer) {
+     for (Shadowed<unsigned int>& bound : buffers) {
+          if (bound.value == buffer) {
+               bound.known = false;
+          }
+     }
+     for (int i = 0; i < maxIndexedBuffers; i++) {
+          if (uniformRanges[i].value.buffer == buffer) {
+               uniformRanges[i].known = false;
+          }
+          if (storageRanges[i].value.buffer == buffer) {
+               storageRanges[i].known = false;
+          }
+     }
+}
+
+void GLStateCache::forgetTexture(unsigned int texture) {
+     for (auto& unit : textures) {
+          for (Shadowed<unsigned int>& bound : unit) {
+               if (bound.value == texture) {
+                    bound.known = false;
+               }
+          }
+     }
+}
+
+void GLStateCache::forgetFramebuffer(unsigned int FBO) {
+     if (drawFramebuffer.value == FBO) {
+          drawFramebuffer.known = false;
+     }
+     if (readFramebuffer.value == FBO) {
+          readFramebuffer.known = false;
+     }
+}
+
+void GLStateCache::endFrame() {
+     if (counters.frames == 0) {
+          // Everything up to the end of the first frame is setup, creating objects and the first time each state is set
+          counters.setupIssued = counters.issued;
+          counters.setupElided = counters.elided;
+     }
+     else {
+          counters.totalIssued += counters.issued;
+          counters.totalElided += counters.elided;
+     }
+     counters.frames++;
+     counters.issued = 0;
+     counters.elided = 0;
+}
+
+void GLStateCache::printStats() const {
+     std::cout << "GL state cache: " << counters.setupIssued << " calls issued during setup (" << counters.setupElided << " elided)";
+     if (counters.frames > 1) {
+          double counted = (double)(counters.frames - 1);
+          std::cout << ", then per frame " << counters.totalIssued / counted << " issued, " << counters.totalElided / counted << " elided";
+     }
+     std::cout << std::endl;
+}
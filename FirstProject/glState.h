@@ -0,0 +1,121 @@
+#ifndef GL_STATE_H
+#define GL_STATE_H
+
+#include <glad/glad.h>
+
+// A shadow copy of the GL state the app touches, sitting between the app and GL
+     // Every call compares against what's already set and only reaches the driver when something actually changes
+     // Anything not shadowed here can still be called directly, but then the cache has to be told (reset(), or the forget calls)
+// Only tracks the main context, other contexts (like the shader reloader's) have their own state and call GL directly
+class GLStateCache {
+public:
+     static const int maxTextureUnits = 32;
+     static const int maxIndexedBuffers = 16;
+
+     // Forgets everything so the next call of each kind is always issued, use after creating a context
+     void reset();
+
+     void useProgram(unsigned int program);
+     void bindVertexArray(unsigned int VAO);
+     // The element array binding belongs to the VAO, so it's always issued
+     void bindBuffer(GLenum target, unsigned int buffer);
+     // Also changes the generic binding of the target, like GL does
+     void bindBufferRange(GLenum target, GLuint index, unsigned int buffer, GLintptr offset, GLsizeiptr size);
+     void bindTexture(int unit, GLenum target, unsigned int texture);
+     void bindFramebuffer(GLenum target, unsigned int FBO);
+
+     void clearColor(float red, float green, float blue, float alpha);
+     void viewport(int x, int y, int width, int height);
+     // GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE, GL_SCISSOR_TEST, GL_STENCIL_TEST and GL_FRAMEBUFFER_SRGB are shadowed, anything else is passed through
+     void enable(GLenum capability, bool enabled);
+     void blendFunc(GLenum source, GLenum destination);
+     void depthFunc(GLenum function);
+     void depthMask(bool write);
+
+     // Deleting an object unbinds it in GL, and its name can be handed out again right after
+          // Call these when deleting so a new object with a recycled name isn't mistaken for one that's already bound
+     void forgetProgram(unsigned int program);
+     void forgetVertexArray(unsigned int VAO);
+     void forgetBuffer(unsigned int buffer);
+     void forgetTexture(unsigned int texture);
+     void forgetFramebuffer(unsigned int FBO);
+
+     // Issued/elided counts are per frame from here, setup work before the first frame is counted separately
+     void endFrame();
+     void printStats() const;
+
+     long long frameIssued() const { return counters.issued; }
+     long long frameElided() const { return counters.elided; }
+     // Last viewport set through the cache, so sizes on screen can be worked out without a glGet
+     int viewportHeight() const { return view.value.values[3]; }
+
+private:
+     template <typename T>
+     struct Shadowed {
+          T value{};
+          bool known = false;
+     };
+
+     // Updates the shadow and counts the call, true when it has to go to GL
+     template <typename T>
+     bool change(Shadowed<T>& shadow, const T& value);
+
+     struct BufferRange {
+          unsigned int buffer = 0;
+          GLintptr offset = 0;
+          GLsizeiptr size = 0;
+          bool operator==(const BufferRange& other) const { return buffer == other.buffer && offset == other.offset && size == other.size; }
+     };
+
+     struct Rect {
+          int values[4] = {};
+          bool operator==(const Rect& other) const;
+     };
+
+     struct Color {
+          float values[4] = {};
+          bool operator==(const Color& other) const;
+     };
+
+     struct BlendFunc {
+          GLenum source = 0;
+          GLenum destination = 0;
+          bool operator==(const BlendFunc& other) const { return source == other.source && destination == other.destination; }
+     };
+
+     int bufferSlot(GLenum target) const;
+     int textureSlot(GLenum target) const;
+     int capabilitySlot(GLenum capability) const;
+     void activeTexture(int unit);
+
+     Shadowed<unsigned int> program;
+     Shadowed<unsigned int> vertexArray;
+     Shadowed<unsigned int> buffers[8];
+     Shadowed<BufferRange> uniformRanges[maxIndexedBuffers];
+     Shadowed<BufferRange> storageRanges[maxIndexedBuffers];
+     Shadowed<int> activeUnit;
+     Shadowed<unsigned int> textures[maxTextureUnits][4];
+     Shadowed<unsigned int> drawFramebuffer;
+     Shadowed<unsigned int> readFramebuffer;
+     Shadowed<Color> clear;
+     Shadowed<Rect> view;
+     Shadowed<bool> capabilities[6];
+     Shadowed<BlendFunc> blend;
+     Shadowed<GLenum> depth;
+     Shadowed<bool> depthWrite;
+
+     // Kept apart so reset() can throw away the shadows and keep these
+     struct Counters {
+          long long issued = 0;
+          long long elided = 0;
+          long long setupIssued = 0;
+          long long setupElided = 0;
+          long long totalIssued = 0;
+          long long totalElided = 0;
+          long long frames = 0;
+     } counters;
+};
+
+extern GLStateCache glState;
+
+#endif
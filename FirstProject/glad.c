@@ -4,19 +4,25 @@
 
     Language/Generator: C/C++
     Specification: gl
-    APIs: gl=3.3
+    APIs: gl=4.6
     Profile: core
     Extensions:
-        
+        GL_KHR_parallel_shader_compile
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="core" --api="gl=4.6" --generator="c" --spec="gl" --extensions="GL_KHR_parallel_shader_compile"
     Online:
-        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D4.6&extensions=GL_KHR_parallel_shader_compile
+
+    Local changes:
+        Extension names are copied into one arena and hashed, and are kept after
+        loading so they can be queried with gladHasExtension() at runtime.
+        gladLoadGLLoaderLazy() resolves each function on its first call instead
+        of up front.
 */
 
 #include <stdio.h>
@@ -167,94 +173,181 @@ static int max_loaded_minor;
 
 static const char *exts = NULL;
 static int num_exts_i = 0;
-static char **exts_i = NULL;
+static const char **exts_i = NULL;
+
+/* Every extension name is copied back to back into one arena allocation and
+ * indexed by an open addressing hash set. Both are built once per load and
+ * kept afterwards so gladHasExtension() stays cheap at runtime. */
+static char *exts_arena = NULL;
+static int *exts_hash = NULL;
+static unsigned int exts_hash_mask = 0;
+
+static unsigned int hash_ext(const char *str, size_t len) {
+    /* FNV-1a */
+    unsigned int hash = 2166136261u;
+    size_t index;
+    for(index = 0; index < len; index++) {
+        hash ^= (unsigned char)str[index];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void free_exts(void) {
+    free((void *)exts_i);
+    free((void *)exts_arena);
+    free((void *)exts_hash);
+    exts_i = NULL;
+    exts_arena = NULL;
+    exts_hash = NULL;
+    exts_hash_mask = 0;
+    num_exts_i = 0;
+}
+
+static int build_exts_hash(void) {
+    unsigned int size = 16;
+    int index;
+
+    while(size < (unsigned int)num_exts_i * 2) {
+        size <<= 1;
+    }
+
+    /* Slots hold index + 1 so that 0 can mean empty */
+    exts_hash = (int *)calloc(size, sizeof *exts_hash);
+    if(exts_hash == NULL) {
+        return 0;
+    }
+    exts_hash_mask = size - 1;
+
+    for(index = 0; index < num_exts_i; index++) {
+        unsigned int slot = hash_ext(exts_i[index], strlen(exts_i[index])) & exts_hash_mask;
+        while(exts_hash[slot] != 0) {
+            slot = (slot + 1) & exts_hash_mask;
+        }
+        exts_hash[slot] = index + 1;
+    }
+    return 1;
+}
 
 static int get_exts(void) {
+    size_t arena_size = 0;
+    char *arena_pos;
+    int index;
+
+    free_exts();
+
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
+        const char *cur;
         exts = (const char *)glGetString(GL_EXTENSIONS);
+        if(exts == NULL) {
+            return 0;
+        }
+
+        /* Split the legacy space separated string so both paths share the hash set */
+        for(cur = exts; *cur != '\0'; cur++) {
+            if(*cur != ' ' && (cur == exts || *(cur - 1) == ' ')) {
+                num_exts_i++;
+            }
+        }
+        arena_size = strlen(exts) + 1;
+        if(num_exts_i > 0) {
+            exts_i = (const char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
+        }
+        exts_arena = (char *)malloc(arena_size);
+        if((num_exts_i > 0 && exts_i == NULL) || exts_arena == NULL) {
+            free_exts();
+            return 0;
+        }
+
+        memcpy(exts_arena, exts, arena_size);
+        index = 0;
+        for(arena_pos = exts_arena; *arena_pos != '\0'; arena_pos++) {
+            if(*arena_pos == ' ') {
+                *arena_pos = '\0';
+            } else if(arena_pos == exts_arena || *(arena_pos - 1) == '\0') {
+                exts_i[index++] = arena_pos;
+            }
+        }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
-        int index;
-
         num_exts_i = 0;
         glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
         if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
+            exts_i = (const char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
         }
 
         if (exts_i == NULL) {
+            num_exts_i = 0;
             return 0;
         }
 
+        /* First pass keeps the driver's pointers to size the arena, second pass moves them into it */
         for(index = 0; index < num_exts_i; index++) {
             const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
-
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
+            if(gl_str_tmp == NULL) {
+                gl_str_tmp = "";
             }
-            exts_i[index] = local_str;
+            exts_i[index] = gl_str_tmp;
+            arena_size += strlen(gl_str_tmp) + 1;
         }
-    }
-#endif
-    return 1;
-}
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
+        exts_arena = (char *)malloc(arena_size);
+        if(exts_arena == NULL) {
+            free_exts();
+            return 0;
+        }
+
+        arena_pos = exts_arena;
         for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
+            size_t len = strlen(exts_i[index]);
+            memcpy(arena_pos, exts_i[index], (len+1) * sizeof(char));
+            exts_i[index] = arena_pos;
+            arena_pos += len + 1;
         }
-        free((void *)exts_i);
-        exts_i = NULL;
     }
+#endif
+
+    if(!build_exts_hash()) {
+        free_exts();
+        return 0;
+    }
+    return 1;
 }
 
 static int has_ext(const char *ext) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
-        }
-
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
+    unsigned int slot;
 
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
-        }
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
+    if(exts_hash == NULL || ext == NULL) {
+        return 0;
+    }
 
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
-            }
+    slot = hash_ext(ext, strlen(ext)) & exts_hash_mask;
+    while(exts_hash[slot] != 0) {
+        if(strcmp(exts_i[exts_hash[slot] - 1], ext) == 0) {
+            return 1;
         }
+        slot = (slot + 1) & exts_hash_mask;
     }
-#endif
 
     return 0;
 }
+
+int gladHasExtension(const char *ext) {
+    return has_ext(ext);
+}
+
+int gladGetExtensionCount(void) {
+    return num_exts_i;
+}
+
+const char *gladGetExtension(int index) {
+    if(exts_i == NULL || index < 0 || index >= num_exts_i) {
+        return NULL;
+    }
+    return exts_i[index];
+}
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
 int GLAD_GL_VERSION_1_2 = 0;
@@ -267,41 +360,81 @@ int GLAD_GL_VERSION_3_0 = 0;
 int GLAD_GL_VERSION_3_1 = 0;
 int GLAD_GL_VERSION_3_2 = 0;
 int GLAD_GL_VERSION_3_3 = 0;
+int GLAD_GL_VERSION_4_0 = 0;
+int GLAD_GL_VERSION_4_1 = 0;
+int GLAD_GL_VERSION_4_2 = 0;
+int GLAD_GL_VERSION_4_3 = 0;
+int GLAD_GL_VERSION_4_4 = 0;
+int GLAD_GL_VERSION_4_5 = 0;
+int GLAD_GL_VERSION_4_6 = 0;
+int GLAD_GL_KHR_parallel_shader_compile = 0;
+PFNGLACTIVESHADERPROGRAMPROC glad_glActiveShaderProgram = NULL;
 PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
 PFNGLATTACHSHADERPROC glad_glAttachShader = NULL;
 PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = NULL;
 PFNGLBEGINQUERYPROC glad_glBeginQuery = NULL;
+PFNGLBEGINQUERYINDEXEDPROC glad_glBeginQueryIndexed = NULL;
 PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback = NULL;
 PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = NULL;
 PFNGLBINDBUFFERPROC glad_glBindBuffer = NULL;
 PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = NULL;
 PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange = NULL;
+PFNGLBINDBUFFERSBASEPROC glad_glBindBuffersBase = NULL;
+PFNGLBINDBUFFERSRANGEPROC glad_glBindBuffersRange = NULL;
 PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation = NULL;
 PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed = NULL;
 PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = NULL;
+PFNGLBINDIMAGETEXTUREPROC glad_glBindImageTexture = NULL;
+PFNGLBINDIMAGETEXTURESPROC glad_glBindImageTextures = NULL;
+PFNGLBINDPROGRAMPIPELINEPROC glad_glBindProgramPipeline = NULL;
 PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = NULL;
 PFNGLBINDSAMPLERPROC glad_glBindSampler = NULL;
+PFNGLBINDSAMPLERSPROC glad_glBindSamplers = NULL;
 PFNGLBINDTEXTUREPROC glad_glBindTexture = NULL;
+PFNGLBINDTEXTUREUNITPROC glad_glBindTextureUnit = NULL;
+PFNGLBINDTEXTURESPROC glad_glBindTextures = NULL;
+PFNGLBINDTRANSFORMFEEDBACKPROC glad_glBindTransformFeedback = NULL;
 PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = NULL;
+PFNGLBINDVERTEXBUFFERPROC glad_glBindVertexBuffer = NULL;
+PFNGLBINDVERTEXBUFFERSPROC glad_glBindVertexBuffers = NULL;
 PFNGLBLENDCOLORPROC glad_glBlendColor = NULL;
 PFNGLBLENDEQUATIONPROC glad_glBlendEquation = NULL;
 PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate = NULL;
+PFNGLBLENDEQUATIONSEPARATEIPROC glad_glBlendEquationSeparatei = NULL;
+PFNGLBLENDEQUATIONIPROC glad_glBlendEquationi = NULL;
 PFNGLBLENDFUNCPROC glad_glBlendFunc = NULL;
 PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = NULL;
+PFNGLBLENDFUNCSEPARATEIPROC glad_glBlendFuncSeparatei = NULL;
+PFNGLBLENDFUNCIPROC glad_glBlendFunci = NULL;
 PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = NULL;
+PFNGLBLITNAMEDFRAMEBUFFERPROC glad_glBlitNamedFramebuffer = NULL;
 PFNGLBUFFERDATAPROC glad_glBufferData = NULL;
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
 PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = NULL;
 PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = NULL;
+PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_glCheckNamedFramebufferStatus = NULL;
 PFNGLCLAMPCOLORPROC glad_glClampColor = NULL;
 PFNGLCLEARPROC glad_glClear = NULL;
+PFNGLCLEARBUFFERDATAPROC glad_glClearBufferData = NULL;
+PFNGLCLEARBUFFERSUBDATAPROC glad_glClearBufferSubData = NULL;
 PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi = NULL;
 PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv = NULL;
 PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv = NULL;
 PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv = NULL;
 PFNGLCLEARCOLORPROC glad_glClearColor = NULL;
 PFNGLCLEARDEPTHPROC glad_glClearDepth = NULL;
+PFNGLCLEARDEPTHFPROC glad_glClearDepthf = NULL;
+PFNGLCLEARNAMEDBUFFERDATAPROC glad_glClearNamedBufferData = NULL;
+PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_glClearNamedBufferSubData = NULL;
+PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_glClearNamedFramebufferfi = NULL;
+PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_glClearNamedFramebufferfv = NULL;
+PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_glClearNamedFramebufferiv = NULL;
+PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_glClearNamedFramebufferuiv = NULL;
 PFNGLCLEARSTENCILPROC glad_glClearStencil = NULL;
+PFNGLCLEARTEXIMAGEPROC glad_glClearTexImage = NULL;
+PFNGLCLEARTEXSUBIMAGEPROC glad_glClearTexSubImage = NULL;
 PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = NULL;
+PFNGLCLIPCONTROLPROC glad_glClipControl = NULL;
 PFNGLCOLORMASKPROC glad_glColorMask = NULL;
 PFNGLCOLORMASKIPROC glad_glColorMaski = NULL;
 PFNGLCOLORP3UIPROC glad_glColorP3ui = NULL;
@@ -315,52 +448,94 @@ PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D = NULL;
 PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D = NULL;
 PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D = NULL;
 PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D = NULL;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_glCompressedTextureSubImage1D = NULL;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_glCompressedTextureSubImage2D = NULL;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_glCompressedTextureSubImage3D = NULL;
 PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData = NULL;
+PFNGLCOPYIMAGESUBDATAPROC glad_glCopyImageSubData = NULL;
+PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_glCopyNamedBufferSubData = NULL;
 PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D = NULL;
 PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = NULL;
 PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = NULL;
 PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = NULL;
 PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = NULL;
+PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_glCopyTextureSubImage1D = NULL;
+PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_glCopyTextureSubImage2D = NULL;
+PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_glCopyTextureSubImage3D = NULL;
+PFNGLCREATEBUFFERSPROC glad_glCreateBuffers = NULL;
+PFNGLCREATEFRAMEBUFFERSPROC glad_glCreateFramebuffers = NULL;
 PFNGLCREATEPROGRAMPROC glad_glCreateProgram = NULL;
+PFNGLCREATEPROGRAMPIPELINESPROC glad_glCreateProgramPipelines = NULL;
+PFNGLCREATEQUERIESPROC glad_glCreateQueries = NULL;
+PFNGLCREATERENDERBUFFERSPROC glad_glCreateRenderbuffers = NULL;
+PFNGLCREATESAMPLERSPROC glad_glCreateSamplers = NULL;
 PFNGLCREATESHADERPROC glad_glCreateShader = NULL;
+PFNGLCREATESHADERPROGRAMVPROC glad_glCreateShaderProgramv = NULL;
+PFNGLCREATETEXTURESPROC glad_glCreateTextures = NULL;
+PFNGLCREATETRANSFORMFEEDBACKSPROC glad_glCreateTransformFeedbacks = NULL;
+PFNGLCREATEVERTEXARRAYSPROC glad_glCreateVertexArrays = NULL;
 PFNGLCULLFACEPROC glad_glCullFace = NULL;
+PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback = NULL;
+PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl = NULL;
+PFNGLDEBUGMESSAGEINSERTPROC glad_glDebugMessageInsert = NULL;
 PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers = NULL;
 PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = NULL;
 PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = NULL;
+PFNGLDELETEPROGRAMPIPELINESPROC glad_glDeleteProgramPipelines = NULL;
 PFNGLDELETEQUERIESPROC glad_glDeleteQueries = NULL;
 PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = NULL;
 PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers = NULL;
 PFNGLDELETESHADERPROC glad_glDeleteShader = NULL;
 PFNGLDELETESYNCPROC glad_glDeleteSync = NULL;
 PFNGLDELETETEXTURESPROC glad_glDeleteTextures = NULL;
+PFNGLDELETETRANSFORMFEEDBACKSPROC glad_glDeleteTransformFeedbacks = NULL;
 PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = NULL;
 PFNGLDEPTHFUNCPROC glad_glDepthFunc = NULL;
 PFNGLDEPTHMASKPROC glad_glDepthMask = NULL;
 PFNGLDEPTHRANGEPROC glad_glDepthRange = NULL;
+PFNGLDEPTHRANGEARRAYVPROC glad_glDepthRangeArrayv = NULL;
+PFNGLDEPTHRANGEINDEXEDPROC glad_glDepthRangeIndexed = NULL;
+PFNGLDEPTHRANGEFPROC glad_glDepthRangef = NULL;
 PFNGLDETACHSHADERPROC glad_glDetachShader = NULL;
 PFNGLDISABLEPROC glad_glDisable = NULL;
+PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_glDisableVertexArrayAttrib = NULL;
 PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray = NULL;
 PFNGLDISABLEIPROC glad_glDisablei = NULL;
+PFNGLDISPATCHCOMPUTEPROC glad_glDispatchCompute = NULL;
+PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_glDispatchComputeIndirect = NULL;
 PFNGLDRAWARRAYSPROC glad_glDrawArrays = NULL;
+PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect = NULL;
 PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = NULL;
+PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance = NULL;
 PFNGLDRAWBUFFERPROC glad_glDrawBuffer = NULL;
 PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = NULL;
 PFNGLDRAWELEMENTSPROC glad_glDrawElements = NULL;
 PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = NULL;
+PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect = NULL;
 PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = NULL;
+PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_glDrawElementsInstancedBaseInstance = NULL;
 PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = NULL;
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_glDrawElementsInstancedBaseVertexBaseInstance = NULL;
 PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = NULL;
 PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex = NULL;
+PFNGLDRAWTRANSFORMFEEDBACKPROC glad_glDrawTransformFeedback = NULL;
+PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_glDrawTransformFeedbackInstanced = NULL;
+PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_glDrawTransformFeedbackStream = NULL;
+PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_glDrawTransformFeedbackStreamInstanced = NULL;
 PFNGLENABLEPROC glad_glEnable = NULL;
+PFNGLENABLEVERTEXARRAYATTRIBPROC glad_glEnableVertexArrayAttrib = NULL;
 PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray = NULL;
 PFNGLENABLEIPROC glad_glEnablei = NULL;
 PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender = NULL;
 PFNGLENDQUERYPROC glad_glEndQuery = NULL;
+PFNGLENDQUERYINDEXEDPROC glad_glEndQueryIndexed = NULL;
 PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback = NULL;
 PFNGLFENCESYNCPROC glad_glFenceSync = NULL;
 PFNGLFINISHPROC glad_glFinish = NULL;
 PFNGLFLUSHPROC glad_glFlush = NULL;
 PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange = NULL;
+PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_glFlushMappedNamedBufferRange = NULL;
+PFNGLFRAMEBUFFERPARAMETERIPROC glad_glFramebufferParameteri = NULL;
 PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = NULL;
 PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture = NULL;
 PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D = NULL;
@@ -370,13 +545,20 @@ PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer = NULL;
 PFNGLFRONTFACEPROC glad_glFrontFace = NULL;
 PFNGLGENBUFFERSPROC glad_glGenBuffers = NULL;
 PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = NULL;
+PFNGLGENPROGRAMPIPELINESPROC glad_glGenProgramPipelines = NULL;
 PFNGLGENQUERIESPROC glad_glGenQueries = NULL;
 PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = NULL;
 PFNGLGENSAMPLERSPROC glad_glGenSamplers = NULL;
 PFNGLGENTEXTURESPROC glad_glGenTextures = NULL;
+PFNGLGENTRANSFORMFEEDBACKSPROC glad_glGenTransformFeedbacks = NULL;
 PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays = NULL;
 PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap = NULL;
+PFNGLGENERATETEXTUREMIPMAPPROC glad_glGenerateTextureMipmap = NULL;
+PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_glGetActiveAtomicCounterBufferiv = NULL;
 PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib = NULL;
+PFNGLGETACTIVESUBROUTINENAMEPROC glad_glGetActiveSubroutineName = NULL;
+PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_glGetActiveSubroutineUniformName = NULL;
+PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_glGetActiveSubroutineUniformiv = NULL;
 PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform = NULL;
 PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName = NULL;
 PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv = NULL;
@@ -391,19 +573,52 @@ PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv = NULL;
 PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv = NULL;
 PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData = NULL;
 PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage = NULL;
+PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_glGetCompressedTextureImage = NULL;
+PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_glGetCompressedTextureSubImage = NULL;
+PFNGLGETDEBUGMESSAGELOGPROC glad_glGetDebugMessageLog = NULL;
+PFNGLGETDOUBLEI_VPROC glad_glGetDoublei_v = NULL;
 PFNGLGETDOUBLEVPROC glad_glGetDoublev = NULL;
 PFNGLGETERRORPROC glad_glGetError = NULL;
+PFNGLGETFLOATI_VPROC glad_glGetFloati_v = NULL;
 PFNGLGETFLOATVPROC glad_glGetFloatv = NULL;
 PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex = NULL;
 PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation = NULL;
 PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv = NULL;
+PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_glGetFramebufferParameteriv = NULL;
+PFNGLGETGRAPHICSRESETSTATUSPROC glad_glGetGraphicsResetStatus = NULL;
 PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v = NULL;
 PFNGLGETINTEGER64VPROC glad_glGetInteger64v = NULL;
 PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v = NULL;
 PFNGLGETINTEGERVPROC glad_glGetIntegerv = NULL;
+PFNGLGETINTERNALFORMATI64VPROC glad_glGetInternalformati64v = NULL;
+PFNGLGETINTERNALFORMATIVPROC glad_glGetInternalformativ = NULL;
 PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv = NULL;
+PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_glGetNamedBufferParameteri64v = NULL;
+PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_glGetNamedBufferParameteriv = NULL;
+PFNGLGETNAMEDBUFFERPOINTERVPROC glad_glGetNamedBufferPointerv = NULL;
+PFNGLGETNAMEDBUFFERSUBDATAPROC glad_glGetNamedBufferSubData = NULL;
+PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetNamedFramebufferAttachmentParameteriv = NULL;
+PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_glGetNamedFramebufferParameteriv = NULL;
+PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_glGetNamedRenderbufferParameteriv = NULL;
+PFNGLGETOBJECTLABELPROC glad_glGetObjectLabel = NULL;
+PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel = NULL;
+PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
 PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = NULL;
+PFNGLGETPROGRAMINTERFACEIVPROC glad_glGetProgramInterfaceiv = NULL;
+PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_glGetProgramPipelineInfoLog = NULL;
+PFNGLGETPROGRAMPIPELINEIVPROC glad_glGetProgramPipelineiv = NULL;
+PFNGLGETPROGRAMRESOURCEINDEXPROC glad_glGetProgramResourceIndex = NULL;
+PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_glGetProgramResourceLocation = NULL;
+PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_glGetProgramResourceLocationIndex = NULL;
+PFNGLGETPROGRAMRESOURCENAMEPROC glad_glGetProgramResourceName = NULL;
+PFNGLGETPROGRAMRESOURCEIVPROC glad_glGetProgramResourceiv = NULL;
+PFNGLGETPROGRAMSTAGEIVPROC glad_glGetProgramStageiv = NULL;
 PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = NULL;
+PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_glGetQueryBufferObjecti64v = NULL;
+PFNGLGETQUERYBUFFEROBJECTIVPROC glad_glGetQueryBufferObjectiv = NULL;
+PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_glGetQueryBufferObjectui64v = NULL;
+PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_glGetQueryBufferObjectuiv = NULL;
+PFNGLGETQUERYINDEXEDIVPROC glad_glGetQueryIndexediv = NULL;
 PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v = NULL;
 PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = NULL;
 PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = NULL;
@@ -415,10 +630,13 @@ PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv = NULL;
 PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv = NULL;
 PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv = NULL;
 PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog = NULL;
+PFNGLGETSHADERPRECISIONFORMATPROC glad_glGetShaderPrecisionFormat = NULL;
 PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource = NULL;
 PFNGLGETSHADERIVPROC glad_glGetShaderiv = NULL;
 PFNGLGETSTRINGPROC glad_glGetString = NULL;
 PFNGLGETSTRINGIPROC glad_glGetStringi = NULL;
+PFNGLGETSUBROUTINEINDEXPROC glad_glGetSubroutineIndex = NULL;
+PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_glGetSubroutineUniformLocation = NULL;
 PFNGLGETSYNCIVPROC glad_glGetSynciv = NULL;
 PFNGLGETTEXIMAGEPROC glad_glGetTexImage = NULL;
 PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv = NULL;
@@ -427,40 +645,83 @@ PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv = NULL;
 PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv = NULL;
 PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv = NULL;
 PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv = NULL;
+PFNGLGETTEXTUREIMAGEPROC glad_glGetTextureImage = NULL;
+PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_glGetTextureLevelParameterfv = NULL;
+PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_glGetTextureLevelParameteriv = NULL;
+PFNGLGETTEXTUREPARAMETERIIVPROC glad_glGetTextureParameterIiv = NULL;
+PFNGLGETTEXTUREPARAMETERIUIVPROC glad_glGetTextureParameterIuiv = NULL;
+PFNGLGETTEXTUREPARAMETERFVPROC glad_glGetTextureParameterfv = NULL;
+PFNGLGETTEXTUREPARAMETERIVPROC glad_glGetTextureParameteriv = NULL;
+PFNGLGETTEXTURESUBIMAGEPROC glad_glGetTextureSubImage = NULL;
 PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying = NULL;
+PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_glGetTransformFeedbacki64_v = NULL;
+PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_glGetTransformFeedbacki_v = NULL;
+PFNGLGETTRANSFORMFEEDBACKIVPROC glad_glGetTransformFeedbackiv = NULL;
 PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex = NULL;
 PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices = NULL;
 PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation = NULL;
+PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_glGetUniformSubroutineuiv = NULL;
+PFNGLGETUNIFORMDVPROC glad_glGetUniformdv = NULL;
 PFNGLGETUNIFORMFVPROC glad_glGetUniformfv = NULL;
 PFNGLGETUNIFORMIVPROC glad_glGetUniformiv = NULL;
 PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv = NULL;
+PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_glGetVertexArrayIndexed64iv = NULL;
+PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_glGetVertexArrayIndexediv = NULL;
+PFNGLGETVERTEXARRAYIVPROC glad_glGetVertexArrayiv = NULL;
 PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv = NULL;
 PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv = NULL;
+PFNGLGETVERTEXATTRIBLDVPROC glad_glGetVertexAttribLdv = NULL;
 PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv = NULL;
 PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv = NULL;
 PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv = NULL;
 PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv = NULL;
+PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_glGetnCompressedTexImage = NULL;
+PFNGLGETNTEXIMAGEPROC glad_glGetnTexImage = NULL;
+PFNGLGETNUNIFORMDVPROC glad_glGetnUniformdv = NULL;
+PFNGLGETNUNIFORMFVPROC glad_glGetnUniformfv = NULL;
+PFNGLGETNUNIFORMIVPROC glad_glGetnUniformiv = NULL;
+PFNGLGETNUNIFORMUIVPROC glad_glGetnUniformuiv = NULL;
 PFNGLHINTPROC glad_glHint = NULL;
+PFNGLINVALIDATEBUFFERDATAPROC glad_glInvalidateBufferData = NULL;
+PFNGLINVALIDATEBUFFERSUBDATAPROC glad_glInvalidateBufferSubData = NULL;
+PFNGLINVALIDATEFRAMEBUFFERPROC glad_glInvalidateFramebuffer = NULL;
+PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_glInvalidateNamedFramebufferData = NULL;
+PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_glInvalidateNamedFramebufferSubData = NULL;
+PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_glInvalidateSubFramebuffer = NULL;
+PFNGLINVALIDATETEXIMAGEPROC glad_glInvalidateTexImage = NULL;
+PFNGLINVALIDATETEXSUBIMAGEPROC glad_glInvalidateTexSubImage = NULL;
 PFNGLISBUFFERPROC glad_glIsBuffer = NULL;
 PFNGLISENABLEDPROC glad_glIsEnabled = NULL;
 PFNGLISENABLEDIPROC glad_glIsEnabledi = NULL;
 PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer = NULL;
 PFNGLISPROGRAMPROC glad_glIsProgram = NULL;
+PFNGLISPROGRAMPIPELINEPROC glad_glIsProgramPipeline = NULL;
 PFNGLISQUERYPROC glad_glIsQuery = NULL;
 PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer = NULL;
 PFNGLISSAMPLERPROC glad_glIsSampler = NULL;
 PFNGLISSHADERPROC glad_glIsShader = NULL;
 PFNGLISSYNCPROC glad_glIsSync = NULL;
 PFNGLISTEXTUREPROC glad_glIsTexture = NULL;
+PFNGLISTRANSFORMFEEDBACKPROC glad_glIsTransformFeedback = NULL;
 PFNGLISVERTEXARRAYPROC glad_glIsVertexArray = NULL;
 PFNGLLINEWIDTHPROC glad_glLineWidth = NULL;
 PFNGLLINKPROGRAMPROC glad_glLinkProgram = NULL;
 PFNGLLOGICOPPROC glad_glLogicOp = NULL;
 PFNGLMAPBUFFERPROC glad_glMapBuffer = NULL;
 PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = NULL;
+PFNGLMAPNAMEDBUFFERPROC glad_glMapNamedBuffer = NULL;
+PFNGLMAPNAMEDBUFFERRANGEPROC glad_glMapNamedBufferRange = NULL;
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR = NULL;
+PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier = NULL;
+PFNGLMEMORYBARRIERBYREGIONPROC glad_glMemoryBarrierByRegion = NULL;
+PFNGLMINSAMPLESHADINGPROC glad_glMinSampleShading = NULL;
 PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = NULL;
+PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect = NULL;
+PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC glad_glMultiDrawArraysIndirectCount = NULL;
 PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = NULL;
 PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = NULL;
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect = NULL;
+PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC glad_glMultiDrawElementsIndirectCount = NULL;
 PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui = NULL;
 PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv = NULL;
 PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui = NULL;
@@ -469,8 +730,25 @@ PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui = NULL;
 PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv = NULL;
 PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui = NULL;
 PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv = NULL;
+PFNGLNAMEDBUFFERDATAPROC glad_glNamedBufferData = NULL;
+PFNGLNAMEDBUFFERSTORAGEPROC glad_glNamedBufferStorage = NULL;
+PFNGLNAMEDBUFFERSUBDATAPROC glad_glNamedBufferSubData = NULL;
+PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_glNamedFramebufferDrawBuffer = NULL;
+PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_glNamedFramebufferDrawBuffers = NULL;
+PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_glNamedFramebufferParameteri = NULL;
+PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_glNamedFramebufferReadBuffer = NULL;
+PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_glNamedFramebufferRenderbuffer = NULL;
+PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_glNamedFramebufferTexture = NULL;
+PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_glNamedFramebufferTextureLayer = NULL;
+PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_glNamedRenderbufferStorage = NULL;
+PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glNamedRenderbufferStorageMultisample = NULL;
 PFNGLNORMALP3UIPROC glad_glNormalP3ui = NULL;
 PFNGLNORMALP3UIVPROC glad_glNormalP3uiv = NULL;
+PFNGLOBJECTLABELPROC glad_glObjectLabel = NULL;
+PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel = NULL;
+PFNGLPATCHPARAMETERFVPROC glad_glPatchParameterfv = NULL;
+PFNGLPATCHPARAMETERIPROC glad_glPatchParameteri = NULL;
+PFNGLPAUSETRANSFORMFEEDBACKPROC glad_glPauseTransformFeedback = NULL;
 PFNGLPIXELSTOREFPROC glad_glPixelStoref = NULL;
 PFNGLPIXELSTOREIPROC glad_glPixelStorei = NULL;
 PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = NULL;
@@ -480,13 +758,71 @@ PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv = NULL;
 PFNGLPOINTSIZEPROC glad_glPointSize = NULL;
 PFNGLPOLYGONMODEPROC glad_glPolygonMode = NULL;
 PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset = NULL;
+PFNGLPOLYGONOFFSETCLAMPPROC glad_glPolygonOffsetClamp = NULL;
+PFNGLPOPDEBUGGROUPPROC glad_glPopDebugGroup = NULL;
 PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex = NULL;
+PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
+PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
+PFNGLPROGRAMUNIFORM1DPROC glad_glProgramUniform1d = NULL;
+PFNGLPROGRAMUNIFORM1DVPROC glad_glProgramUniform1dv = NULL;
+PFNGLPROGRAMUNIFORM1FPROC glad_glProgramUniform1f = NULL;
+PFNGLPROGRAMUNIFORM1FVPROC glad_glProgramUniform1fv = NULL;
+PFNGLPROGRAMUNIFORM1IPROC glad_glProgramUniform1i = NULL;
+PFNGLPROGRAMUNIFORM1IVPROC glad_glProgramUniform1iv = NULL;
+PFNGLPROGRAMUNIFORM1UIPROC glad_glProgramUniform1ui = NULL;
+PFNGLPROGRAMUNIFORM1UIVPROC glad_glProgramUniform1uiv = NULL;
+PFNGLPROGRAMUNIFORM2DPROC glad_glProgramUniform2d = NULL;
+PFNGLPROGRAMUNIFORM2DVPROC glad_glProgramUniform2dv = NULL;
+PFNGLPROGRAMUNIFORM2FPROC glad_glProgramUniform2f = NULL;
+PFNGLPROGRAMUNIFORM2FVPROC glad_glProgramUniform2fv = NULL;
+PFNGLPROGRAMUNIFORM2IPROC glad_glProgramUniform2i = NULL;
+PFNGLPROGRAMUNIFORM2IVPROC glad_glProgramUniform2iv = NULL;
+PFNGLPROGRAMUNIFORM2UIPROC glad_glProgramUniform2ui = NULL;
+PFNGLPROGRAMUNIFORM2UIVPROC glad_glProgramUniform2uiv = NULL;
+PFNGLPROGRAMUNIFORM3DPROC glad_glProgramUniform3d = NULL;
+PFNGLPROGRAMUNIFORM3DVPROC glad_glProgramUniform3dv = NULL;
+PFNGLPROGRAMUNIFORM3FPROC glad_glProgramUniform3f = NULL;
+PFNGLPROGRAMUNIFORM3FVPROC glad_glProgramUniform3fv = NULL;
+PFNGLPROGRAMUNIFORM3IPROC glad_glProgramUniform3i = NULL;
+PFNGLPROGRAMUNIFORM3IVPROC glad_glProgramUniform3iv = NULL;
+PFNGLPROGRAMUNIFORM3UIPROC glad_glProgramUniform3ui = NULL;
+PFNGLPROGRAMUNIFORM3UIVPROC glad_glProgramUniform3uiv = NULL;
+PFNGLPROGRAMUNIFORM4DPROC glad_glProgramUniform4d = NULL;
+PFNGLPROGRAMUNIFORM4DVPROC glad_glProgramUniform4dv = NULL;
+PFNGLPROGRAMUNIFORM4FPROC glad_glProgramUniform4f = NULL;
+PFNGLPROGRAMUNIFORM4FVPROC glad_glProgramUniform4fv = NULL;
+PFNGLPROGRAMUNIFORM4IPROC glad_glProgramUniform4i = NULL;
+PFNGLPROGRAMUNIFORM4IVPROC glad_glProgramUniform4iv = NULL;
+PFNGLPROGRAMUNIFORM4UIPROC glad_glProgramUniform4ui = NULL;
+PFNGLPROGRAMUNIFORM4UIVPROC glad_glProgramUniform4uiv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_glProgramUniformMatrix2dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_glProgramUniformMatrix2fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_glProgramUniformMatrix2x3dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_glProgramUniformMatrix2x3fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_glProgramUniformMatrix2x4dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_glProgramUniformMatrix2x4fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_glProgramUniformMatrix3dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_glProgramUniformMatrix3fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_glProgramUniformMatrix3x2dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_glProgramUniformMatrix3x2fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_glProgramUniformMatrix3x4dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_glProgramUniformMatrix3x4fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_glProgramUniformMatrix4dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_glProgramUniformMatrix4fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_glProgramUniformMatrix4x2dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_glProgramUniformMatrix4x2fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_glProgramUniformMatrix4x3dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_glProgramUniformMatrix4x3fv = NULL;
 PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex = NULL;
+PFNGLPUSHDEBUGGROUPPROC glad_glPushDebugGroup = NULL;
 PFNGLQUERYCOUNTERPROC glad_glQueryCounter = NULL;
 PFNGLREADBUFFERPROC glad_glReadBuffer = NULL;
 PFNGLREADPIXELSPROC glad_glReadPixels = NULL;
+PFNGLREADNPIXELSPROC glad_glReadnPixels = NULL;
+PFNGLRELEASESHADERCOMPILERPROC glad_glReleaseShaderCompiler = NULL;
 PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = NULL;
 PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample = NULL;
+PFNGLRESUMETRANSFORMFEEDBACKPROC glad_glResumeTransformFeedback = NULL;
 PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage = NULL;
 PFNGLSAMPLEMASKIPROC glad_glSampleMaski = NULL;
 PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv = NULL;
@@ -496,9 +832,15 @@ PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv = NULL;
 PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri = NULL;
 PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv = NULL;
 PFNGLSCISSORPROC glad_glScissor = NULL;
+PFNGLSCISSORARRAYVPROC glad_glScissorArrayv = NULL;
+PFNGLSCISSORINDEXEDPROC glad_glScissorIndexed = NULL;
+PFNGLSCISSORINDEXEDVPROC glad_glScissorIndexedv = NULL;
 PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui = NULL;
 PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv = NULL;
+PFNGLSHADERBINARYPROC glad_glShaderBinary = NULL;
 PFNGLSHADERSOURCEPROC glad_glShaderSource = NULL;
+PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_glShaderStorageBlockBinding = NULL;
+PFNGLSPECIALIZESHADERPROC glad_glSpecializeShader = NULL;
 PFNGLSTENCILFUNCPROC glad_glStencilFunc = NULL;
 PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate = NULL;
 PFNGLSTENCILMASKPROC glad_glStencilMask = NULL;
@@ -506,6 +848,7 @@ PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate = NULL;
 PFNGLSTENCILOPPROC glad_glStencilOp = NULL;
 PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate = NULL;
 PFNGLTEXBUFFERPROC glad_glTexBuffer = NULL;
+PFNGLTEXBUFFERRANGEPROC glad_glTexBufferRange = NULL;
 PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui = NULL;
 PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv = NULL;
 PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui = NULL;
@@ -525,28 +868,61 @@ PFNGLTEXPARAMETERFPROC glad_glTexParameterf = NULL;
 PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv = NULL;
 PFNGLTEXPARAMETERIPROC glad_glTexParameteri = NULL;
 PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv = NULL;
+PFNGLTEXSTORAGE1DPROC glad_glTexStorage1D = NULL;
+PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D = NULL;
+PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_glTexStorage2DMultisample = NULL;
+PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D = NULL;
+PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_glTexStorage3DMultisample = NULL;
 PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = NULL;
 PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = NULL;
 PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = NULL;
+PFNGLTEXTUREBARRIERPROC glad_glTextureBarrier = NULL;
+PFNGLTEXTUREBUFFERPROC glad_glTextureBuffer = NULL;
+PFNGLTEXTUREBUFFERRANGEPROC glad_glTextureBufferRange = NULL;
+PFNGLTEXTUREPARAMETERIIVPROC glad_glTextureParameterIiv = NULL;
+PFNGLTEXTUREPARAMETERIUIVPROC glad_glTextureParameterIuiv = NULL;
+PFNGLTEXTUREPARAMETERFPROC glad_glTextureParameterf = NULL;
+PFNGLTEXTUREPARAMETERFVPROC glad_glTextureParameterfv = NULL;
+PFNGLTEXTUREPARAMETERIPROC glad_glTextureParameteri = NULL;
+PFNGLTEXTUREPARAMETERIVPROC glad_glTextureParameteriv = NULL;
+PFNGLTEXTURESTORAGE1DPROC glad_glTextureStorage1D = NULL;
+PFNGLTEXTURESTORAGE2DPROC glad_glTextureStorage2D = NULL;
+PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_glTextureStorage2DMultisample = NULL;
+PFNGLTEXTURESTORAGE3DPROC glad_glTextureStorage3D = NULL;
+PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_glTextureStorage3DMultisample = NULL;
+PFNGLTEXTURESUBIMAGE1DPROC glad_glTextureSubImage1D = NULL;
+PFNGLTEXTURESUBIMAGE2DPROC glad_glTextureSubImage2D = NULL;
+PFNGLTEXTURESUBIMAGE3DPROC glad_glTextureSubImage3D = NULL;
+PFNGLTEXTUREVIEWPROC glad_glTextureView = NULL;
+PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_glTransformFeedbackBufferBase = NULL;
+PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_glTransformFeedbackBufferRange = NULL;
 PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = NULL;
+PFNGLUNIFORM1DPROC glad_glUniform1d = NULL;
+PFNGLUNIFORM1DVPROC glad_glUniform1dv = NULL;
 PFNGLUNIFORM1FPROC glad_glUniform1f = NULL;
 PFNGLUNIFORM1FVPROC glad_glUniform1fv = NULL;
 PFNGLUNIFORM1IPROC glad_glUniform1i = NULL;
 PFNGLUNIFORM1IVPROC glad_glUniform1iv = NULL;
 PFNGLUNIFORM1UIPROC glad_glUniform1ui = NULL;
 PFNGLUNIFORM1UIVPROC glad_glUniform1uiv = NULL;
+PFNGLUNIFORM2DPROC glad_glUniform2d = NULL;
+PFNGLUNIFORM2DVPROC glad_glUniform2dv = NULL;
 PFNGLUNIFORM2FPROC glad_glUniform2f = NULL;
 PFNGLUNIFORM2FVPROC glad_glUniform2fv = NULL;
 PFNGLUNIFORM2IPROC glad_glUniform2i = NULL;
 PFNGLUNIFORM2IVPROC glad_glUniform2iv = NULL;
 PFNGLUNIFORM2UIPROC glad_glUniform2ui = NULL;
 PFNGLUNIFORM2UIVPROC glad_glUniform2uiv = NULL;
+PFNGLUNIFORM3DPROC glad_glUniform3d = NULL;
+PFNGLUNIFORM3DVPROC glad_glUniform3dv = NULL;
 PFNGLUNIFORM3FPROC glad_glUniform3f = NULL;
 PFNGLUNIFORM3FVPROC glad_glUniform3fv = NULL;
 PFNGLUNIFORM3IPROC glad_glUniform3i = NULL;
 PFNGLUNIFORM3IVPROC glad_glUniform3iv = NULL;
 PFNGLUNIFORM3UIPROC glad_glUniform3ui = NULL;
 PFNGLUNIFORM3UIVPROC glad_glUniform3uiv = NULL;
+PFNGLUNIFORM4DPROC glad_glUniform4d = NULL;
+PFNGLUNIFORM4DVPROC glad_glUniform4dv = NULL;
 PFNGLUNIFORM4FPROC glad_glUniform4f = NULL;
 PFNGLUNIFORM4FVPROC glad_glUniform4fv = NULL;
 PFNGLUNIFORM4IPROC glad_glUniform4i = NULL;
@@ -554,18 +930,39 @@ PFNGLUNIFORM4IVPROC glad_glUniform4iv = NULL;
 PFNGLUNIFORM4UIPROC glad_glUniform4ui = NULL;
 PFNGLUNIFORM4UIVPROC glad_glUniform4uiv = NULL;
 PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding = NULL;
+PFNGLUNIFORMMATRIX2DVPROC glad_glUniformMatrix2dv = NULL;
 PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv = NULL;
+PFNGLUNIFORMMATRIX2X3DVPROC glad_glUniformMatrix2x3dv = NULL;
 PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv = NULL;
+PFNGLUNIFORMMATRIX2X4DVPROC glad_glUniformMatrix2x4dv = NULL;
 PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv = NULL;
+PFNGLUNIFORMMATRIX3DVPROC glad_glUniformMatrix3dv = NULL;
 PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv = NULL;
+PFNGLUNIFORMMATRIX3X2DVPROC glad_glUniformMatrix3x2dv = NULL;
 PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv = NULL;
+PFNGLUNIFORMMATRIX3X4DVPROC glad_glUniformMatrix3x4dv = NULL;
 PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv = NULL;
+PFNGLUNIFORMMATRIX4DVPROC glad_glUniformMatrix4dv = NULL;
 PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = NULL;
+PFNGLUNIFORMMATRIX4X2DVPROC glad_glUniformMatrix4x2dv = NULL;
 PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv = NULL;
+PFNGLUNIFORMMATRIX4X3DVPROC glad_glUniformMatrix4x3dv = NULL;
 PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv = NULL;
+PFNGLUNIFORMSUBROUTINESUIVPROC glad_glUniformSubroutinesuiv = NULL;
 PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = NULL;
+PFNGLUNMAPNAMEDBUFFERPROC glad_glUnmapNamedBuffer = NULL;
 PFNGLUSEPROGRAMPROC glad_glUseProgram = NULL;
+PFNGLUSEPROGRAMSTAGESPROC glad_glUseProgramStages = NULL;
 PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram = NULL;
+PFNGLVALIDATEPROGRAMPIPELINEPROC glad_glValidateProgramPipeline = NULL;
+PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_glVertexArrayAttribBinding = NULL;
+PFNGLVERTEXARRAYATTRIBFORMATPROC glad_glVertexArrayAttribFormat = NULL;
+PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_glVertexArrayAttribIFormat = NULL;
+PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_glVertexArrayAttribLFormat = NULL;
+PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_glVertexArrayBindingDivisor = NULL;
+PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_glVertexArrayElementBuffer = NULL;
+PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_glVertexArrayVertexBuffer = NULL;
+PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_glVertexArrayVertexBuffers = NULL;
 PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d = NULL;
 PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv = NULL;
 PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f = NULL;
@@ -602,7 +999,9 @@ PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv = NULL;
 PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv = NULL;
 PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv = NULL;
 PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv = NULL;
+PFNGLVERTEXATTRIBBINDINGPROC glad_glVertexAttribBinding = NULL;
 PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor = NULL;
+PFNGLVERTEXATTRIBFORMATPROC glad_glVertexAttribFormat = NULL;
 PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i = NULL;
 PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv = NULL;
 PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui = NULL;
@@ -623,7 +1022,18 @@ PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv = NULL;
 PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui = NULL;
 PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv = NULL;
 PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv = NULL;
+PFNGLVERTEXATTRIBIFORMATPROC glad_glVertexAttribIFormat = NULL;
 PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer = NULL;
+PFNGLVERTEXATTRIBL1DPROC glad_glVertexAttribL1d = NULL;
+PFNGLVERTEXATTRIBL1DVPROC glad_glVertexAttribL1dv = NULL;
+PFNGLVERTEXATTRIBL2DPROC glad_glVertexAttribL2d = NULL;
+PFNGLVERTEXATTRIBL2DVPROC glad_glVertexAttribL2dv = NULL;
+PFNGLVERTEXATTRIBL3DPROC glad_glVertexAttribL3d = NULL;
+PFNGLVERTEXATTRIBL3DVPROC glad_glVertexAttribL3dv = NULL;
+PFNGLVERTEXATTRIBL4DPROC glad_glVertexAttribL4d = NULL;
+PFNGLVERTEXATTRIBL4DVPROC glad_glVertexAttribL4dv = NULL;
+PFNGLVERTEXATTRIBLFORMATPROC glad_glVertexAttribLFormat = NULL;
+PFNGLVERTEXATTRIBLPOINTERPROC glad_glVertexAttribLPointer = NULL;
 PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui = NULL;
 PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv = NULL;
 PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui = NULL;
@@ -633,6 +1043,7 @@ PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv = NULL;
 PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui = NULL;
 PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv = NULL;
 PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer = NULL;
+PFNGLVERTEXBINDINGDIVISORPROC glad_glVertexBindingDivisor = NULL;
 PFNGLVERTEXP2UIPROC glad_glVertexP2ui = NULL;
 PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv = NULL;
 PFNGLVERTEXP3UIPROC glad_glVertexP3ui = NULL;
@@ -640,6 +1051,9 @@ PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv = NULL;
 PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
 PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
 PFNGLVIEWPORTPROC glad_glViewport = NULL;
+PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv = NULL;
+PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf = NULL;
+PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv = NULL;
 PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
@@ -1054,10 +1468,1786 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
 }
+static void load_GL_VERSION_4_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_0) return;
+	glad_glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)load("glMinSampleShading");
+	glad_glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)load("glBlendEquationi");
+	glad_glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)load("glBlendEquationSeparatei");
+	glad_glBlendFunci = (PFNGLBLENDFUNCIPROC)load("glBlendFunci");
+	glad_glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)load("glBlendFuncSeparatei");
+	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)load("glDrawArraysIndirect");
+	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)load("glDrawElementsIndirect");
+	glad_glUniform1d = (PFNGLUNIFORM1DPROC)load("glUniform1d");
+	glad_glUniform2d = (PFNGLUNIFORM2DPROC)load("glUniform2d");
+	glad_glUniform3d = (PFNGLUNIFORM3DPROC)load("glUniform3d");
+	glad_glUniform4d = (PFNGLUNIFORM4DPROC)load("glUniform4d");
+	glad_glUniform1dv = (PFNGLUNIFORM1DVPROC)load("glUniform1dv");
+	glad_glUniform2dv = (PFNGLUNIFORM2DVPROC)load("glUniform2dv");
+	glad_glUniform3dv = (PFNGLUNIFORM3DVPROC)load("glUniform3dv");
+	glad_glUniform4dv = (PFNGLUNIFORM4DVPROC)load("glUniform4dv");
+	glad_glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)load("glUniformMatrix2dv");
+	glad_glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)load("glUniformMatrix3dv");
+	glad_glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)load("glUniformMatrix4dv");
+	glad_glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)load("glUniformMatrix2x3dv");
+	glad_glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)load("glUniformMatrix2x4dv");
+	glad_glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)load("glUniformMatrix3x2dv");
+	glad_glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)load("glUniformMatrix3x4dv");
+	glad_glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)load("glUniformMatrix4x2dv");
+	glad_glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)load("glUniformMatrix4x3dv");
+	glad_glGetUniformdv = (PFNGLGETUNIFORMDVPROC)load("glGetUniformdv");
+	glad_glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)load("glGetSubroutineUniformLocation");
+	glad_glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)load("glGetSubroutineIndex");
+	glad_glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)load("glGetActiveSubroutineUniformiv");
+	glad_glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)load("glGetActiveSubroutineUniformName");
+	glad_glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)load("glGetActiveSubroutineName");
+	glad_glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)load("glUniformSubroutinesuiv");
+	glad_glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)load("glGetUniformSubroutineuiv");
+	glad_glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)load("glGetProgramStageiv");
+	glad_glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)load("glPatchParameteri");
+	glad_glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)load("glPatchParameterfv");
+	glad_glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)load("glBindTransformFeedback");
+	glad_glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)load("glDeleteTransformFeedbacks");
+	glad_glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)load("glGenTransformFeedbacks");
+	glad_glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)load("glIsTransformFeedback");
+	glad_glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)load("glPauseTransformFeedback");
+	glad_glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)load("glResumeTransformFeedback");
+	glad_glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)load("glDrawTransformFeedback");
+	glad_glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)load("glDrawTransformFeedbackStream");
+	glad_glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)load("glBeginQueryIndexed");
+	glad_glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)load("glEndQueryIndexed");
+	glad_glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)load("glGetQueryIndexediv");
+}
+static void load_GL_VERSION_4_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_1) return;
+	glad_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)load("glReleaseShaderCompiler");
+	glad_glShaderBinary = (PFNGLSHADERBINARYPROC)load("glShaderBinary");
+	glad_glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)load("glGetShaderPrecisionFormat");
+	glad_glDepthRangef = (PFNGLDEPTHRANGEFPROC)load("glDepthRangef");
+	glad_glClearDepthf = (PFNGLCLEARDEPTHFPROC)load("glClearDepthf");
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+	glad_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)load("glUseProgramStages");
+	glad_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)load("glActiveShaderProgram");
+	glad_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)load("glCreateShaderProgramv");
+	glad_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)load("glBindProgramPipeline");
+	glad_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)load("glDeleteProgramPipelines");
+	glad_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)load("glGenProgramPipelines");
+	glad_glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)load("glIsProgramPipeline");
+	glad_glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)load("glGetProgramPipelineiv");
+	glad_glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)load("glProgramUniform1i");
+	glad_glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)load("glProgramUniform1iv");
+	glad_glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)load("glProgramUniform1f");
+	glad_glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)load("glProgramUniform1fv");
+	glad_glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)load("glProgramUniform1d");
+	glad_glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)load("glProgramUniform1dv");
+	glad_glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)load("glProgramUniform1ui");
+	glad_glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)load("glProgramUniform1uiv");
+	glad_glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)load("glProgramUniform2i");
+	glad_glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)load("glProgramUniform2iv");
+	glad_glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)load("glProgramUniform2f");
+	glad_glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)load("glProgramUniform2fv");
+	glad_glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)load("glProgramUniform2d");
+	glad_glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)load("glProgramUniform2dv");
+	glad_glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)load("glProgramUniform2ui");
+	glad_glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)load("glProgramUniform2uiv");
+	glad_glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)load("glProgramUniform3i");
+	glad_glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)load("glProgramUniform3iv");
+	glad_glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)load("glProgramUniform3f");
+	glad_glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)load("glProgramUniform3fv");
+	glad_glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)load("glProgramUniform3d");
+	glad_glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)load("glProgramUniform3dv");
+	glad_glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)load("glProgramUniform3ui");
+	glad_glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)load("glProgramUniform3uiv");
+	glad_glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)load("glProgramUniform4i");
+	glad_glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)load("glProgramUniform4iv");
+	glad_glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)load("glProgramUniform4f");
+	glad_glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)load("glProgramUniform4fv");
+	glad_glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)load("glProgramUniform4d");
+	glad_glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)load("glProgramUniform4dv");
+	glad_glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)load("glProgramUniform4ui");
+	glad_glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)load("glProgramUniform4uiv");
+	glad_glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)load("glProgramUniformMatrix2fv");
+	glad_glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)load("glProgramUniformMatrix3fv");
+	glad_glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)load("glProgramUniformMatrix4fv");
+	glad_glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)load("glProgramUniformMatrix2dv");
+	glad_glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)load("glProgramUniformMatrix3dv");
+	glad_glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)load("glProgramUniformMatrix4dv");
+	glad_glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)load("glProgramUniformMatrix2x3fv");
+	glad_glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)load("glProgramUniformMatrix3x2fv");
+	glad_glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)load("glProgramUniformMatrix2x4fv");
+	glad_glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)load("glProgramUniformMatrix4x2fv");
+	glad_glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)load("glProgramUniformMatrix3x4fv");
+	glad_glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)load("glProgramUniformMatrix4x3fv");
+	glad_glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)load("glProgramUniformMatrix2x3dv");
+	glad_glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)load("glProgramUniformMatrix3x2dv");
+	glad_glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)load("glProgramUniformMatrix2x4dv");
+	glad_glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)load("glProgramUniformMatrix4x2dv");
+	glad_glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)load("glProgramUniformMatrix3x4dv");
+	glad_glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)load("glProgramUniformMatrix4x3dv");
+	glad_glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)load("glValidateProgramPipeline");
+	glad_glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)load("glGetProgramPipelineInfoLog");
+	glad_glVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC)load("glVertexAttribL1d");
+	glad_glVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC)load("glVertexAttribL2d");
+	glad_glVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC)load("glVertexAttribL3d");
+	glad_glVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC)load("glVertexAttribL4d");
+	glad_glVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC)load("glVertexAttribL1dv");
+	glad_glVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC)load("glVertexAttribL2dv");
+	glad_glVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC)load("glVertexAttribL3dv");
+	glad_glVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC)load("glVertexAttribL4dv");
+	glad_glVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC)load("glVertexAttribLPointer");
+	glad_glGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC)load("glGetVertexAttribLdv");
+	glad_glViewportArrayv = (PFNGLVIEWPORTARRAYVPROC)load("glViewportArrayv");
+	glad_glViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC)load("glViewportIndexedf");
+	glad_glViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC)load("glViewportIndexedfv");
+	glad_glScissorArrayv = (PFNGLSCISSORARRAYVPROC)load("glScissorArrayv");
+	glad_glScissorIndexed = (PFNGLSCISSORINDEXEDPROC)load("glScissorIndexed");
+	glad_glScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC)load("glScissorIndexedv");
+	glad_glDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC)load("glDepthRangeArrayv");
+	glad_glDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC)load("glDepthRangeIndexed");
+	glad_glGetFloati_v = (PFNGLGETFLOATI_VPROC)load("glGetFloati_v");
+	glad_glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC)load("glGetDoublei_v");
+}
+static void load_GL_VERSION_4_2(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_2) return;
+	glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)load("glDrawArraysInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)load("glDrawElementsInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)load("glDrawElementsInstancedBaseVertexBaseInstance");
+	glad_glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)load("glGetInternalformativ");
+	glad_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)load("glGetActiveAtomicCounterBufferiv");
+	glad_glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)load("glBindImageTexture");
+	glad_glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)load("glMemoryBarrier");
+	glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)load("glTexStorage1D");
+	glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)load("glTexStorage2D");
+	glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)load("glTexStorage3D");
+	glad_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)load("glDrawTransformFeedbackInstanced");
+	glad_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)load("glDrawTransformFeedbackStreamInstanced");
+}
+static void load_GL_VERSION_4_3(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_3) return;
+	glad_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)load("glClearBufferData");
+	glad_glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)load("glClearBufferSubData");
+	glad_glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)load("glDispatchCompute");
+	glad_glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)load("glDispatchComputeIndirect");
+	glad_glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)load("glCopyImageSubData");
+	glad_glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)load("glFramebufferParameteri");
+	glad_glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)load("glGetFramebufferParameteriv");
+	glad_glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)load("glGetInternalformati64v");
+	glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)load("glInvalidateTexSubImage");
+	glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)load("glInvalidateTexImage");
+	glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)load("glInvalidateBufferSubData");
+	glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)load("glInvalidateBufferData");
+	glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)load("glInvalidateFramebuffer");
+	glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)load("glInvalidateSubFramebuffer");
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
+	glad_glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)load("glGetProgramInterfaceiv");
+	glad_glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)load("glGetProgramResourceIndex");
+	glad_glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)load("glGetProgramResourceName");
+	glad_glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)load("glGetProgramResourceiv");
+	glad_glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)load("glGetProgramResourceLocation");
+	glad_glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)load("glGetProgramResourceLocationIndex");
+	glad_glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)load("glShaderStorageBlockBinding");
+	glad_glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)load("glTexBufferRange");
+	glad_glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)load("glTexStorage2DMultisample");
+	glad_glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)load("glTexStorage3DMultisample");
+	glad_glTextureView = (PFNGLTEXTUREVIEWPROC)load("glTextureView");
+	glad_glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)load("glBindVertexBuffer");
+	glad_glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)load("glVertexAttribFormat");
+	glad_glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)load("glVertexAttribIFormat");
+	glad_glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)load("glVertexAttribLFormat");
+	glad_glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)load("glVertexAttribBinding");
+	glad_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)load("glVertexBindingDivisor");
+	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
+	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)load("glDebugMessageInsert");
+	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
+	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)load("glGetDebugMessageLog");
+	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)load("glPushDebugGroup");
+	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)load("glPopDebugGroup");
+	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)load("glObjectLabel");
+	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)load("glGetObjectLabel");
+	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)load("glObjectPtrLabel");
+	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
+}
+static void load_GL_VERSION_4_4(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_4) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+	glad_glClearTexImage = (PFNGLCLEARTEXIMAGEPROC)load("glClearTexImage");
+	glad_glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)load("glClearTexSubImage");
+	glad_glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)load("glBindBuffersBase");
+	glad_glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)load("glBindBuffersRange");
+	glad_glBindTextures = (PFNGLBINDTEXTURESPROC)load("glBindTextures");
+	glad_glBindSamplers = (PFNGLBINDSAMPLERSPROC)load("glBindSamplers");
+	glad_glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)load("glBindImageTextures");
+	glad_glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)load("glBindVertexBuffers");
+}
+static void load_GL_VERSION_4_5(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_5) return;
+	glad_glClipControl = (PFNGLCLIPCONTROLPROC)load("glClipControl");
+	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)load("glCreateTransformFeedbacks");
+	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)load("glTransformFeedbackBufferBase");
+	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)load("glTransformFeedbackBufferRange");
+	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)load("glGetTransformFeedbackiv");
+	glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)load("glGetTransformFeedbacki_v");
+	glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)load("glGetTransformFeedbacki64_v");
+	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)load("glCreateBuffers");
+	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)load("glNamedBufferStorage");
+	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)load("glNamedBufferData");
+	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)load("glNamedBufferSubData");
+	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)load("glCopyNamedBufferSubData");
+	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)load("glClearNamedBufferData");
+	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)load("glClearNamedBufferSubData");
+	glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)load("glMapNamedBuffer");
+	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)load("glMapNamedBufferRange");
+	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)load("glUnmapNamedBuffer");
+	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)load("glFlushMappedNamedBufferRange");
+	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)load("glGetNamedBufferParameteriv");
+	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)load("glGetNamedBufferParameteri64v");
+	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)load("glGetNamedBufferPointerv");
+	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)load("glGetNamedBufferSubData");
+	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)load("glCreateFramebuffers");
+	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)load("glNamedFramebufferRenderbuffer");
+	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)load("glNamedFramebufferParameteri");
+	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)load("glNamedFramebufferTexture");
+	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)load("glNamedFramebufferTextureLayer");
+	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)load("glNamedFramebufferDrawBuffer");
+	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)load("glNamedFramebufferDrawBuffers");
+	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)load("glNamedFramebufferReadBuffer");
+	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)load("glInvalidateNamedFramebufferData");
+	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)load("glInvalidateNamedFramebufferSubData");
+	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)load("glClearNamedFramebufferiv");
+	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)load("glClearNamedFramebufferuiv");
+	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)load("glClearNamedFramebufferfv");
+	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)load("glClearNamedFramebufferfi");
+	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)load("glBlitNamedFramebuffer");
+	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)load("glCheckNamedFramebufferStatus");
+	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)load("glGetNamedFramebufferParameteriv");
+	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetNamedFramebufferAttachmentParameteriv");
+	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)load("glCreateRenderbuffers");
+	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)load("glNamedRenderbufferStorage");
+	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glNamedRenderbufferStorageMultisample");
+	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)load("glGetNamedRenderbufferParameteriv");
+	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)load("glCreateTextures");
+	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)load("glTextureBuffer");
+	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)load("glTextureBufferRange");
+	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)load("glTextureStorage1D");
+	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)load("glTextureStorage2D");
+	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)load("glTextureStorage3D");
+	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)load("glTextureStorage2DMultisample");
+	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)load("glTextureStorage3DMultisample");
+	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)load("glTextureSubImage1D");
+	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)load("glTextureSubImage2D");
+	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)load("glTextureSubImage3D");
+	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)load("glCompressedTextureSubImage1D");
+	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)load("glCompressedTextureSubImage2D");
+	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)load("glCompressedTextureSubImage3D");
+	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)load("glCopyTextureSubImage1D");
+	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)load("glCopyTextureSubImage2D");
+	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)load("glCopyTextureSubImage3D");
+	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)load("glTextureParameterf");
+	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)load("glTextureParameterfv");
+	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)load("glTextureParameteri");
+	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)load("glTextureParameterIiv");
+	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)load("glTextureParameterIuiv");
+	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)load("glTextureParameteriv");
+	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)load("glGenerateTextureMipmap");
+	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)load("glBindTextureUnit");
+	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)load("glGetTextureImage");
+	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)load("glGetCompressedTextureImage");
+	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)load("glGetTextureLevelParameterfv");
+	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)load("glGetTextureLevelParameteriv");
+	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)load("glGetTextureParameterfv");
+	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)load("glGetTextureParameterIiv");
+	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)load("glGetTextureParameterIuiv");
+	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)load("glGetTextureParameteriv");
+	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)load("glCreateVertexArrays");
+	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)load("glDisableVertexArrayAttrib");
+	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)load("glEnableVertexArrayAttrib");
+	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)load("glVertexArrayElementBuffer");
+	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)load("glVertexArrayVertexBuffer");
+	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)load("glVertexArrayVertexBuffers");
+	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)load("glVertexArrayAttribBinding");
+	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)load("glVertexArrayAttribFormat");
+	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)load("glVertexArrayAttribIFormat");
+	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)load("glVertexArrayAttribLFormat");
+	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)load("glVertexArrayBindingDivisor");
+	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)load("glGetVertexArrayiv");
+	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)load("glGetVertexArrayIndexediv");
+	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)load("glGetVertexArrayIndexed64iv");
+	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)load("glCreateSamplers");
+	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)load("glCreateProgramPipelines");
+	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)load("glCreateQueries");
+	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)load("glGetQueryBufferObjecti64v");
+	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)load("glGetQueryBufferObjectiv");
+	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)load("glGetQueryBufferObjectui64v");
+	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)load("glGetQueryBufferObjectuiv");
+	glad_glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)load("glMemoryBarrierByRegion");
+	glad_glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)load("glGetTextureSubImage");
+	glad_glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)load("glGetCompressedTextureSubImage");
+	glad_glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)load("glGetGraphicsResetStatus");
+	glad_glGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)load("glGetnCompressedTexImage");
+	glad_glGetnTexImage = (PFNGLGETNTEXIMAGEPROC)load("glGetnTexImage");
+	glad_glGetnUniformdv = (PFNGLGETNUNIFORMDVPROC)load("glGetnUniformdv");
+	glad_glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC)load("glGetnUniformfv");
+	glad_glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC)load("glGetnUniformiv");
+	glad_glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)load("glGetnUniformuiv");
+	glad_glReadnPixels = (PFNGLREADNPIXELSPROC)load("glReadnPixels");
+	glad_glTextureBarrier = (PFNGLTEXTUREBARRIERPROC)load("glTextureBarrier");
+}
+static void load_GL_VERSION_4_6(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_6) return;
+	glad_glSpecializeShader = (PFNGLSPECIALIZESHADERPROC)load("glSpecializeShader");
+	glad_glMultiDrawArraysIndirectCount = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)load("glMultiDrawArraysIndirectCount");
+	glad_glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)load("glMultiDrawElementsIndirectCount");
+	glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)load("glPolygonOffsetClamp");
+}
+static void load_GL_KHR_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
+/* Lazy loading: every pointer starts out as a trampoline that resolves the
+ * real entry point on its first call, patches the pointer and forwards the
+ * call. Only the functions that are actually used get looked up. */
+static GLADloadproc lazy_load = NULL;
+
+static void APIENTRY lazy_glCullFace(GLenum mode) { glad_glCullFace = (PFNGLCULLFACEPROC)lazy_load("glCullFace"); glad_glCullFace(mode); }
+static void APIENTRY lazy_glFrontFace(GLenum mode) { glad_glFrontFace = (PFNGLFRONTFACEPROC)lazy_load("glFrontFace"); glad_glFrontFace(mode); }
+static void APIENTRY lazy_glHint(GLenum target, GLenum mode) { glad_glHint = (PFNGLHINTPROC)lazy_load("glHint"); glad_glHint(target, mode); }
+static void APIENTRY lazy_glLineWidth(GLfloat width) { glad_glLineWidth = (PFNGLLINEWIDTHPROC)lazy_load("glLineWidth"); glad_glLineWidth(width); }
+static void APIENTRY lazy_glPointSize(GLfloat size) { glad_glPointSize = (PFNGLPOINTSIZEPROC)lazy_load("glPointSize"); glad_glPointSize(size); }
+static void APIENTRY lazy_glPolygonMode(GLenum face, GLenum mode) { glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)lazy_load("glPolygonMode"); glad_glPolygonMode(face, mode); }
+static void APIENTRY lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) { glad_glScissor = (PFNGLSCISSORPROC)lazy_load("glScissor"); glad_glScissor(x, y, width, height); }
+static void APIENTRY lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) { glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)lazy_load("glTexParameterf"); glad_glTexParameterf(target, pname, param); }
+static void APIENTRY lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) { glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)lazy_load("glTexParameterfv"); glad_glTexParameterfv(target, pname, params); }
+static void APIENTRY lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) { glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)lazy_load("glTexParameteri"); glad_glTexParameteri(target, pname, param); }
+static void APIENTRY lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) { glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)lazy_load("glTexParameteriv"); glad_glTexParameteriv(target, pname, params); }
+static void APIENTRY lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) { glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)lazy_load("glTexImage1D"); glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels); }
+static void APIENTRY lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) { glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)lazy_load("glTexImage2D"); glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels); }
+static void APIENTRY lazy_glDrawBuffer(GLenum buf) { glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)lazy_load("glDrawBuffer"); glad_glDrawBuffer(buf); }
+static void APIENTRY lazy_glClear(GLbitfield mask) { glad_glClear = (PFNGLCLEARPROC)lazy_load("glClear"); glad_glClear(mask); }
+static void APIENTRY lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { glad_glClearColor = (PFNGLCLEARCOLORPROC)lazy_load("glClearColor"); glad_glClearColor(red, green, blue, alpha); }
+static void APIENTRY lazy_glClearStencil(GLint s) { glad_glClearStencil = (PFNGLCLEARSTENCILPROC)lazy_load("glClearStencil"); glad_glClearStencil(s); }
+static void APIENTRY lazy_glClearDepth(GLdouble depth) { glad_glClearDepth = (PFNGLCLEARDEPTHPROC)lazy_load("glClearDepth"); glad_glClearDepth(depth); }
+static void APIENTRY lazy_glStencilMask(GLuint mask) { glad_glStencilMask = (PFNGLSTENCILMASKPROC)lazy_load("glStencilMask"); glad_glStencilMask(mask); }
+static void APIENTRY lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) { glad_glColorMask = (PFNGLCOLORMASKPROC)lazy_load("glColorMask"); glad_glColorMask(red, green, blue, alpha); }
+static void APIENTRY lazy_glDepthMask(GLboolean flag) { glad_glDepthMask = (PFNGLDEPTHMASKPROC)lazy_load("glDepthMask"); glad_glDepthMask(flag); }
+static void APIENTRY lazy_glDisable(GLenum cap) { glad_glDisable = (PFNGLDISABLEPROC)lazy_load("glDisable"); glad_glDisable(cap); }
+static void APIENTRY lazy_glEnable(GLenum cap) { glad_glEnable = (PFNGLENABLEPROC)lazy_load("glEnable"); glad_glEnable(cap); }
+static void APIENTRY lazy_glFinish(void) { glad_glFinish = (PFNGLFINISHPROC)lazy_load("glFinish"); glad_glFinish(); }
+static void APIENTRY lazy_glFlush(void) { glad_glFlush = (PFNGLFLUSHPROC)lazy_load("glFlush"); glad_glFlush(); }
+static void APIENTRY lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) { glad_glBlendFunc = (PFNGLBLENDFUNCPROC)lazy_load("glBlendFunc"); glad_glBlendFunc(sfactor, dfactor); }
+static void APIENTRY lazy_glLogicOp(GLenum opcode) { glad_glLogicOp = (PFNGLLOGICOPPROC)lazy_load("glLogicOp"); glad_glLogicOp(opcode); }
+static void APIENTRY lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) { glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)lazy_load("glStencilFunc"); glad_glStencilFunc(func, ref, mask); }
+static void APIENTRY lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) { glad_glStencilOp = (PFNGLSTENCILOPPROC)lazy_load("glStencilOp"); glad_glStencilOp(fail, zfail, zpass); }
+static void APIENTRY lazy_glDepthFunc(GLenum func) { glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)lazy_load("glDepthFunc"); glad_glDepthFunc(func); }
+static void APIENTRY lazy_glPixelStoref(GLenum pname, GLfloat param) { glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)lazy_load("glPixelStoref"); glad_glPixelStoref(pname, param); }
+static void APIENTRY lazy_glPixelStorei(GLenum pname, GLint param) { glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)lazy_load("glPixelStorei"); glad_glPixelStorei(pname, param); }
+static void APIENTRY lazy_glReadBuffer(GLenum src) { glad_glReadBuffer = (PFNGLREADBUFFERPROC)lazy_load("glReadBuffer"); glad_glReadBuffer(src); }
+static void APIENTRY lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) { glad_glReadPixels = (PFNGLREADPIXELSPROC)lazy_load("glReadPixels"); glad_glReadPixels(x, y, width, height, format, type, pixels); }
+static void APIENTRY lazy_glGetBooleanv(GLenum pname, GLboolean *data) { glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)lazy_load("glGetBooleanv"); glad_glGetBooleanv(pname, data); }
+static void APIENTRY lazy_glGetDoublev(GLenum pname, GLdouble *data) { glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)lazy_load("glGetDoublev"); glad_glGetDoublev(pname, data); }
+static GLenum APIENTRY lazy_glGetError(void) { glad_glGetError = (PFNGLGETERRORPROC)lazy_load("glGetError"); return glad_glGetError(); }
+static void APIENTRY lazy_glGetFloatv(GLenum pname, GLfloat *data) { glad_glGetFloatv = (PFNGLGETFLOATVPROC)lazy_load("glGetFloatv"); glad_glGetFloatv(pname, data); }
+static void APIENTRY lazy_glGetIntegerv(GLenum pname, GLint *data) { glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)lazy_load("glGetIntegerv"); glad_glGetIntegerv(pname, data); }
+static void APIENTRY lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)lazy_load("glGetTexImage"); glad_glGetTexImage(target, level, format, type, pixels); }
+static void APIENTRY lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) { glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)lazy_load("glGetTexParameterfv"); glad_glGetTexParameterfv(target, pname, params); }
+static void APIENTRY lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) { glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)lazy_load("glGetTexParameteriv"); glad_glGetTexParameteriv(target, pname, params); }
+static void APIENTRY lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) { glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)lazy_load("glGetTexLevelParameterfv"); glad_glGetTexLevelParameterfv(target, level, pname, params); }
+static void APIENTRY lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) { glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)lazy_load("glGetTexLevelParameteriv"); glad_glGetTexLevelParameteriv(target, level, pname, params); }
+static GLboolean APIENTRY lazy_glIsEnabled(GLenum cap) { glad_glIsEnabled = (PFNGLISENABLEDPROC)lazy_load("glIsEnabled"); return glad_glIsEnabled(cap); }
+static void APIENTRY lazy_glDepthRange(GLdouble n, GLdouble f) { glad_glDepthRange = (PFNGLDEPTHRANGEPROC)lazy_load("glDepthRange"); glad_glDepthRange(n, f); }
+static void APIENTRY lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) { glad_glViewport = (PFNGLVIEWPORTPROC)lazy_load("glViewport"); glad_glViewport(x, y, width, height); }
+static void APIENTRY lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) { glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)lazy_load("glDrawArrays"); glad_glDrawArrays(mode, first, count); }
+static void APIENTRY lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)lazy_load("glDrawElements"); glad_glDrawElements(mode, count, type, indices); }
+static void APIENTRY lazy_glPolygonOffset(GLfloat factor, GLfloat units) { glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)lazy_load("glPolygonOffset"); glad_glPolygonOffset(factor, units); }
+static void APIENTRY lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) { glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)lazy_load("glCopyTexImage1D"); glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border); }
+static void APIENTRY lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) { glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)lazy_load("glCopyTexImage2D"); glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border); }
+static void APIENTRY lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) { glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)lazy_load("glCopyTexSubImage1D"); glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width); }
+static void APIENTRY lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) { glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)lazy_load("glCopyTexSubImage2D"); glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height); }
+static void APIENTRY lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) { glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)lazy_load("glTexSubImage1D"); glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels); }
+static void APIENTRY lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)lazy_load("glTexSubImage2D"); glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels); }
+static void APIENTRY lazy_glBindTexture(GLenum target, GLuint texture) { glad_glBindTexture = (PFNGLBINDTEXTUREPROC)lazy_load("glBindTexture"); glad_glBindTexture(target, texture); }
+static void APIENTRY lazy_glDeleteTextures(GLsizei n, const GLuint *textures) { glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)lazy_load("glDeleteTextures"); glad_glDeleteTextures(n, textures); }
+static void APIENTRY lazy_glGenTextures(GLsizei n, GLuint *textures) { glad_glGenTextures = (PFNGLGENTEXTURESPROC)lazy_load("glGenTextures"); glad_glGenTextures(n, textures); }
+static GLboolean APIENTRY lazy_glIsTexture(GLuint texture) { glad_glIsTexture = (PFNGLISTEXTUREPROC)lazy_load("glIsTexture"); return glad_glIsTexture(texture); }
+static void APIENTRY lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) { glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)lazy_load("glDrawRangeElements"); glad_glDrawRangeElements(mode, start, end, count, type, indices); }
+static void APIENTRY lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) { glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)lazy_load("glTexImage3D"); glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels); }
+static void APIENTRY lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)lazy_load("glTexSubImage3D"); glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels); }
+static void APIENTRY lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)lazy_load("glCopyTexSubImage3D"); glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height); }
+static void APIENTRY lazy_glActiveTexture(GLenum texture) { glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)lazy_load("glActiveTexture"); glad_glActiveTexture(texture); }
+static void APIENTRY lazy_glSampleCoverage(GLfloat value, GLboolean invert) { glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)lazy_load("glSampleCoverage"); glad_glSampleCoverage(value, invert); }
+static void APIENTRY lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) { glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)lazy_load("glCompressedTexImage3D"); glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data); }
+static void APIENTRY lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) { glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)lazy_load("glCompressedTexImage2D"); glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data); }
+static void APIENTRY lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) { glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)lazy_load("glCompressedTexImage1D"); glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data); }
+static void APIENTRY lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) { glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)lazy_load("glCompressedTexSubImage3D"); glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data); }
+static void APIENTRY lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) { glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)lazy_load("glCompressedTexSubImage2D"); glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data); }
+static void APIENTRY lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) { glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)lazy_load("glCompressedTexSubImage1D"); glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data); }
+static void APIENTRY lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) { glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)lazy_load("glGetCompressedTexImage"); glad_glGetCompressedTexImage(target, level, img); }
+static void APIENTRY lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)lazy_load("glBlendFuncSeparate"); glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha); }
+static void APIENTRY lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) { glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)lazy_load("glMultiDrawArrays"); glad_glMultiDrawArrays(mode, first, count, drawcount); }
+static void APIENTRY lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) { glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)lazy_load("glMultiDrawElements"); glad_glMultiDrawElements(mode, count, type, indices, drawcount); }
+static void APIENTRY lazy_glPointParameterf(GLenum pname, GLfloat param) { glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)lazy_load("glPointParameterf"); glad_glPointParameterf(pname, param); }
+static void APIENTRY lazy_glPointParameterfv(GLenum pname, const GLfloat *params) { glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)lazy_load("glPointParameterfv"); glad_glPointParameterfv(pname, params); }
+static void APIENTRY lazy_glPointParameteri(GLenum pname, GLint param) { glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)lazy_load("glPointParameteri"); glad_glPointParameteri(pname, param); }
+static void APIENTRY lazy_glPointParameteriv(GLenum pname, const GLint *params) { glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)lazy_load("glPointParameteriv"); glad_glPointParameteriv(pname, params); }
+static void APIENTRY lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { glad_glBlendColor = (PFNGLBLENDCOLORPROC)lazy_load("glBlendColor"); glad_glBlendColor(red, green, blue, alpha); }
+static void APIENTRY lazy_glBlendEquation(GLenum mode) { glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)lazy_load("glBlendEquation"); glad_glBlendEquation(mode); }
+static void APIENTRY lazy_glGenQueries(GLsizei n, GLuint *ids) { glad_glGenQueries = (PFNGLGENQUERIESPROC)lazy_load("glGenQueries"); glad_glGenQueries(n, ids); }
+static void APIENTRY lazy_glDeleteQueries(GLsizei n, const GLuint *ids) { glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)lazy_load("glDeleteQueries"); glad_glDeleteQueries(n, ids); }
+static GLboolean APIENTRY lazy_glIsQuery(GLuint id) { glad_glIsQuery = (PFNGLISQUERYPROC)lazy_load("glIsQuery"); return glad_glIsQuery(id); }
+static void APIENTRY lazy_glBeginQuery(GLenum target, GLuint id) { glad_glBeginQuery = (PFNGLBEGINQUERYPROC)lazy_load("glBeginQuery"); glad_glBeginQuery(target, id); }
+static void APIENTRY lazy_glEndQuery(GLenum target) { glad_glEndQuery = (PFNGLENDQUERYPROC)lazy_load("glEndQuery"); glad_glEndQuery(target); }
+static void APIENTRY lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) { glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)lazy_load("glGetQueryiv"); glad_glGetQueryiv(target, pname, params); }
+static void APIENTRY lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) { glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)lazy_load("glGetQueryObjectiv"); glad_glGetQueryObjectiv(id, pname, params); }
+static void APIENTRY lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) { glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)lazy_load("glGetQueryObjectuiv"); glad_glGetQueryObjectuiv(id, pname, params); }
+static void APIENTRY lazy_glBindBuffer(GLenum target, GLuint buffer) { glad_glBindBuffer = (PFNGLBINDBUFFERPROC)lazy_load("glBindBuffer"); glad_glBindBuffer(target, buffer); }
+static void APIENTRY lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) { glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)lazy_load("glDeleteBuffers"); glad_glDeleteBuffers(n, buffers); }
+static void APIENTRY lazy_glGenBuffers(GLsizei n, GLuint *buffers) { glad_glGenBuffers = (PFNGLGENBUFFERSPROC)lazy_load("glGenBuffers"); glad_glGenBuffers(n, buffers); }
+static GLboolean APIENTRY lazy_glIsBuffer(GLuint buffer) { glad_glIsBuffer = (PFNGLISBUFFERPROC)lazy_load("glIsBuffer"); return glad_glIsBuffer(buffer); }
+static void APIENTRY lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) { glad_glBufferData = (PFNGLBUFFERDATAPROC)lazy_load("glBufferData"); glad_glBufferData(target, size, data, usage); }
+static void APIENTRY lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)lazy_load("glBufferSubData"); glad_glBufferSubData(target, offset, size, data); }
+static void APIENTRY lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) { glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)lazy_load("glGetBufferSubData"); glad_glGetBufferSubData(target, offset, size, data); }
+static void * APIENTRY lazy_glMapBuffer(GLenum target, GLenum access) { glad_glMapBuffer = (PFNGLMAPBUFFERPROC)lazy_load("glMapBuffer"); return glad_glMapBuffer(target, access); }
+static GLboolean APIENTRY lazy_glUnmapBuffer(GLenum target) { glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)lazy_load("glUnmapBuffer"); return glad_glUnmapBuffer(target); }
+static void APIENTRY lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) { glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)lazy_load("glGetBufferParameteriv"); glad_glGetBufferParameteriv(target, pname, params); }
+static void APIENTRY lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) { glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)lazy_load("glGetBufferPointerv"); glad_glGetBufferPointerv(target, pname, params); }
+static void APIENTRY lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)lazy_load("glBlendEquationSeparate"); glad_glBlendEquationSeparate(modeRGB, modeAlpha); }
+static void APIENTRY lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) { glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)lazy_load("glDrawBuffers"); glad_glDrawBuffers(n, bufs); }
+static void APIENTRY lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) { glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)lazy_load("glStencilOpSeparate"); glad_glStencilOpSeparate(face, sfail, dpfail, dppass); }
+static void APIENTRY lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) { glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)lazy_load("glStencilFuncSeparate"); glad_glStencilFuncSeparate(face, func, ref, mask); }
+static void APIENTRY lazy_glStencilMaskSeparate(GLenum face, GLuint mask) { glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)lazy_load("glStencilMaskSeparate"); glad_glStencilMaskSeparate(face, mask); }
+static void APIENTRY lazy_glAttachShader(GLuint program, GLuint shader) { glad_glAttachShader = (PFNGLATTACHSHADERPROC)lazy_load("glAttachShader"); glad_glAttachShader(program, shader); }
+static void APIENTRY lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) { glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)lazy_load("glBindAttribLocation"); glad_glBindAttribLocation(program, index, name); }
+static void APIENTRY lazy_glCompileShader(GLuint shader) { glad_glCompileShader = (PFNGLCOMPILESHADERPROC)lazy_load("glCompileShader"); glad_glCompileShader(shader); }
+static GLuint APIENTRY lazy_glCreateProgram(void) { glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)lazy_load("glCreateProgram"); return glad_glCreateProgram(); }
+static GLuint APIENTRY lazy_glCreateShader(GLenum type) { glad_glCreateShader = (PFNGLCREATESHADERPROC)lazy_load("glCreateShader"); return glad_glCreateShader(type); }
+static void APIENTRY lazy_glDeleteProgram(GLuint program) { glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)lazy_load("glDeleteProgram"); glad_glDeleteProgram(program); }
+static void APIENTRY lazy_glDeleteShader(GLuint shader) { glad_glDeleteShader = (PFNGLDELETESHADERPROC)lazy_load("glDeleteShader"); glad_glDeleteShader(shader); }
+static void APIENTRY lazy_glDetachShader(GLuint program, GLuint shader) { glad_glDetachShader = (PFNGLDETACHSHADERPROC)lazy_load("glDetachShader"); glad_glDetachShader(program, shader); }
+static void APIENTRY lazy_glDisableVertexAttribArray(GLuint index) { glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)lazy_load("glDisableVertexAttribArray"); glad_glDisableVertexAttribArray(index); }
+static void APIENTRY lazy_glEnableVertexAttribArray(GLuint index) { glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)lazy_load("glEnableVertexAttribArray"); glad_glEnableVertexAttribArray(index); }
+static void APIENTRY lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)lazy_load("glGetActiveAttrib"); glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name); }
+static void APIENTRY lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)lazy_load("glGetActiveUniform"); glad_glGetActiveUniform(program, index, bufSize, length, size, type, name); }
+static void APIENTRY lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) { glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)lazy_load("glGetAttachedShaders"); glad_glGetAttachedShaders(program, maxCount, count, shaders); }
+static GLint APIENTRY lazy_glGetAttribLocation(GLuint program, const GLchar *name) { glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)lazy_load("glGetAttribLocation"); return glad_glGetAttribLocation(program, name); }
+static void APIENTRY lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) { glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)lazy_load("glGetProgramiv"); glad_glGetProgramiv(program, pname, params); }
+static void APIENTRY lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)lazy_load("glGetProgramInfoLog"); glad_glGetProgramInfoLog(program, bufSize, length, infoLog); }
+static void APIENTRY lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) { glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)lazy_load("glGetShaderiv"); glad_glGetShaderiv(shader, pname, params); }
+static void APIENTRY lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)lazy_load("glGetShaderInfoLog"); glad_glGetShaderInfoLog(shader, bufSize, length, infoLog); }
+static void APIENTRY lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) { glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)lazy_load("glGetShaderSource"); glad_glGetShaderSource(shader, bufSize, length, source); }
+static GLint APIENTRY lazy_glGetUniformLocation(GLuint program, const GLchar *name) { glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)lazy_load("glGetUniformLocation"); return glad_glGetUniformLocation(program, name); }
+static void APIENTRY lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) { glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)lazy_load("glGetUniformfv"); glad_glGetUniformfv(program, location, params); }
+static void APIENTRY lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) { glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)lazy_load("glGetUniformiv"); glad_glGetUniformiv(program, location, params); }
+static void APIENTRY lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) { glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)lazy_load("glGetVertexAttribdv"); glad_glGetVertexAttribdv(index, pname, params); }
+static void APIENTRY lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) { glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)lazy_load("glGetVertexAttribfv"); glad_glGetVertexAttribfv(index, pname, params); }
+static void APIENTRY lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) { glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)lazy_load("glGetVertexAttribiv"); glad_glGetVertexAttribiv(index, pname, params); }
+static void APIENTRY lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) { glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)lazy_load("glGetVertexAttribPointerv"); glad_glGetVertexAttribPointerv(index, pname, pointer); }
+static GLboolean APIENTRY lazy_glIsProgram(GLuint program) { glad_glIsProgram = (PFNGLISPROGRAMPROC)lazy_load("glIsProgram"); return glad_glIsProgram(program); }
+static GLboolean APIENTRY lazy_glIsShader(GLuint shader) { glad_glIsShader = (PFNGLISSHADERPROC)lazy_load("glIsShader"); return glad_glIsShader(shader); }
+static void APIENTRY lazy_glLinkProgram(GLuint program) { glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)lazy_load("glLinkProgram"); glad_glLinkProgram(program); }
+static void APIENTRY lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) { glad_glShaderSource = (PFNGLSHADERSOURCEPROC)lazy_load("glShaderSource"); glad_glShaderSource(shader, count, string, length); }
+static void APIENTRY lazy_glUseProgram(GLuint program) { glad_glUseProgram = (PFNGLUSEPROGRAMPROC)lazy_load("glUseProgram"); glad_glUseProgram(program); }
+static void APIENTRY lazy_glUniform1f(GLint location, GLfloat v0) { glad_glUniform1f = (PFNGLUNIFORM1FPROC)lazy_load("glUniform1f"); glad_glUniform1f(location, v0); }
+static void APIENTRY lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) { glad_glUniform2f = (PFNGLUNIFORM2FPROC)lazy_load("glUniform2f"); glad_glUniform2f(location, v0, v1); }
+static void APIENTRY lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { glad_glUniform3f = (PFNGLUNIFORM3FPROC)lazy_load("glUniform3f"); glad_glUniform3f(location, v0, v1, v2); }
+static void APIENTRY lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { glad_glUniform4f = (PFNGLUNIFORM4FPROC)lazy_load("glUniform4f"); glad_glUniform4f(location, v0, v1, v2, v3); }
+static void APIENTRY lazy_glUniform1i(GLint location, GLint v0) { glad_glUniform1i = (PFNGLUNIFORM1IPROC)lazy_load("glUniform1i"); glad_glUniform1i(location, v0); }
+static void APIENTRY lazy_glUniform2i(GLint location, GLint v0, GLint v1) { glad_glUniform2i = (PFNGLUNIFORM2IPROC)lazy_load("glUniform2i"); glad_glUniform2i(location, v0, v1); }
+static void APIENTRY lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) { glad_glUniform3i = (PFNGLUNIFORM3IPROC)lazy_load("glUniform3i"); glad_glUniform3i(location, v0, v1, v2); }
+static void APIENTRY lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) { glad_glUniform4i = (PFNGLUNIFORM4IPROC)lazy_load("glUniform4i"); glad_glUniform4i(location, v0, v1, v2, v3); }
+static void APIENTRY lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) { glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)lazy_load("glUniform1fv"); glad_glUniform1fv(location, count, value); }
+static void APIENTRY lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) { glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)lazy_load("glUniform2fv"); glad_glUniform2fv(location, count, value); }
+static void APIENTRY lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) { glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)lazy_load("glUniform3fv"); glad_glUniform3fv(location, count, value); }
+static void APIENTRY lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) { glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)lazy_load("glUniform4fv"); glad_glUniform4fv(location, count, value); }
+static void APIENTRY lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) { glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)lazy_load("glUniform1iv"); glad_glUniform1iv(location, count, value); }
+static void APIENTRY lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) { glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)lazy_load("glUniform2iv"); glad_glUniform2iv(location, count, value); }
+static void APIENTRY lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) { glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)lazy_load("glUniform3iv"); glad_glUniform3iv(location, count, value); }
+static void APIENTRY lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) { glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)lazy_load("glUniform4iv"); glad_glUniform4iv(location, count, value); }
+static void APIENTRY lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)lazy_load("glUniformMatrix2fv"); glad_glUniformMatrix2fv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)lazy_load("glUniformMatrix3fv"); glad_glUniformMatrix3fv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)lazy_load("glUniformMatrix4fv"); glad_glUniformMatrix4fv(location, count, transpose, value); }
+static void APIENTRY lazy_glValidateProgram(GLuint program) { glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)lazy_load("glValidateProgram"); glad_glValidateProgram(program); }
+static void APIENTRY lazy_glVertexAttrib1d(GLuint index, GLdouble x) { glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)lazy_load("glVertexAttrib1d"); glad_glVertexAttrib1d(index, x); }
+static void APIENTRY lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) { glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)lazy_load("glVertexAttrib1dv"); glad_glVertexAttrib1dv(index, v); }
+static void APIENTRY lazy_glVertexAttrib1f(GLuint index, GLfloat x) { glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)lazy_load("glVertexAttrib1f"); glad_glVertexAttrib1f(index, x); }
+static void APIENTRY lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) { glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)lazy_load("glVertexAttrib1fv"); glad_glVertexAttrib1fv(index, v); }
+static void APIENTRY lazy_glVertexAttrib1s(GLuint index, GLshort x) { glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)lazy_load("glVertexAttrib1s"); glad_glVertexAttrib1s(index, x); }
+static void APIENTRY lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) { glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)lazy_load("glVertexAttrib1sv"); glad_glVertexAttrib1sv(index, v); }
+static void APIENTRY lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) { glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)lazy_load("glVertexAttrib2d"); glad_glVertexAttrib2d(index, x, y); }
+static void APIENTRY lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) { glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)lazy_load("glVertexAttrib2dv"); glad_glVertexAttrib2dv(index, v); }
+static void APIENTRY lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) { glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)lazy_load("glVertexAttrib2f"); glad_glVertexAttrib2f(index, x, y); }
+static void APIENTRY lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) { glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)lazy_load("glVertexAttrib2fv"); glad_glVertexAttrib2fv(index, v); }
+static void APIENTRY lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) { glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)lazy_load("glVertexAttrib2s"); glad_glVertexAttrib2s(index, x, y); }
+static void APIENTRY lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) { glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)lazy_load("glVertexAttrib2sv"); glad_glVertexAttrib2sv(index, v); }
+static void APIENTRY lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) { glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)lazy_load("glVertexAttrib3d"); glad_glVertexAttrib3d(index, x, y, z); }
+static void APIENTRY lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) { glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)lazy_load("glVertexAttrib3dv"); glad_glVertexAttrib3dv(index, v); }
+static void APIENTRY lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) { glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)lazy_load("glVertexAttrib3f"); glad_glVertexAttrib3f(index, x, y, z); }
+static void APIENTRY lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) { glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)lazy_load("glVertexAttrib3fv"); glad_glVertexAttrib3fv(index, v); }
+static void APIENTRY lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) { glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)lazy_load("glVertexAttrib3s"); glad_glVertexAttrib3s(index, x, y, z); }
+static void APIENTRY lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) { glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)lazy_load("glVertexAttrib3sv"); glad_glVertexAttrib3sv(index, v); }
+static void APIENTRY lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) { glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)lazy_load("glVertexAttrib4Nbv"); glad_glVertexAttrib4Nbv(index, v); }
+static void APIENTRY lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) { glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)lazy_load("glVertexAttrib4Niv"); glad_glVertexAttrib4Niv(index, v); }
+static void APIENTRY lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) { glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)lazy_load("glVertexAttrib4Nsv"); glad_glVertexAttrib4Nsv(index, v); }
+static void APIENTRY lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) { glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)lazy_load("glVertexAttrib4Nub"); glad_glVertexAttrib4Nub(index, x, y, z, w); }
+static void APIENTRY lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) { glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)lazy_load("glVertexAttrib4Nubv"); glad_glVertexAttrib4Nubv(index, v); }
+static void APIENTRY lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) { glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)lazy_load("glVertexAttrib4Nuiv"); glad_glVertexAttrib4Nuiv(index, v); }
+static void APIENTRY lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) { glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)lazy_load("glVertexAttrib4Nusv"); glad_glVertexAttrib4Nusv(index, v); }
+static void APIENTRY lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) { glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)lazy_load("glVertexAttrib4bv"); glad_glVertexAttrib4bv(index, v); }
+static void APIENTRY lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)lazy_load("glVertexAttrib4d"); glad_glVertexAttrib4d(index, x, y, z, w); }
+static void APIENTRY lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) { glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)lazy_load("glVertexAttrib4dv"); glad_glVertexAttrib4dv(index, v); }
+static void APIENTRY lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)lazy_load("glVertexAttrib4f"); glad_glVertexAttrib4f(index, x, y, z, w); }
+static void APIENTRY lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) { glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)lazy_load("glVertexAttrib4fv"); glad_glVertexAttrib4fv(index, v); }
+static void APIENTRY lazy_glVertexAttrib4iv(GLuint index, const GLint *v) { glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)lazy_load("glVertexAttrib4iv"); glad_glVertexAttrib4iv(index, v); }
+static void APIENTRY lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) { glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)lazy_load("glVertexAttrib4s"); glad_glVertexAttrib4s(index, x, y, z, w); }
+static void APIENTRY lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) { glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)lazy_load("glVertexAttrib4sv"); glad_glVertexAttrib4sv(index, v); }
+static void APIENTRY lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) { glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)lazy_load("glVertexAttrib4ubv"); glad_glVertexAttrib4ubv(index, v); }
+static void APIENTRY lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) { glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)lazy_load("glVertexAttrib4uiv"); glad_glVertexAttrib4uiv(index, v); }
+static void APIENTRY lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) { glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)lazy_load("glVertexAttrib4usv"); glad_glVertexAttrib4usv(index, v); }
+static void APIENTRY lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)lazy_load("glVertexAttribPointer"); glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer); }
+static void APIENTRY lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)lazy_load("glUniformMatrix2x3fv"); glad_glUniformMatrix2x3fv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)lazy_load("glUniformMatrix3x2fv"); glad_glUniformMatrix3x2fv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)lazy_load("glUniformMatrix2x4fv"); glad_glUniformMatrix2x4fv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)lazy_load("glUniformMatrix4x2fv"); glad_glUniformMatrix4x2fv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)lazy_load("glUniformMatrix3x4fv"); glad_glUniformMatrix3x4fv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)lazy_load("glUniformMatrix4x3fv"); glad_glUniformMatrix4x3fv(location, count, transpose, value); }
+static void APIENTRY lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) { glad_glColorMaski = (PFNGLCOLORMASKIPROC)lazy_load("glColorMaski"); glad_glColorMaski(index, r, g, b, a); }
+static void APIENTRY lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) { glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)lazy_load("glGetBooleani_v"); glad_glGetBooleani_v(target, index, data); }
+static void APIENTRY lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) { glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)lazy_load("glGetIntegeri_v"); glad_glGetIntegeri_v(target, index, data); }
+static void APIENTRY lazy_glEnablei(GLenum target, GLuint index) { glad_glEnablei = (PFNGLENABLEIPROC)lazy_load("glEnablei"); glad_glEnablei(target, index); }
+static void APIENTRY lazy_glDisablei(GLenum target, GLuint index) { glad_glDisablei = (PFNGLDISABLEIPROC)lazy_load("glDisablei"); glad_glDisablei(target, index); }
+static GLboolean APIENTRY lazy_glIsEnabledi(GLenum target, GLuint index) { glad_glIsEnabledi = (PFNGLISENABLEDIPROC)lazy_load("glIsEnabledi"); return glad_glIsEnabledi(target, index); }
+static void APIENTRY lazy_glBeginTransformFeedback(GLenum primitiveMode) { glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)lazy_load("glBeginTransformFeedback"); glad_glBeginTransformFeedback(primitiveMode); }
+static void APIENTRY lazy_glEndTransformFeedback(void) { glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)lazy_load("glEndTransformFeedback"); glad_glEndTransformFeedback(); }
+static void APIENTRY lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) { glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)lazy_load("glBindBufferRange"); glad_glBindBufferRange(target, index, buffer, offset, size); }
+static void APIENTRY lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) { glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)lazy_load("glBindBufferBase"); glad_glBindBufferBase(target, index, buffer); }
+static void APIENTRY lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) { glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)lazy_load("glTransformFeedbackVaryings"); glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode); }
+static void APIENTRY lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) { glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)lazy_load("glGetTransformFeedbackVarying"); glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name); }
+static void APIENTRY lazy_glClampColor(GLenum target, GLenum clamp) { glad_glClampColor = (PFNGLCLAMPCOLORPROC)lazy_load("glClampColor"); glad_glClampColor(target, clamp); }
+static void APIENTRY lazy_glBeginConditionalRender(GLuint id, GLenum mode) { glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)lazy_load("glBeginConditionalRender"); glad_glBeginConditionalRender(id, mode); }
+static void APIENTRY lazy_glEndConditionalRender(void) { glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)lazy_load("glEndConditionalRender"); glad_glEndConditionalRender(); }
+static void APIENTRY lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) { glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)lazy_load("glVertexAttribIPointer"); glad_glVertexAttribIPointer(index, size, type, stride, pointer); }
+static void APIENTRY lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) { glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)lazy_load("glGetVertexAttribIiv"); glad_glGetVertexAttribIiv(index, pname, params); }
+static void APIENTRY lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) { glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)lazy_load("glGetVertexAttribIuiv"); glad_glGetVertexAttribIuiv(index, pname, params); }
+static void APIENTRY lazy_glVertexAttribI1i(GLuint index, GLint x) { glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)lazy_load("glVertexAttribI1i"); glad_glVertexAttribI1i(index, x); }
+static void APIENTRY lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) { glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)lazy_load("glVertexAttribI2i"); glad_glVertexAttribI2i(index, x, y); }
+static void APIENTRY lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) { glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)lazy_load("glVertexAttribI3i"); glad_glVertexAttribI3i(index, x, y, z); }
+static void APIENTRY lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) { glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)lazy_load("glVertexAttribI4i"); glad_glVertexAttribI4i(index, x, y, z, w); }
+static void APIENTRY lazy_glVertexAttribI1ui(GLuint index, GLuint x) { glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)lazy_load("glVertexAttribI1ui"); glad_glVertexAttribI1ui(index, x); }
+static void APIENTRY lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) { glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)lazy_load("glVertexAttribI2ui"); glad_glVertexAttribI2ui(index, x, y); }
+static void APIENTRY lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) { glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)lazy_load("glVertexAttribI3ui"); glad_glVertexAttribI3ui(index, x, y, z); }
+static void APIENTRY lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) { glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)lazy_load("glVertexAttribI4ui"); glad_glVertexAttribI4ui(index, x, y, z, w); }
+static void APIENTRY lazy_glVertexAttribI1iv(GLuint index, const GLint *v) { glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)lazy_load("glVertexAttribI1iv"); glad_glVertexAttribI1iv(index, v); }
+static void APIENTRY lazy_glVertexAttribI2iv(GLuint index, const GLint *v) { glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)lazy_load("glVertexAttribI2iv"); glad_glVertexAttribI2iv(index, v); }
+static void APIENTRY lazy_glVertexAttribI3iv(GLuint index, const GLint *v) { glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)lazy_load("glVertexAttribI3iv"); glad_glVertexAttribI3iv(index, v); }
+static void APIENTRY lazy_glVertexAttribI4iv(GLuint index, const GLint *v) { glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)lazy_load("glVertexAttribI4iv"); glad_glVertexAttribI4iv(index, v); }
+static void APIENTRY lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) { glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)lazy_load("glVertexAttribI1uiv"); glad_glVertexAttribI1uiv(index, v); }
+static void APIENTRY lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) { glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)lazy_load("glVertexAttribI2uiv"); glad_glVertexAttribI2uiv(index, v); }
+static void APIENTRY lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) { glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)lazy_load("glVertexAttribI3uiv"); glad_glVertexAttribI3uiv(index, v); }
+static void APIENTRY lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) { glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)lazy_load("glVertexAttribI4uiv"); glad_glVertexAttribI4uiv(index, v); }
+static void APIENTRY lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) { glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)lazy_load("glVertexAttribI4bv"); glad_glVertexAttribI4bv(index, v); }
+static void APIENTRY lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) { glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)lazy_load("glVertexAttribI4sv"); glad_glVertexAttribI4sv(index, v); }
+static void APIENTRY lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) { glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)lazy_load("glVertexAttribI4ubv"); glad_glVertexAttribI4ubv(index, v); }
+static void APIENTRY lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) { glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)lazy_load("glVertexAttribI4usv"); glad_glVertexAttribI4usv(index, v); }
+static void APIENTRY lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) { glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)lazy_load("glGetUniformuiv"); glad_glGetUniformuiv(program, location, params); }
+static void APIENTRY lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) { glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)lazy_load("glBindFragDataLocation"); glad_glBindFragDataLocation(program, color, name); }
+static GLint APIENTRY lazy_glGetFragDataLocation(GLuint program, const GLchar *name) { glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)lazy_load("glGetFragDataLocation"); return glad_glGetFragDataLocation(program, name); }
+static void APIENTRY lazy_glUniform1ui(GLint location, GLuint v0) { glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)lazy_load("glUniform1ui"); glad_glUniform1ui(location, v0); }
+static void APIENTRY lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) { glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)lazy_load("glUniform2ui"); glad_glUniform2ui(location, v0, v1); }
+static void APIENTRY lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) { glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)lazy_load("glUniform3ui"); glad_glUniform3ui(location, v0, v1, v2); }
+static void APIENTRY lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) { glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)lazy_load("glUniform4ui"); glad_glUniform4ui(location, v0, v1, v2, v3); }
+static void APIENTRY lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) { glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)lazy_load("glUniform1uiv"); glad_glUniform1uiv(location, count, value); }
+static void APIENTRY lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) { glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)lazy_load("glUniform2uiv"); glad_glUniform2uiv(location, count, value); }
+static void APIENTRY lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) { glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)lazy_load("glUniform3uiv"); glad_glUniform3uiv(location, count, value); }
+static void APIENTRY lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) { glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)lazy_load("glUniform4uiv"); glad_glUniform4uiv(location, count, value); }
+static void APIENTRY lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) { glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)lazy_load("glTexParameterIiv"); glad_glTexParameterIiv(target, pname, params); }
+static void APIENTRY lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) { glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)lazy_load("glTexParameterIuiv"); glad_glTexParameterIuiv(target, pname, params); }
+static void APIENTRY lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) { glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)lazy_load("glGetTexParameterIiv"); glad_glGetTexParameterIiv(target, pname, params); }
+static void APIENTRY lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) { glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)lazy_load("glGetTexParameterIuiv"); glad_glGetTexParameterIuiv(target, pname, params); }
+static void APIENTRY lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) { glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)lazy_load("glClearBufferiv"); glad_glClearBufferiv(buffer, drawbuffer, value); }
+static void APIENTRY lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) { glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)lazy_load("glClearBufferuiv"); glad_glClearBufferuiv(buffer, drawbuffer, value); }
+static void APIENTRY lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) { glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)lazy_load("glClearBufferfv"); glad_glClearBufferfv(buffer, drawbuffer, value); }
+static void APIENTRY lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) { glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)lazy_load("glClearBufferfi"); glad_glClearBufferfi(buffer, drawbuffer, depth, stencil); }
+static const GLubyte * APIENTRY lazy_glGetStringi(GLenum name, GLuint index) { glad_glGetStringi = (PFNGLGETSTRINGIPROC)lazy_load("glGetStringi"); return glad_glGetStringi(name, index); }
+static GLboolean APIENTRY lazy_glIsRenderbuffer(GLuint renderbuffer) { glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)lazy_load("glIsRenderbuffer"); return glad_glIsRenderbuffer(renderbuffer); }
+static void APIENTRY lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) { glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)lazy_load("glBindRenderbuffer"); glad_glBindRenderbuffer(target, renderbuffer); }
+static void APIENTRY lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)lazy_load("glDeleteRenderbuffers"); glad_glDeleteRenderbuffers(n, renderbuffers); }
+static void APIENTRY lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) { glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)lazy_load("glGenRenderbuffers"); glad_glGenRenderbuffers(n, renderbuffers); }
+static void APIENTRY lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)lazy_load("glRenderbufferStorage"); glad_glRenderbufferStorage(target, internalformat, width, height); }
+static void APIENTRY lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) { glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)lazy_load("glGetRenderbufferParameteriv"); glad_glGetRenderbufferParameteriv(target, pname, params); }
+static GLboolean APIENTRY lazy_glIsFramebuffer(GLuint framebuffer) { glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)lazy_load("glIsFramebuffer"); return glad_glIsFramebuffer(framebuffer); }
+static void APIENTRY lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) { glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)lazy_load("glBindFramebuffer"); glad_glBindFramebuffer(target, framebuffer); }
+static void APIENTRY lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)lazy_load("glDeleteFramebuffers"); glad_glDeleteFramebuffers(n, framebuffers); }
+static void APIENTRY lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) { glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)lazy_load("glGenFramebuffers"); glad_glGenFramebuffers(n, framebuffers); }
+static GLenum APIENTRY lazy_glCheckFramebufferStatus(GLenum target) { glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)lazy_load("glCheckFramebufferStatus"); return glad_glCheckFramebufferStatus(target); }
+static void APIENTRY lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)lazy_load("glFramebufferTexture1D"); glad_glFramebufferTexture1D(target, attachment, textarget, texture, level); }
+static void APIENTRY lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)lazy_load("glFramebufferTexture2D"); glad_glFramebufferTexture2D(target, attachment, textarget, texture, level); }
+static void APIENTRY lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) { glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)lazy_load("glFramebufferTexture3D"); glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset); }
+static void APIENTRY lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)lazy_load("glFramebufferRenderbuffer"); glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer); }
+static void APIENTRY lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) { glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)lazy_load("glGetFramebufferAttachmentParameteriv"); glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params); }
+static void APIENTRY lazy_glGenerateMipmap(GLenum target) { glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)lazy_load("glGenerateMipmap"); glad_glGenerateMipmap(target); }
+static void APIENTRY lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)lazy_load("glBlitFramebuffer"); glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter); }
+static void APIENTRY lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) { glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)lazy_load("glRenderbufferStorageMultisample"); glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height); }
+static void APIENTRY lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) { glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)lazy_load("glFramebufferTextureLayer"); glad_glFramebufferTextureLayer(target, attachment, texture, level, layer); }
+static void * APIENTRY lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) { glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)lazy_load("glMapBufferRange"); return glad_glMapBufferRange(target, offset, length, access); }
+static void APIENTRY lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) { glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)lazy_load("glFlushMappedBufferRange"); glad_glFlushMappedBufferRange(target, offset, length); }
+static void APIENTRY lazy_glBindVertexArray(GLuint array) { glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)lazy_load("glBindVertexArray"); glad_glBindVertexArray(array); }
+static void APIENTRY lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) { glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)lazy_load("glDeleteVertexArrays"); glad_glDeleteVertexArrays(n, arrays); }
+static void APIENTRY lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) { glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)lazy_load("glGenVertexArrays"); glad_glGenVertexArrays(n, arrays); }
+static GLboolean APIENTRY lazy_glIsVertexArray(GLuint array) { glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)lazy_load("glIsVertexArray"); return glad_glIsVertexArray(array); }
+static void APIENTRY lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)lazy_load("glDrawArraysInstanced"); glad_glDrawArraysInstanced(mode, first, count, instancecount); }
+static void APIENTRY lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)lazy_load("glDrawElementsInstanced"); glad_glDrawElementsInstanced(mode, count, type, indices, instancecount); }
+static void APIENTRY lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) { glad_glTexBuffer = (PFNGLTEXBUFFERPROC)lazy_load("glTexBuffer"); glad_glTexBuffer(target, internalformat, buffer); }
+static void APIENTRY lazy_glPrimitiveRestartIndex(GLuint index) { glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)lazy_load("glPrimitiveRestartIndex"); glad_glPrimitiveRestartIndex(index); }
+static void APIENTRY lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)lazy_load("glCopyBufferSubData"); glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size); }
+static void APIENTRY lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) { glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)lazy_load("glGetUniformIndices"); glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices); }
+static void APIENTRY lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) { glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)lazy_load("glGetActiveUniformsiv"); glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params); }
+static void APIENTRY lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) { glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)lazy_load("glGetActiveUniformName"); glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName); }
+static GLuint APIENTRY lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) { glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)lazy_load("glGetUniformBlockIndex"); return glad_glGetUniformBlockIndex(program, uniformBlockName); }
+static void APIENTRY lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) { glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)lazy_load("glGetActiveUniformBlockiv"); glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params); }
+static void APIENTRY lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) { glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)lazy_load("glGetActiveUniformBlockName"); glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName); }
+static void APIENTRY lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) { glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)lazy_load("glUniformBlockBinding"); glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding); }
+static void APIENTRY lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) { glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)lazy_load("glDrawElementsBaseVertex"); glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex); }
+static void APIENTRY lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) { glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)lazy_load("glDrawRangeElementsBaseVertex"); glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex); }
+static void APIENTRY lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) { glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)lazy_load("glDrawElementsInstancedBaseVertex"); glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex); }
+static void APIENTRY lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) { glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)lazy_load("glMultiDrawElementsBaseVertex"); glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex); }
+static void APIENTRY lazy_glProvokingVertex(GLenum mode) { glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)lazy_load("glProvokingVertex"); glad_glProvokingVertex(mode); }
+static GLsync APIENTRY lazy_glFenceSync(GLenum condition, GLbitfield flags) { glad_glFenceSync = (PFNGLFENCESYNCPROC)lazy_load("glFenceSync"); return glad_glFenceSync(condition, flags); }
+static GLboolean APIENTRY lazy_glIsSync(GLsync sync) { glad_glIsSync = (PFNGLISSYNCPROC)lazy_load("glIsSync"); return glad_glIsSync(sync); }
+static void APIENTRY lazy_glDeleteSync(GLsync sync) { glad_glDeleteSync = (PFNGLDELETESYNCPROC)lazy_load("glDeleteSync"); glad_glDeleteSync(sync); }
+static GLenum APIENTRY lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)lazy_load("glClientWaitSync"); return glad_glClientWaitSync(sync, flags, timeout); }
+static void APIENTRY lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { glad_glWaitSync = (PFNGLWAITSYNCPROC)lazy_load("glWaitSync"); glad_glWaitSync(sync, flags, timeout); }
+static void APIENTRY lazy_glGetInteger64v(GLenum pname, GLint64 *data) { glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)lazy_load("glGetInteger64v"); glad_glGetInteger64v(pname, data); }
+static void APIENTRY lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) { glad_glGetSynciv = (PFNGLGETSYNCIVPROC)lazy_load("glGetSynciv"); glad_glGetSynciv(sync, pname, count, length, values); }
+static void APIENTRY lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) { glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)lazy_load("glGetInteger64i_v"); glad_glGetInteger64i_v(target, index, data); }
+static void APIENTRY lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) { glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)lazy_load("glGetBufferParameteri64v"); glad_glGetBufferParameteri64v(target, pname, params); }
+static void APIENTRY lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) { glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)lazy_load("glFramebufferTexture"); glad_glFramebufferTexture(target, attachment, texture, level); }
+static void APIENTRY lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)lazy_load("glTexImage2DMultisample"); glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations); }
+static void APIENTRY lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)lazy_load("glTexImage3DMultisample"); glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations); }
+static void APIENTRY lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) { glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)lazy_load("glGetMultisamplefv"); glad_glGetMultisamplefv(pname, index, val); }
+static void APIENTRY lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) { glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)lazy_load("glSampleMaski"); glad_glSampleMaski(maskNumber, mask); }
+static void APIENTRY lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) { glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)lazy_load("glBindFragDataLocationIndexed"); glad_glBindFragDataLocationIndexed(program, colorNumber, index, name); }
+static GLint APIENTRY lazy_glGetFragDataIndex(GLuint program, const GLchar *name) { glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)lazy_load("glGetFragDataIndex"); return glad_glGetFragDataIndex(program, name); }
+static void APIENTRY lazy_glGenSamplers(GLsizei count, GLuint *samplers) { glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)lazy_load("glGenSamplers"); glad_glGenSamplers(count, samplers); }
+static void APIENTRY lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) { glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)lazy_load("glDeleteSamplers"); glad_glDeleteSamplers(count, samplers); }
+static GLboolean APIENTRY lazy_glIsSampler(GLuint sampler) { glad_glIsSampler = (PFNGLISSAMPLERPROC)lazy_load("glIsSampler"); return glad_glIsSampler(sampler); }
+static void APIENTRY lazy_glBindSampler(GLuint unit, GLuint sampler) { glad_glBindSampler = (PFNGLBINDSAMPLERPROC)lazy_load("glBindSampler"); glad_glBindSampler(unit, sampler); }
+static void APIENTRY lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) { glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)lazy_load("glSamplerParameteri"); glad_glSamplerParameteri(sampler, pname, param); }
+static void APIENTRY lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) { glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)lazy_load("glSamplerParameteriv"); glad_glSamplerParameteriv(sampler, pname, param); }
+static void APIENTRY lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) { glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)lazy_load("glSamplerParameterf"); glad_glSamplerParameterf(sampler, pname, param); }
+static void APIENTRY lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) { glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)lazy_load("glSamplerParameterfv"); glad_glSamplerParameterfv(sampler, pname, param); }
+static void APIENTRY lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) { glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)lazy_load("glSamplerParameterIiv"); glad_glSamplerParameterIiv(sampler, pname, param); }
+static void APIENTRY lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) { glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)lazy_load("glSamplerParameterIuiv"); glad_glSamplerParameterIuiv(sampler, pname, param); }
+static void APIENTRY lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) { glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)lazy_load("glGetSamplerParameteriv"); glad_glGetSamplerParameteriv(sampler, pname, params); }
+static void APIENTRY lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) { glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)lazy_load("glGetSamplerParameterIiv"); glad_glGetSamplerParameterIiv(sampler, pname, params); }
+static void APIENTRY lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) { glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)lazy_load("glGetSamplerParameterfv"); glad_glGetSamplerParameterfv(sampler, pname, params); }
+static void APIENTRY lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) { glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)lazy_load("glGetSamplerParameterIuiv"); glad_glGetSamplerParameterIuiv(sampler, pname, params); }
+static void APIENTRY lazy_glQueryCounter(GLuint id, GLenum target) { glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)lazy_load("glQueryCounter"); glad_glQueryCounter(id, target); }
+static void APIENTRY lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) { glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)lazy_load("glGetQueryObjecti64v"); glad_glGetQueryObjecti64v(id, pname, params); }
+static void APIENTRY lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) { glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)lazy_load("glGetQueryObjectui64v"); glad_glGetQueryObjectui64v(id, pname, params); }
+static void APIENTRY lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) { glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)lazy_load("glVertexAttribDivisor"); glad_glVertexAttribDivisor(index, divisor); }
+static void APIENTRY lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)lazy_load("glVertexAttribP1ui"); glad_glVertexAttribP1ui(index, type, normalized, value); }
+static void APIENTRY lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)lazy_load("glVertexAttribP1uiv"); glad_glVertexAttribP1uiv(index, type, normalized, value); }
+static void APIENTRY lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)lazy_load("glVertexAttribP2ui"); glad_glVertexAttribP2ui(index, type, normalized, value); }
+static void APIENTRY lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)lazy_load("glVertexAttribP2uiv"); glad_glVertexAttribP2uiv(index, type, normalized, value); }
+static void APIENTRY lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)lazy_load("glVertexAttribP3ui"); glad_glVertexAttribP3ui(index, type, normalized, value); }
+static void APIENTRY lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)lazy_load("glVertexAttribP3uiv"); glad_glVertexAttribP3uiv(index, type, normalized, value); }
+static void APIENTRY lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)lazy_load("glVertexAttribP4ui"); glad_glVertexAttribP4ui(index, type, normalized, value); }
+static void APIENTRY lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)lazy_load("glVertexAttribP4uiv"); glad_glVertexAttribP4uiv(index, type, normalized, value); }
+static void APIENTRY lazy_glVertexP2ui(GLenum type, GLuint value) { glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)lazy_load("glVertexP2ui"); glad_glVertexP2ui(type, value); }
+static void APIENTRY lazy_glVertexP2uiv(GLenum type, const GLuint *value) { glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)lazy_load("glVertexP2uiv"); glad_glVertexP2uiv(type, value); }
+static void APIENTRY lazy_glVertexP3ui(GLenum type, GLuint value) { glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)lazy_load("glVertexP3ui"); glad_glVertexP3ui(type, value); }
+static void APIENTRY lazy_glVertexP3uiv(GLenum type, const GLuint *value) { glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)lazy_load("glVertexP3uiv"); glad_glVertexP3uiv(type, value); }
+static void APIENTRY lazy_glVertexP4ui(GLenum type, GLuint value) { glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)lazy_load("glVertexP4ui"); glad_glVertexP4ui(type, value); }
+static void APIENTRY lazy_glVertexP4uiv(GLenum type, const GLuint *value) { glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)lazy_load("glVertexP4uiv"); glad_glVertexP4uiv(type, value); }
+static void APIENTRY lazy_glTexCoordP1ui(GLenum type, GLuint coords) { glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)lazy_load("glTexCoordP1ui"); glad_glTexCoordP1ui(type, coords); }
+static void APIENTRY lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) { glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)lazy_load("glTexCoordP1uiv"); glad_glTexCoordP1uiv(type, coords); }
+static void APIENTRY lazy_glTexCoordP2ui(GLenum type, GLuint coords) { glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)lazy_load("glTexCoordP2ui"); glad_glTexCoordP2ui(type, coords); }
+static void APIENTRY lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) { glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)lazy_load("glTexCoordP2uiv"); glad_glTexCoordP2uiv(type, coords); }
+static void APIENTRY lazy_glTexCoordP3ui(GLenum type, GLuint coords) { glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)lazy_load("glTexCoordP3ui"); glad_glTexCoordP3ui(type, coords); }
+static void APIENTRY lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) { glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)lazy_load("glTexCoordP3uiv"); glad_glTexCoordP3uiv(type, coords); }
+static void APIENTRY lazy_glTexCoordP4ui(GLenum type, GLuint coords) { glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)lazy_load("glTexCoordP4ui"); glad_glTexCoordP4ui(type, coords); }
+static void APIENTRY lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) { glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)lazy_load("glTexCoordP4uiv"); glad_glTexCoordP4uiv(type, coords); }
+static void APIENTRY lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) { glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)lazy_load("glMultiTexCoordP1ui"); glad_glMultiTexCoordP1ui(texture, type, coords); }
+static void APIENTRY lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) { glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)lazy_load("glMultiTexCoordP1uiv"); glad_glMultiTexCoordP1uiv(texture, type, coords); }
+static void APIENTRY lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) { glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)lazy_load("glMultiTexCoordP2ui"); glad_glMultiTexCoordP2ui(texture, type, coords); }
+static void APIENTRY lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) { glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)lazy_load("glMultiTexCoordP2uiv"); glad_glMultiTexCoordP2uiv(texture, type, coords); }
+static void APIENTRY lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) { glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)lazy_load("glMultiTexCoordP3ui"); glad_glMultiTexCoordP3ui(texture, type, coords); }
+static void APIENTRY lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) { glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)lazy_load("glMultiTexCoordP3uiv"); glad_glMultiTexCoordP3uiv(texture, type, coords); }
+static void APIENTRY lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) { glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)lazy_load("glMultiTexCoordP4ui"); glad_glMultiTexCoordP4ui(texture, type, coords); }
+static void APIENTRY lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) { glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)lazy_load("glMultiTexCoordP4uiv"); glad_glMultiTexCoordP4uiv(texture, type, coords); }
+static void APIENTRY lazy_glNormalP3ui(GLenum type, GLuint coords) { glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)lazy_load("glNormalP3ui"); glad_glNormalP3ui(type, coords); }
+static void APIENTRY lazy_glNormalP3uiv(GLenum type, const GLuint *coords) { glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)lazy_load("glNormalP3uiv"); glad_glNormalP3uiv(type, coords); }
+static void APIENTRY lazy_glColorP3ui(GLenum type, GLuint color) { glad_glColorP3ui = (PFNGLCOLORP3UIPROC)lazy_load("glColorP3ui"); glad_glColorP3ui(type, color); }
+static void APIENTRY lazy_glColorP3uiv(GLenum type, const GLuint *color) { glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)lazy_load("glColorP3uiv"); glad_glColorP3uiv(type, color); }
+static void APIENTRY lazy_glColorP4ui(GLenum type, GLuint color) { glad_glColorP4ui = (PFNGLCOLORP4UIPROC)lazy_load("glColorP4ui"); glad_glColorP4ui(type, color); }
+static void APIENTRY lazy_glColorP4uiv(GLenum type, const GLuint *color) { glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)lazy_load("glColorP4uiv"); glad_glColorP4uiv(type, color); }
+static void APIENTRY lazy_glSecondaryColorP3ui(GLenum type, GLuint color) { glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)lazy_load("glSecondaryColorP3ui"); glad_glSecondaryColorP3ui(type, color); }
+static void APIENTRY lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) { glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)lazy_load("glSecondaryColorP3uiv"); glad_glSecondaryColorP3uiv(type, color); }
+static void APIENTRY lazy_glMinSampleShading(GLfloat value) { glad_glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)lazy_load("glMinSampleShading"); glad_glMinSampleShading(value); }
+static void APIENTRY lazy_glBlendEquationi(GLuint buf, GLenum mode) { glad_glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)lazy_load("glBlendEquationi"); glad_glBlendEquationi(buf, mode); }
+static void APIENTRY lazy_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) { glad_glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)lazy_load("glBlendEquationSeparatei"); glad_glBlendEquationSeparatei(buf, modeRGB, modeAlpha); }
+static void APIENTRY lazy_glBlendFunci(GLuint buf, GLenum src, GLenum dst) { glad_glBlendFunci = (PFNGLBLENDFUNCIPROC)lazy_load("glBlendFunci"); glad_glBlendFunci(buf, src, dst); }
+static void APIENTRY lazy_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) { glad_glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)lazy_load("glBlendFuncSeparatei"); glad_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha); }
+static void APIENTRY lazy_glDrawArraysIndirect(GLenum mode, const void *indirect) { glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)lazy_load("glDrawArraysIndirect"); glad_glDrawArraysIndirect(mode, indirect); }
+static void APIENTRY lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) { glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)lazy_load("glDrawElementsIndirect"); glad_glDrawElementsIndirect(mode, type, indirect); }
+static void APIENTRY lazy_glUniform1d(GLint location, GLdouble x) { glad_glUniform1d = (PFNGLUNIFORM1DPROC)lazy_load("glUniform1d"); glad_glUniform1d(location, x); }
+static void APIENTRY lazy_glUniform2d(GLint location, GLdouble x, GLdouble y) { glad_glUniform2d = (PFNGLUNIFORM2DPROC)lazy_load("glUniform2d"); glad_glUniform2d(location, x, y); }
+static void APIENTRY lazy_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) { glad_glUniform3d = (PFNGLUNIFORM3DPROC)lazy_load("glUniform3d"); glad_glUniform3d(location, x, y, z); }
+static void APIENTRY lazy_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { glad_glUniform4d = (PFNGLUNIFORM4DPROC)lazy_load("glUniform4d"); glad_glUniform4d(location, x, y, z, w); }
+static void APIENTRY lazy_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) { glad_glUniform1dv = (PFNGLUNIFORM1DVPROC)lazy_load("glUniform1dv"); glad_glUniform1dv(location, count, value); }
+static void APIENTRY lazy_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) { glad_glUniform2dv = (PFNGLUNIFORM2DVPROC)lazy_load("glUniform2dv"); glad_glUniform2dv(location, count, value); }
+static void APIENTRY lazy_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) { glad_glUniform3dv = (PFNGLUNIFORM3DVPROC)lazy_load("glUniform3dv"); glad_glUniform3dv(location, count, value); }
+static void APIENTRY lazy_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) { glad_glUniform4dv = (PFNGLUNIFORM4DVPROC)lazy_load("glUniform4dv"); glad_glUniform4dv(location, count, value); }
+static void APIENTRY lazy_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)lazy_load("glUniformMatrix2dv"); glad_glUniformMatrix2dv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)lazy_load("glUniformMatrix3dv"); glad_glUniformMatrix3dv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)lazy_load("glUniformMatrix4dv"); glad_glUniformMatrix4dv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)lazy_load("glUniformMatrix2x3dv"); glad_glUniformMatrix2x3dv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)lazy_load("glUniformMatrix2x4dv"); glad_glUniformMatrix2x4dv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)lazy_load("glUniformMatrix3x2dv"); glad_glUniformMatrix3x2dv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)lazy_load("glUniformMatrix3x4dv"); glad_glUniformMatrix3x4dv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)lazy_load("glUniformMatrix4x2dv"); glad_glUniformMatrix4x2dv(location, count, transpose, value); }
+static void APIENTRY lazy_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)lazy_load("glUniformMatrix4x3dv"); glad_glUniformMatrix4x3dv(location, count, transpose, value); }
+static void APIENTRY lazy_glGetUniformdv(GLuint program, GLint location, GLdouble *params) { glad_glGetUniformdv = (PFNGLGETUNIFORMDVPROC)lazy_load("glGetUniformdv"); glad_glGetUniformdv(program, location, params); }
+static GLint APIENTRY lazy_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) { glad_glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)lazy_load("glGetSubroutineUniformLocation"); return glad_glGetSubroutineUniformLocation(program, shadertype, name); }
+static GLuint APIENTRY lazy_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) { glad_glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)lazy_load("glGetSubroutineIndex"); return glad_glGetSubroutineIndex(program, shadertype, name); }
+static void APIENTRY lazy_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) { glad_glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)lazy_load("glGetActiveSubroutineUniformiv"); glad_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values); }
+static void APIENTRY lazy_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) { glad_glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)lazy_load("glGetActiveSubroutineUniformName"); glad_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name); }
+static void APIENTRY lazy_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) { glad_glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)lazy_load("glGetActiveSubroutineName"); glad_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name); }
+static void APIENTRY lazy_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) { glad_glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)lazy_load("glUniformSubroutinesuiv"); glad_glUniformSubroutinesuiv(shadertype, count, indices); }
+static void APIENTRY lazy_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) { glad_glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)lazy_load("glGetUniformSubroutineuiv"); glad_glGetUniformSubroutineuiv(shadertype, location, params); }
+static void APIENTRY lazy_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) { glad_glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)lazy_load("glGetProgramStageiv"); glad_glGetProgramStageiv(program, shadertype, pname, values); }
+static void APIENTRY lazy_glPatchParameteri(GLenum pname, GLint value) { glad_glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)lazy_load("glPatchParameteri"); glad_glPatchParameteri(pname, value); }
+static void APIENTRY lazy_glPatchParameterfv(GLenum pname, const GLfloat *values) { glad_glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)lazy_load("glPatchParameterfv"); glad_glPatchParameterfv(pname, values); }
+static void APIENTRY lazy_glBindTransformFeedback(GLenum target, GLuint id) { glad_glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)lazy_load("glBindTransformFeedback"); glad_glBindTransformFeedback(target, id); }
+static void APIENTRY lazy_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) { glad_glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)lazy_load("glDeleteTransformFeedbacks"); glad_glDeleteTransformFeedbacks(n, ids); }
+static void APIENTRY lazy_glGenTransformFeedbacks(GLsizei n, GLuint *ids) { glad_glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)lazy_load("glGenTransformFeedbacks"); glad_glGenTransformFeedbacks(n, ids); }
+static GLboolean APIENTRY lazy_glIsTransformFeedback(GLuint id) { glad_glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)lazy_load("glIsTransformFeedback"); return glad_glIsTransformFeedback(id); }
+static void APIENTRY lazy_glPauseTransformFeedback(void) { glad_glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)lazy_load("glPauseTransformFeedback"); glad_glPauseTransformFeedback(); }
+static void APIENTRY lazy_glResumeTransformFeedback(void) { glad_glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)lazy_load("glResumeTransformFeedback"); glad_glResumeTransformFeedback(); }
+static void APIENTRY lazy_glDrawTransformFeedback(GLenum mode, GLuint id) { glad_glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)lazy_load("glDrawTransformFeedback"); glad_glDrawTransformFeedback(mode, id); }
+static void APIENTRY lazy_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) { glad_glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)lazy_load("glDrawTransformFeedbackStream"); glad_glDrawTransformFeedbackStream(mode, id, stream); }
+static void APIENTRY lazy_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) { glad_glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)lazy_load("glBeginQueryIndexed"); glad_glBeginQueryIndexed(target, index, id); }
+static void APIENTRY lazy_glEndQueryIndexed(GLenum target, GLuint index) { glad_glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)lazy_load("glEndQueryIndexed"); glad_glEndQueryIndexed(target, index); }
+static void APIENTRY lazy_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) { glad_glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)lazy_load("glGetQueryIndexediv"); glad_glGetQueryIndexediv(target, index, pname, params); }
+static void APIENTRY lazy_glReleaseShaderCompiler(void) { glad_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)lazy_load("glReleaseShaderCompiler"); glad_glReleaseShaderCompiler(); }
+static void APIENTRY lazy_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) { glad_glShaderBinary = (PFNGLSHADERBINARYPROC)lazy_load("glShaderBinary"); glad_glShaderBinary(count, shaders, binaryFormat, binary, length); }
+static void APIENTRY lazy_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) { glad_glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)lazy_load("glGetShaderPrecisionFormat"); glad_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision); }
+static void APIENTRY lazy_glDepthRangef(GLfloat n, GLfloat f) { glad_glDepthRangef = (PFNGLDEPTHRANGEFPROC)lazy_load("glDepthRangef"); glad_glDepthRangef(n, f); }
+static void APIENTRY lazy_glClearDepthf(GLfloat d) { glad_glClearDepthf = (PFNGLCLEARDEPTHFPROC)lazy_load("glClearDepthf"); glad_glClearDepthf(d); }
+static void APIENTRY lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) { glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)lazy_load("glGetProgramBinary"); glad_glGetProgramBinary(program, bufSize, length, binaryFormat, binary); }
+static void APIENTRY lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) { glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)lazy_load("glProgramBinary"); glad_glProgramBinary(program, binaryFormat, binary, length); }
+static void APIENTRY lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) { glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)lazy_load("glProgramParameteri"); glad_glProgramParameteri(program, pname, value); }
+static void APIENTRY lazy_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) { glad_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)lazy_load("glUseProgramStages"); glad_glUseProgramStages(pipeline, stages, program); }
+static void APIENTRY lazy_glActiveShaderProgram(GLuint pipeline, GLuint program) { glad_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)lazy_load("glActiveShaderProgram"); glad_glActiveShaderProgram(pipeline, program); }
+static GLuint APIENTRY lazy_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) { glad_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)lazy_load("glCreateShaderProgramv"); return glad_glCreateShaderProgramv(type, count, strings); }
+static void APIENTRY lazy_glBindProgramPipeline(GLuint pipeline) { glad_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)lazy_load("glBindProgramPipeline"); glad_glBindProgramPipeline(pipeline); }
+static void APIENTRY lazy_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) { glad_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)lazy_load("glDeleteProgramPipelines"); glad_glDeleteProgramPipelines(n, pipelines); }
+static void APIENTRY lazy_glGenProgramPipelines(GLsizei n, GLuint *pipelines) { glad_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)lazy_load("glGenProgramPipelines"); glad_glGenProgramPipelines(n, pipelines); }
+static GLboolean APIENTRY lazy_glIsProgramPipeline(GLuint pipeline) { glad_glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)lazy_load("glIsProgramPipeline"); return glad_glIsProgramPipeline(pipeline); }
+static void APIENTRY lazy_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) { glad_glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)lazy_load("glGetProgramPipelineiv"); glad_glGetProgramPipelineiv(pipeline, pname, params); }
+static void APIENTRY lazy_glProgramUniform1i(GLuint program, GLint location, GLint v0) { glad_glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)lazy_load("glProgramUniform1i"); glad_glProgramUniform1i(program, location, v0); }
+static void APIENTRY lazy_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) { glad_glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)lazy_load("glProgramUniform1iv"); glad_glProgramUniform1iv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) { glad_glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)lazy_load("glProgramUniform1f"); glad_glProgramUniform1f(program, location, v0); }
+static void APIENTRY lazy_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) { glad_glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)lazy_load("glProgramUniform1fv"); glad_glProgramUniform1fv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) { glad_glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)lazy_load("glProgramUniform1d"); glad_glProgramUniform1d(program, location, v0); }
+static void APIENTRY lazy_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) { glad_glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)lazy_load("glProgramUniform1dv"); glad_glProgramUniform1dv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) { glad_glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)lazy_load("glProgramUniform1ui"); glad_glProgramUniform1ui(program, location, v0); }
+static void APIENTRY lazy_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) { glad_glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)lazy_load("glProgramUniform1uiv"); glad_glProgramUniform1uiv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) { glad_glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)lazy_load("glProgramUniform2i"); glad_glProgramUniform2i(program, location, v0, v1); }
+static void APIENTRY lazy_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) { glad_glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)lazy_load("glProgramUniform2iv"); glad_glProgramUniform2iv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) { glad_glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)lazy_load("glProgramUniform2f"); glad_glProgramUniform2f(program, location, v0, v1); }
+static void APIENTRY lazy_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) { glad_glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)lazy_load("glProgramUniform2fv"); glad_glProgramUniform2fv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) { glad_glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)lazy_load("glProgramUniform2d"); glad_glProgramUniform2d(program, location, v0, v1); }
+static void APIENTRY lazy_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) { glad_glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)lazy_load("glProgramUniform2dv"); glad_glProgramUniform2dv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) { glad_glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)lazy_load("glProgramUniform2ui"); glad_glProgramUniform2ui(program, location, v0, v1); }
+static void APIENTRY lazy_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) { glad_glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)lazy_load("glProgramUniform2uiv"); glad_glProgramUniform2uiv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) { glad_glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)lazy_load("glProgramUniform3i"); glad_glProgramUniform3i(program, location, v0, v1, v2); }
+static void APIENTRY lazy_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) { glad_glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)lazy_load("glProgramUniform3iv"); glad_glProgramUniform3iv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { glad_glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)lazy_load("glProgramUniform3f"); glad_glProgramUniform3f(program, location, v0, v1, v2); }
+static void APIENTRY lazy_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) { glad_glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)lazy_load("glProgramUniform3fv"); glad_glProgramUniform3fv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) { glad_glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)lazy_load("glProgramUniform3d"); glad_glProgramUniform3d(program, location, v0, v1, v2); }
+static void APIENTRY lazy_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) { glad_glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)lazy_load("glProgramUniform3dv"); glad_glProgramUniform3dv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) { glad_glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)lazy_load("glProgramUniform3ui"); glad_glProgramUniform3ui(program, location, v0, v1, v2); }
+static void APIENTRY lazy_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) { glad_glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)lazy_load("glProgramUniform3uiv"); glad_glProgramUniform3uiv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) { glad_glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)lazy_load("glProgramUniform4i"); glad_glProgramUniform4i(program, location, v0, v1, v2, v3); }
+static void APIENTRY lazy_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) { glad_glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)lazy_load("glProgramUniform4iv"); glad_glProgramUniform4iv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { glad_glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)lazy_load("glProgramUniform4f"); glad_glProgramUniform4f(program, location, v0, v1, v2, v3); }
+static void APIENTRY lazy_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) { glad_glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)lazy_load("glProgramUniform4fv"); glad_glProgramUniform4fv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) { glad_glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)lazy_load("glProgramUniform4d"); glad_glProgramUniform4d(program, location, v0, v1, v2, v3); }
+static void APIENTRY lazy_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) { glad_glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)lazy_load("glProgramUniform4dv"); glad_glProgramUniform4dv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) { glad_glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)lazy_load("glProgramUniform4ui"); glad_glProgramUniform4ui(program, location, v0, v1, v2, v3); }
+static void APIENTRY lazy_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) { glad_glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)lazy_load("glProgramUniform4uiv"); glad_glProgramUniform4uiv(program, location, count, value); }
+static void APIENTRY lazy_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)lazy_load("glProgramUniformMatrix2fv"); glad_glProgramUniformMatrix2fv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)lazy_load("glProgramUniformMatrix3fv"); glad_glProgramUniformMatrix3fv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)lazy_load("glProgramUniformMatrix4fv"); glad_glProgramUniformMatrix4fv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)lazy_load("glProgramUniformMatrix2dv"); glad_glProgramUniformMatrix2dv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)lazy_load("glProgramUniformMatrix3dv"); glad_glProgramUniformMatrix3dv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)lazy_load("glProgramUniformMatrix4dv"); glad_glProgramUniformMatrix4dv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)lazy_load("glProgramUniformMatrix2x3fv"); glad_glProgramUniformMatrix2x3fv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)lazy_load("glProgramUniformMatrix3x2fv"); glad_glProgramUniformMatrix3x2fv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)lazy_load("glProgramUniformMatrix2x4fv"); glad_glProgramUniformMatrix2x4fv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)lazy_load("glProgramUniformMatrix4x2fv"); glad_glProgramUniformMatrix4x2fv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)lazy_load("glProgramUniformMatrix3x4fv"); glad_glProgramUniformMatrix3x4fv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { glad_glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)lazy_load("glProgramUniformMatrix4x3fv"); glad_glProgramUniformMatrix4x3fv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)lazy_load("glProgramUniformMatrix2x3dv"); glad_glProgramUniformMatrix2x3dv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)lazy_load("glProgramUniformMatrix3x2dv"); glad_glProgramUniformMatrix3x2dv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)lazy_load("glProgramUniformMatrix2x4dv"); glad_glProgramUniformMatrix2x4dv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)lazy_load("glProgramUniformMatrix4x2dv"); glad_glProgramUniformMatrix4x2dv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)lazy_load("glProgramUniformMatrix3x4dv"); glad_glProgramUniformMatrix3x4dv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { glad_glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)lazy_load("glProgramUniformMatrix4x3dv"); glad_glProgramUniformMatrix4x3dv(program, location, count, transpose, value); }
+static void APIENTRY lazy_glValidateProgramPipeline(GLuint pipeline) { glad_glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)lazy_load("glValidateProgramPipeline"); glad_glValidateProgramPipeline(pipeline); }
+static void APIENTRY lazy_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { glad_glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)lazy_load("glGetProgramPipelineInfoLog"); glad_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog); }
+static void APIENTRY lazy_glVertexAttribL1d(GLuint index, GLdouble x) { glad_glVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC)lazy_load("glVertexAttribL1d"); glad_glVertexAttribL1d(index, x); }
+static void APIENTRY lazy_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) { glad_glVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC)lazy_load("glVertexAttribL2d"); glad_glVertexAttribL2d(index, x, y); }
+static void APIENTRY lazy_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) { glad_glVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC)lazy_load("glVertexAttribL3d"); glad_glVertexAttribL3d(index, x, y, z); }
+static void APIENTRY lazy_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { glad_glVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC)lazy_load("glVertexAttribL4d"); glad_glVertexAttribL4d(index, x, y, z, w); }
+static void APIENTRY lazy_glVertexAttribL1dv(GLuint index, const GLdouble *v) { glad_glVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC)lazy_load("glVertexAttribL1dv"); glad_glVertexAttribL1dv(index, v); }
+static void APIENTRY lazy_glVertexAttribL2dv(GLuint index, const GLdouble *v) { glad_glVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC)lazy_load("glVertexAttribL2dv"); glad_glVertexAttribL2dv(index, v); }
+static void APIENTRY lazy_glVertexAttribL3dv(GLuint index, const GLdouble *v) { glad_glVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC)lazy_load("glVertexAttribL3dv"); glad_glVertexAttribL3dv(index, v); }
+static void APIENTRY lazy_glVertexAttribL4dv(GLuint index, const GLdouble *v) { glad_glVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC)lazy_load("glVertexAttribL4dv"); glad_glVertexAttribL4dv(index, v); }
+static void APIENTRY lazy_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) { glad_glVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC)lazy_load("glVertexAttribLPointer"); glad_glVertexAttribLPointer(index, size, type, stride, pointer); }
+static void APIENTRY lazy_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) { glad_glGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC)lazy_load("glGetVertexAttribLdv"); glad_glGetVertexAttribLdv(index, pname, params); }
+static void APIENTRY lazy_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) { glad_glViewportArrayv = (PFNGLVIEWPORTARRAYVPROC)lazy_load("glViewportArrayv"); glad_glViewportArrayv(first, count, v); }
+static void APIENTRY lazy_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) { glad_glViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC)lazy_load("glViewportIndexedf"); glad_glViewportIndexedf(index, x, y, w, h); }
+static void APIENTRY lazy_glViewportIndexedfv(GLuint index, const GLfloat *v) { glad_glViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC)lazy_load("glViewportIndexedfv"); glad_glViewportIndexedfv(index, v); }
+static void APIENTRY lazy_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) { glad_glScissorArrayv = (PFNGLSCISSORARRAYVPROC)lazy_load("glScissorArrayv"); glad_glScissorArrayv(first, count, v); }
+static void APIENTRY lazy_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) { glad_glScissorIndexed = (PFNGLSCISSORINDEXEDPROC)lazy_load("glScissorIndexed"); glad_glScissorIndexed(index, left, bottom, width, height); }
+static void APIENTRY lazy_glScissorIndexedv(GLuint index, const GLint *v) { glad_glScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC)lazy_load("glScissorIndexedv"); glad_glScissorIndexedv(index, v); }
+static void APIENTRY lazy_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) { glad_glDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC)lazy_load("glDepthRangeArrayv"); glad_glDepthRangeArrayv(first, count, v); }
+static void APIENTRY lazy_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) { glad_glDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC)lazy_load("glDepthRangeIndexed"); glad_glDepthRangeIndexed(index, n, f); }
+static void APIENTRY lazy_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) { glad_glGetFloati_v = (PFNGLGETFLOATI_VPROC)lazy_load("glGetFloati_v"); glad_glGetFloati_v(target, index, data); }
+static void APIENTRY lazy_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) { glad_glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC)lazy_load("glGetDoublei_v"); glad_glGetDoublei_v(target, index, data); }
+static void APIENTRY lazy_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) { glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)lazy_load("glDrawArraysInstancedBaseInstance"); glad_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance); }
+static void APIENTRY lazy_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) { glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)lazy_load("glDrawElementsInstancedBaseInstance"); glad_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance); }
+static void APIENTRY lazy_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) { glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)lazy_load("glDrawElementsInstancedBaseVertexBaseInstance"); glad_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance); }
+static void APIENTRY lazy_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) { glad_glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)lazy_load("glGetInternalformativ"); glad_glGetInternalformativ(target, internalformat, pname, count, params); }
+static void APIENTRY lazy_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) { glad_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)lazy_load("glGetActiveAtomicCounterBufferiv"); glad_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params); }
+static void APIENTRY lazy_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) { glad_glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)lazy_load("glBindImageTexture"); glad_glBindImageTexture(unit, texture, level, layered, layer, access, format); }
+static void APIENTRY lazy_glMemoryBarrier(GLbitfield barriers) { glad_glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)lazy_load("glMemoryBarrier"); glad_glMemoryBarrier(barriers); }
+static void APIENTRY lazy_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) { glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)lazy_load("glTexStorage1D"); glad_glTexStorage1D(target, levels, internalformat, width); }
+static void APIENTRY lazy_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) { glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)lazy_load("glTexStorage2D"); glad_glTexStorage2D(target, levels, internalformat, width, height); }
+static void APIENTRY lazy_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) { glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)lazy_load("glTexStorage3D"); glad_glTexStorage3D(target, levels, internalformat, width, height, depth); }
+static void APIENTRY lazy_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) { glad_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)lazy_load("glDrawTransformFeedbackInstanced"); glad_glDrawTransformFeedbackInstanced(mode, id, instancecount); }
+static void APIENTRY lazy_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) { glad_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)lazy_load("glDrawTransformFeedbackStreamInstanced"); glad_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount); }
+static void APIENTRY lazy_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) { glad_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)lazy_load("glClearBufferData"); glad_glClearBufferData(target, internalformat, format, type, data); }
+static void APIENTRY lazy_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) { glad_glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)lazy_load("glClearBufferSubData"); glad_glClearBufferSubData(target, internalformat, offset, size, format, type, data); }
+static void APIENTRY lazy_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) { glad_glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)lazy_load("glDispatchCompute"); glad_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z); }
+static void APIENTRY lazy_glDispatchComputeIndirect(GLintptr indirect) { glad_glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)lazy_load("glDispatchComputeIndirect"); glad_glDispatchComputeIndirect(indirect); }
+static void APIENTRY lazy_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) { glad_glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)lazy_load("glCopyImageSubData"); glad_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth); }
+static void APIENTRY lazy_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) { glad_glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)lazy_load("glFramebufferParameteri"); glad_glFramebufferParameteri(target, pname, param); }
+static void APIENTRY lazy_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) { glad_glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)lazy_load("glGetFramebufferParameteriv"); glad_glGetFramebufferParameteriv(target, pname, params); }
+static void APIENTRY lazy_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params) { glad_glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)lazy_load("glGetInternalformati64v"); glad_glGetInternalformati64v(target, internalformat, pname, count, params); }
+static void APIENTRY lazy_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) { glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)lazy_load("glInvalidateTexSubImage"); glad_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth); }
+static void APIENTRY lazy_glInvalidateTexImage(GLuint texture, GLint level) { glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)lazy_load("glInvalidateTexImage"); glad_glInvalidateTexImage(texture, level); }
+static void APIENTRY lazy_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) { glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)lazy_load("glInvalidateBufferSubData"); glad_glInvalidateBufferSubData(buffer, offset, length); }
+static void APIENTRY lazy_glInvalidateBufferData(GLuint buffer) { glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)lazy_load("glInvalidateBufferData"); glad_glInvalidateBufferData(buffer); }
+static void APIENTRY lazy_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) { glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)lazy_load("glInvalidateFramebuffer"); glad_glInvalidateFramebuffer(target, numAttachments, attachments); }
+static void APIENTRY lazy_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) { glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)lazy_load("glInvalidateSubFramebuffer"); glad_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height); }
+static void APIENTRY lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) { glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)lazy_load("glMultiDrawArraysIndirect"); glad_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride); }
+static void APIENTRY lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) { glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)lazy_load("glMultiDrawElementsIndirect"); glad_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride); }
+static void APIENTRY lazy_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) { glad_glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)lazy_load("glGetProgramInterfaceiv"); glad_glGetProgramInterfaceiv(program, programInterface, pname, params); }
+static GLuint APIENTRY lazy_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) { glad_glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)lazy_load("glGetProgramResourceIndex"); return glad_glGetProgramResourceIndex(program, programInterface, name); }
+static void APIENTRY lazy_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) { glad_glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)lazy_load("glGetProgramResourceName"); glad_glGetProgramResourceName(program, programInterface, index, bufSize, length, name); }
+static void APIENTRY lazy_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) { glad_glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)lazy_load("glGetProgramResourceiv"); glad_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params); }
+static GLint APIENTRY lazy_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) { glad_glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)lazy_load("glGetProgramResourceLocation"); return glad_glGetProgramResourceLocation(program, programInterface, name); }
+static GLint APIENTRY lazy_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) { glad_glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)lazy_load("glGetProgramResourceLocationIndex"); return glad_glGetProgramResourceLocationIndex(program, programInterface, name); }
+static void APIENTRY lazy_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) { glad_glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)lazy_load("glShaderStorageBlockBinding"); glad_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding); }
+static void APIENTRY lazy_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) { glad_glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)lazy_load("glTexBufferRange"); glad_glTexBufferRange(target, internalformat, buffer, offset, size); }
+static void APIENTRY lazy_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { glad_glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)lazy_load("glTexStorage2DMultisample"); glad_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations); }
+static void APIENTRY lazy_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { glad_glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)lazy_load("glTexStorage3DMultisample"); glad_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations); }
+static void APIENTRY lazy_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) { glad_glTextureView = (PFNGLTEXTUREVIEWPROC)lazy_load("glTextureView"); glad_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers); }
+static void APIENTRY lazy_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) { glad_glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)lazy_load("glBindVertexBuffer"); glad_glBindVertexBuffer(bindingindex, buffer, offset, stride); }
+static void APIENTRY lazy_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) { glad_glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)lazy_load("glVertexAttribFormat"); glad_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset); }
+static void APIENTRY lazy_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) { glad_glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)lazy_load("glVertexAttribIFormat"); glad_glVertexAttribIFormat(attribindex, size, type, relativeoffset); }
+static void APIENTRY lazy_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) { glad_glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)lazy_load("glVertexAttribLFormat"); glad_glVertexAttribLFormat(attribindex, size, type, relativeoffset); }
+static void APIENTRY lazy_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) { glad_glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)lazy_load("glVertexAttribBinding"); glad_glVertexAttribBinding(attribindex, bindingindex); }
+static void APIENTRY lazy_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) { glad_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)lazy_load("glVertexBindingDivisor"); glad_glVertexBindingDivisor(bindingindex, divisor); }
+static void APIENTRY lazy_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) { glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)lazy_load("glDebugMessageControl"); glad_glDebugMessageControl(source, type, severity, count, ids, enabled); }
+static void APIENTRY lazy_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) { glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)lazy_load("glDebugMessageInsert"); glad_glDebugMessageInsert(source, type, id, severity, length, buf); }
+static void APIENTRY lazy_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) { glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)lazy_load("glDebugMessageCallback"); glad_glDebugMessageCallback(callback, userParam); }
+static GLuint APIENTRY lazy_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) { glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)lazy_load("glGetDebugMessageLog"); return glad_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog); }
+static void APIENTRY lazy_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) { glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)lazy_load("glPushDebugGroup"); glad_glPushDebugGroup(source, id, length, message); }
+static void APIENTRY lazy_glPopDebugGroup(void) { glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)lazy_load("glPopDebugGroup"); glad_glPopDebugGroup(); }
+static void APIENTRY lazy_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) { glad_glObjectLabel = (PFNGLOBJECTLABELPROC)lazy_load("glObjectLabel"); glad_glObjectLabel(identifier, name, length, label); }
+static void APIENTRY lazy_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) { glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)lazy_load("glGetObjectLabel"); glad_glGetObjectLabel(identifier, name, bufSize, length, label); }
+static void APIENTRY lazy_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) { glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)lazy_load("glObjectPtrLabel"); glad_glObjectPtrLabel(ptr, length, label); }
+static void APIENTRY lazy_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) { glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)lazy_load("glGetObjectPtrLabel"); glad_glGetObjectPtrLabel(ptr, bufSize, length, label); }
+static void APIENTRY lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) { glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)lazy_load("glBufferStorage"); glad_glBufferStorage(target, size, data, flags); }
+static void APIENTRY lazy_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) { glad_glClearTexImage = (PFNGLCLEARTEXIMAGEPROC)lazy_load("glClearTexImage"); glad_glClearTexImage(texture, level, format, type, data); }
+static void APIENTRY lazy_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) { glad_glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)lazy_load("glClearTexSubImage"); glad_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data); }
+static void APIENTRY lazy_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) { glad_glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)lazy_load("glBindBuffersBase"); glad_glBindBuffersBase(target, first, count, buffers); }
+static void APIENTRY lazy_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) { glad_glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)lazy_load("glBindBuffersRange"); glad_glBindBuffersRange(target, first, count, buffers, offsets, sizes); }
+static void APIENTRY lazy_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) { glad_glBindTextures = (PFNGLBINDTEXTURESPROC)lazy_load("glBindTextures"); glad_glBindTextures(first, count, textures); }
+static void APIENTRY lazy_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) { glad_glBindSamplers = (PFNGLBINDSAMPLERSPROC)lazy_load("glBindSamplers"); glad_glBindSamplers(first, count, samplers); }
+static void APIENTRY lazy_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) { glad_glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)lazy_load("glBindImageTextures"); glad_glBindImageTextures(first, count, textures); }
+static void APIENTRY lazy_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) { glad_glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)lazy_load("glBindVertexBuffers"); glad_glBindVertexBuffers(first, count, buffers, offsets, strides); }
+static void APIENTRY lazy_glClipControl(GLenum origin, GLenum depth) { glad_glClipControl = (PFNGLCLIPCONTROLPROC)lazy_load("glClipControl"); glad_glClipControl(origin, depth); }
+static void APIENTRY lazy_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) { glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)lazy_load("glCreateTransformFeedbacks"); glad_glCreateTransformFeedbacks(n, ids); }
+static void APIENTRY lazy_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) { glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)lazy_load("glTransformFeedbackBufferBase"); glad_glTransformFeedbackBufferBase(xfb, index, buffer); }
+static void APIENTRY lazy_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) { glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)lazy_load("glTransformFeedbackBufferRange"); glad_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size); }
+static void APIENTRY lazy_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) { glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)lazy_load("glGetTransformFeedbackiv"); glad_glGetTransformFeedbackiv(xfb, pname, param); }
+static void APIENTRY lazy_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param) { glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)lazy_load("glGetTransformFeedbacki_v"); glad_glGetTransformFeedbacki_v(xfb, pname, index, param); }
+static void APIENTRY lazy_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param) { glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)lazy_load("glGetTransformFeedbacki64_v"); glad_glGetTransformFeedbacki64_v(xfb, pname, index, param); }
+static void APIENTRY lazy_glCreateBuffers(GLsizei n, GLuint *buffers) { glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)lazy_load("glCreateBuffers"); glad_glCreateBuffers(n, buffers); }
+static void APIENTRY lazy_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) { glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)lazy_load("glNamedBufferStorage"); glad_glNamedBufferStorage(buffer, size, data, flags); }
+static void APIENTRY lazy_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) { glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)lazy_load("glNamedBufferData"); glad_glNamedBufferData(buffer, size, data, usage); }
+static void APIENTRY lazy_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) { glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)lazy_load("glNamedBufferSubData"); glad_glNamedBufferSubData(buffer, offset, size, data); }
+static void APIENTRY lazy_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)lazy_load("glCopyNamedBufferSubData"); glad_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size); }
+static void APIENTRY lazy_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) { glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)lazy_load("glClearNamedBufferData"); glad_glClearNamedBufferData(buffer, internalformat, format, type, data); }
+static void APIENTRY lazy_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) { glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)lazy_load("glClearNamedBufferSubData"); glad_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data); }
+static void * APIENTRY lazy_glMapNamedBuffer(GLuint buffer, GLenum access) { glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)lazy_load("glMapNamedBuffer"); return glad_glMapNamedBuffer(buffer, access); }
+static void * APIENTRY lazy_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) { glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)lazy_load("glMapNamedBufferRange"); return glad_glMapNamedBufferRange(buffer, offset, length, access); }
+static GLboolean APIENTRY lazy_glUnmapNamedBuffer(GLuint buffer) { glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)lazy_load("glUnmapNamedBuffer"); return glad_glUnmapNamedBuffer(buffer); }
+static void APIENTRY lazy_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) { glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)lazy_load("glFlushMappedNamedBufferRange"); glad_glFlushMappedNamedBufferRange(buffer, offset, length); }
+static void APIENTRY lazy_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) { glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)lazy_load("glGetNamedBufferParameteriv"); glad_glGetNamedBufferParameteriv(buffer, pname, params); }
+static void APIENTRY lazy_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) { glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)lazy_load("glGetNamedBufferParameteri64v"); glad_glGetNamedBufferParameteri64v(buffer, pname, params); }
+static void APIENTRY lazy_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) { glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)lazy_load("glGetNamedBufferPointerv"); glad_glGetNamedBufferPointerv(buffer, pname, params); }
+static void APIENTRY lazy_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) { glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)lazy_load("glGetNamedBufferSubData"); glad_glGetNamedBufferSubData(buffer, offset, size, data); }
+static void APIENTRY lazy_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) { glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)lazy_load("glCreateFramebuffers"); glad_glCreateFramebuffers(n, framebuffers); }
+static void APIENTRY lazy_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)lazy_load("glNamedFramebufferRenderbuffer"); glad_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer); }
+static void APIENTRY lazy_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) { glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)lazy_load("glNamedFramebufferParameteri"); glad_glNamedFramebufferParameteri(framebuffer, pname, param); }
+static void APIENTRY lazy_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) { glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)lazy_load("glNamedFramebufferTexture"); glad_glNamedFramebufferTexture(framebuffer, attachment, texture, level); }
+static void APIENTRY lazy_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) { glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)lazy_load("glNamedFramebufferTextureLayer"); glad_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer); }
+static void APIENTRY lazy_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) { glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)lazy_load("glNamedFramebufferDrawBuffer"); glad_glNamedFramebufferDrawBuffer(framebuffer, buf); }
+static void APIENTRY lazy_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) { glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)lazy_load("glNamedFramebufferDrawBuffers"); glad_glNamedFramebufferDrawBuffers(framebuffer, n, bufs); }
+static void APIENTRY lazy_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) { glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)lazy_load("glNamedFramebufferReadBuffer"); glad_glNamedFramebufferReadBuffer(framebuffer, src); }
+static void APIENTRY lazy_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) { glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)lazy_load("glInvalidateNamedFramebufferData"); glad_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments); }
+static void APIENTRY lazy_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) { glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)lazy_load("glInvalidateNamedFramebufferSubData"); glad_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height); }
+static void APIENTRY lazy_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) { glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)lazy_load("glClearNamedFramebufferiv"); glad_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value); }
+static void APIENTRY lazy_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) { glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)lazy_load("glClearNamedFramebufferuiv"); glad_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value); }
+static void APIENTRY lazy_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) { glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)lazy_load("glClearNamedFramebufferfv"); glad_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value); }
+static void APIENTRY lazy_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) { glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)lazy_load("glClearNamedFramebufferfi"); glad_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil); }
+static void APIENTRY lazy_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)lazy_load("glBlitNamedFramebuffer"); glad_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter); }
+static GLenum APIENTRY lazy_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) { glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)lazy_load("glCheckNamedFramebufferStatus"); return glad_glCheckNamedFramebufferStatus(framebuffer, target); }
+static void APIENTRY lazy_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) { glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)lazy_load("glGetNamedFramebufferParameteriv"); glad_glGetNamedFramebufferParameteriv(framebuffer, pname, param); }
+static void APIENTRY lazy_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) { glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)lazy_load("glGetNamedFramebufferAttachmentParameteriv"); glad_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params); }
+static void APIENTRY lazy_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) { glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)lazy_load("glCreateRenderbuffers"); glad_glCreateRenderbuffers(n, renderbuffers); }
+static void APIENTRY lazy_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) { glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)lazy_load("glNamedRenderbufferStorage"); glad_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height); }
+static void APIENTRY lazy_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) { glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)lazy_load("glNamedRenderbufferStorageMultisample"); glad_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height); }
+static void APIENTRY lazy_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) { glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)lazy_load("glGetNamedRenderbufferParameteriv"); glad_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params); }
+static void APIENTRY lazy_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) { glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)lazy_load("glCreateTextures"); glad_glCreateTextures(target, n, textures); }
+static void APIENTRY lazy_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) { glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)lazy_load("glTextureBuffer"); glad_glTextureBuffer(texture, internalformat, buffer); }
+static void APIENTRY lazy_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) { glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)lazy_load("glTextureBufferRange"); glad_glTextureBufferRange(texture, internalformat, buffer, offset, size); }
+static void APIENTRY lazy_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) { glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)lazy_load("glTextureStorage1D"); glad_glTextureStorage1D(texture, levels, internalformat, width); }
+static void APIENTRY lazy_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) { glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)lazy_load("glTextureStorage2D"); glad_glTextureStorage2D(texture, levels, internalformat, width, height); }
+static void APIENTRY lazy_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) { glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)lazy_load("glTextureStorage3D"); glad_glTextureStorage3D(texture, levels, internalformat, width, height, depth); }
+static void APIENTRY lazy_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)lazy_load("glTextureStorage2DMultisample"); glad_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations); }
+static void APIENTRY lazy_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)lazy_load("glTextureStorage3DMultisample"); glad_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations); }
+static void APIENTRY lazy_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) { glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)lazy_load("glTextureSubImage1D"); glad_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels); }
+static void APIENTRY lazy_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)lazy_load("glTextureSubImage2D"); glad_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels); }
+static void APIENTRY lazy_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)lazy_load("glTextureSubImage3D"); glad_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels); }
+static void APIENTRY lazy_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) { glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)lazy_load("glCompressedTextureSubImage1D"); glad_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data); }
+static void APIENTRY lazy_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) { glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)lazy_load("glCompressedTextureSubImage2D"); glad_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data); }
+static void APIENTRY lazy_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) { glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)lazy_load("glCompressedTextureSubImage3D"); glad_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data); }
+static void APIENTRY lazy_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) { glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)lazy_load("glCopyTextureSubImage1D"); glad_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width); }
+static void APIENTRY lazy_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) { glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)lazy_load("glCopyTextureSubImage2D"); glad_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height); }
+static void APIENTRY lazy_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)lazy_load("glCopyTextureSubImage3D"); glad_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height); }
+static void APIENTRY lazy_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) { glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)lazy_load("glTextureParameterf"); glad_glTextureParameterf(texture, pname, param); }
+static void APIENTRY lazy_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) { glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)lazy_load("glTextureParameterfv"); glad_glTextureParameterfv(texture, pname, param); }
+static void APIENTRY lazy_glTextureParameteri(GLuint texture, GLenum pname, GLint param) { glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)lazy_load("glTextureParameteri"); glad_glTextureParameteri(texture, pname, param); }
+static void APIENTRY lazy_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) { glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)lazy_load("glTextureParameterIiv"); glad_glTextureParameterIiv(texture, pname, params); }
+static void APIENTRY lazy_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) { glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)lazy_load("glTextureParameterIuiv"); glad_glTextureParameterIuiv(texture, pname, params); }
+static void APIENTRY lazy_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) { glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)lazy_load("glTextureParameteriv"); glad_glTextureParameteriv(texture, pname, param); }
+static void APIENTRY lazy_glGenerateTextureMipmap(GLuint texture) { glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)lazy_load("glGenerateTextureMipmap"); glad_glGenerateTextureMipmap(texture); }
+static void APIENTRY lazy_glBindTextureUnit(GLuint unit, GLuint texture) { glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)lazy_load("glBindTextureUnit"); glad_glBindTextureUnit(unit, texture); }
+static void APIENTRY lazy_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) { glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)lazy_load("glGetTextureImage"); glad_glGetTextureImage(texture, level, format, type, bufSize, pixels); }
+static void APIENTRY lazy_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) { glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)lazy_load("glGetCompressedTextureImage"); glad_glGetCompressedTextureImage(texture, level, bufSize, pixels); }
+static void APIENTRY lazy_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) { glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)lazy_load("glGetTextureLevelParameterfv"); glad_glGetTextureLevelParameterfv(texture, level, pname, params); }
+static void APIENTRY lazy_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) { glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)lazy_load("glGetTextureLevelParameteriv"); glad_glGetTextureLevelParameteriv(texture, level, pname, params); }
+static void APIENTRY lazy_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) { glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)lazy_load("glGetTextureParameterfv"); glad_glGetTextureParameterfv(texture, pname, params); }
+static void APIENTRY lazy_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) { glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)lazy_load("glGetTextureParameterIiv"); glad_glGetTextureParameterIiv(texture, pname, params); }
+static void APIENTRY lazy_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) { glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)lazy_load("glGetTextureParameterIuiv"); glad_glGetTextureParameterIuiv(texture, pname, params); }
+static void APIENTRY lazy_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) { glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)lazy_load("glGetTextureParameteriv"); glad_glGetTextureParameteriv(texture, pname, params); }
+static void APIENTRY lazy_glCreateVertexArrays(GLsizei n, GLuint *arrays) { glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)lazy_load("glCreateVertexArrays"); glad_glCreateVertexArrays(n, arrays); }
+static void APIENTRY lazy_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) { glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)lazy_load("glDisableVertexArrayAttrib"); glad_glDisableVertexArrayAttrib(vaobj, index); }
+static void APIENTRY lazy_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) { glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)lazy_load("glEnableVertexArrayAttrib"); glad_glEnableVertexArrayAttrib(vaobj, index); }
+static void APIENTRY lazy_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) { glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)lazy_load("glVertexArrayElementBuffer"); glad_glVertexArrayElementBuffer(vaobj, buffer); }
+static void APIENTRY lazy_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) { glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)lazy_load("glVertexArrayVertexBuffer"); glad_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride); }
+static void APIENTRY lazy_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) { glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)lazy_load("glVertexArrayVertexBuffers"); glad_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides); }
+static void APIENTRY lazy_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) { glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)lazy_load("glVertexArrayAttribBinding"); glad_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex); }
+static void APIENTRY lazy_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) { glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)lazy_load("glVertexArrayAttribFormat"); glad_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset); }
+static void APIENTRY lazy_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) { glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)lazy_load("glVertexArrayAttribIFormat"); glad_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset); }
+static void APIENTRY lazy_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) { glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)lazy_load("glVertexArrayAttribLFormat"); glad_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset); }
+static void APIENTRY lazy_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) { glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)lazy_load("glVertexArrayBindingDivisor"); glad_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor); }
+static void APIENTRY lazy_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) { glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)lazy_load("glGetVertexArrayiv"); glad_glGetVertexArrayiv(vaobj, pname, param); }
+static void APIENTRY lazy_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) { glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)lazy_load("glGetVertexArrayIndexediv"); glad_glGetVertexArrayIndexediv(vaobj, index, pname, param); }
+static void APIENTRY lazy_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) { glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)lazy_load("glGetVertexArrayIndexed64iv"); glad_glGetVertexArrayIndexed64iv(vaobj, index, pname, param); }
+static void APIENTRY lazy_glCreateSamplers(GLsizei n, GLuint *samplers) { glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)lazy_load("glCreateSamplers"); glad_glCreateSamplers(n, samplers); }
+static void APIENTRY lazy_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) { glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)lazy_load("glCreateProgramPipelines"); glad_glCreateProgramPipelines(n, pipelines); }
+static void APIENTRY lazy_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) { glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)lazy_load("glCreateQueries"); glad_glCreateQueries(target, n, ids); }
+static void APIENTRY lazy_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) { glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)lazy_load("glGetQueryBufferObjecti64v"); glad_glGetQueryBufferObjecti64v(id, buffer, pname, offset); }
+static void APIENTRY lazy_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) { glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)lazy_load("glGetQueryBufferObjectiv"); glad_glGetQueryBufferObjectiv(id, buffer, pname, offset); }
+static void APIENTRY lazy_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) { glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)lazy_load("glGetQueryBufferObjectui64v"); glad_glGetQueryBufferObjectui64v(id, buffer, pname, offset); }
+static void APIENTRY lazy_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) { glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)lazy_load("glGetQueryBufferObjectuiv"); glad_glGetQueryBufferObjectuiv(id, buffer, pname, offset); }
+static void APIENTRY lazy_glMemoryBarrierByRegion(GLbitfield barriers) { glad_glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)lazy_load("glMemoryBarrierByRegion"); glad_glMemoryBarrierByRegion(barriers); }
+static void APIENTRY lazy_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels) { glad_glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)lazy_load("glGetTextureSubImage"); glad_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels); }
+static void APIENTRY lazy_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels) { glad_glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)lazy_load("glGetCompressedTextureSubImage"); glad_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels); }
+static GLenum APIENTRY lazy_glGetGraphicsResetStatus(void) { glad_glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)lazy_load("glGetGraphicsResetStatus"); return glad_glGetGraphicsResetStatus(); }
+static void APIENTRY lazy_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels) { glad_glGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)lazy_load("glGetnCompressedTexImage"); glad_glGetnCompressedTexImage(target, lod, bufSize, pixels); }
+static void APIENTRY lazy_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) { glad_glGetnTexImage = (PFNGLGETNTEXIMAGEPROC)lazy_load("glGetnTexImage"); glad_glGetnTexImage(target, level, format, type, bufSize, pixels); }
+static void APIENTRY lazy_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) { glad_glGetnUniformdv = (PFNGLGETNUNIFORMDVPROC)lazy_load("glGetnUniformdv"); glad_glGetnUniformdv(program, location, bufSize, params); }
+static void APIENTRY lazy_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) { glad_glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC)lazy_load("glGetnUniformfv"); glad_glGetnUniformfv(program, location, bufSize, params); }
+static void APIENTRY lazy_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) { glad_glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC)lazy_load("glGetnUniformiv"); glad_glGetnUniformiv(program, location, bufSize, params); }
+static void APIENTRY lazy_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) { glad_glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)lazy_load("glGetnUniformuiv"); glad_glGetnUniformuiv(program, location, bufSize, params); }
+static void APIENTRY lazy_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) { glad_glReadnPixels = (PFNGLREADNPIXELSPROC)lazy_load("glReadnPixels"); glad_glReadnPixels(x, y, width, height, format, type, bufSize, data); }
+static void APIENTRY lazy_glTextureBarrier(void) { glad_glTextureBarrier = (PFNGLTEXTUREBARRIERPROC)lazy_load("glTextureBarrier"); glad_glTextureBarrier(); }
+static void APIENTRY lazy_glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue) { glad_glSpecializeShader = (PFNGLSPECIALIZESHADERPROC)lazy_load("glSpecializeShader"); glad_glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue); }
+static void APIENTRY lazy_glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) { glad_glMultiDrawArraysIndirectCount = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)lazy_load("glMultiDrawArraysIndirectCount"); glad_glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride); }
+static void APIENTRY lazy_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) { glad_glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)lazy_load("glMultiDrawElementsIndirectCount"); glad_glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride); }
+static void APIENTRY lazy_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) { glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)lazy_load("glPolygonOffsetClamp"); glad_glPolygonOffsetClamp(factor, units, clamp); }
+static void APIENTRY lazy_glMaxShaderCompilerThreadsKHR(GLuint count) { glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)lazy_load("glMaxShaderCompilerThreadsKHR"); glad_glMaxShaderCompilerThreadsKHR(count); }
+static void lazy_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = lazy_glCullFace;
+	glad_glFrontFace = lazy_glFrontFace;
+	glad_glHint = lazy_glHint;
+	glad_glLineWidth = lazy_glLineWidth;
+	glad_glPointSize = lazy_glPointSize;
+	glad_glPolygonMode = lazy_glPolygonMode;
+	glad_glScissor = lazy_glScissor;
+	glad_glTexParameterf = lazy_glTexParameterf;
+	glad_glTexParameterfv = lazy_glTexParameterfv;
+	glad_glTexParameteri = lazy_glTexParameteri;
+	glad_glTexParameteriv = lazy_glTexParameteriv;
+	glad_glTexImage1D = lazy_glTexImage1D;
+	glad_glTexImage2D = lazy_glTexImage2D;
+	glad_glDrawBuffer = lazy_glDrawBuffer;
+	glad_glClear = lazy_glClear;
+	glad_glClearColor = lazy_glClearColor;
+	glad_glClearStencil = lazy_glClearStencil;
+	glad_glClearDepth = lazy_glClearDepth;
+	glad_glStencilMask = lazy_glStencilMask;
+	glad_glColorMask = lazy_glColorMask;
+	glad_glDepthMask = lazy_glDepthMask;
+	glad_glDisable = lazy_glDisable;
+	glad_glEnable = lazy_glEnable;
+	glad_glFinish = lazy_glFinish;
+	glad_glFlush = lazy_glFlush;
+	glad_glBlendFunc = lazy_glBlendFunc;
+	glad_glLogicOp = lazy_glLogicOp;
+	glad_glStencilFunc = lazy_glStencilFunc;
+	glad_glStencilOp = lazy_glStencilOp;
+	glad_glDepthFunc = lazy_glDepthFunc;
+	glad_glPixelStoref = lazy_glPixelStoref;
+	glad_glPixelStorei = lazy_glPixelStorei;
+	glad_glReadBuffer = lazy_glReadBuffer;
+	glad_glReadPixels = lazy_glReadPixels;
+	glad_glGetBooleanv = lazy_glGetBooleanv;
+	glad_glGetDoublev = lazy_glGetDoublev;
+	glad_glGetError = lazy_glGetError;
+	glad_glGetFloatv = lazy_glGetFloatv;
+	glad_glGetIntegerv = lazy_glGetIntegerv;
+	glad_glGetTexImage = lazy_glGetTexImage;
+	glad_glGetTexParameterfv = lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = lazy_glIsEnabled;
+	glad_glDepthRange = lazy_glDepthRange;
+	glad_glViewport = lazy_glViewport;
+}
+static void lazy_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = lazy_glDrawArrays;
+	glad_glDrawElements = lazy_glDrawElements;
+	glad_glPolygonOffset = lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = lazy_glTexSubImage2D;
+	glad_glBindTexture = lazy_glBindTexture;
+	glad_glDeleteTextures = lazy_glDeleteTextures;
+	glad_glGenTextures = lazy_glGenTextures;
+	glad_glIsTexture = lazy_glIsTexture;
+}
+static void lazy_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = lazy_glDrawRangeElements;
+	glad_glTexImage3D = lazy_glTexImage3D;
+	glad_glTexSubImage3D = lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = lazy_glCopyTexSubImage3D;
+}
+static void lazy_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = lazy_glActiveTexture;
+	glad_glSampleCoverage = lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = lazy_glGetCompressedTexImage;
+}
+static void lazy_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = lazy_glMultiDrawElements;
+	glad_glPointParameterf = lazy_glPointParameterf;
+	glad_glPointParameterfv = lazy_glPointParameterfv;
+	glad_glPointParameteri = lazy_glPointParameteri;
+	glad_glPointParameteriv = lazy_glPointParameteriv;
+	glad_glBlendColor = lazy_glBlendColor;
+	glad_glBlendEquation = lazy_glBlendEquation;
+}
+static void lazy_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = lazy_glGenQueries;
+	glad_glDeleteQueries = lazy_glDeleteQueries;
+	glad_glIsQuery = lazy_glIsQuery;
+	glad_glBeginQuery = lazy_glBeginQuery;
+	glad_glEndQuery = lazy_glEndQuery;
+	glad_glGetQueryiv = lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = lazy_glBindBuffer;
+	glad_glDeleteBuffers = lazy_glDeleteBuffers;
+	glad_glGenBuffers = lazy_glGenBuffers;
+	glad_glIsBuffer = lazy_glIsBuffer;
+	glad_glBufferData = lazy_glBufferData;
+	glad_glBufferSubData = lazy_glBufferSubData;
+	glad_glGetBufferSubData = lazy_glGetBufferSubData;
+	glad_glMapBuffer = lazy_glMapBuffer;
+	glad_glUnmapBuffer = lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = lazy_glGetBufferPointerv;
+}
+static void lazy_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = lazy_glStencilMaskSeparate;
+	glad_glAttachShader = lazy_glAttachShader;
+	glad_glBindAttribLocation = lazy_glBindAttribLocation;
+	glad_glCompileShader = lazy_glCompileShader;
+	glad_glCreateProgram = lazy_glCreateProgram;
+	glad_glCreateShader = lazy_glCreateShader;
+	glad_glDeleteProgram = lazy_glDeleteProgram;
+	glad_glDeleteShader = lazy_glDeleteShader;
+	glad_glDetachShader = lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = lazy_glGetAttribLocation;
+	glad_glGetProgramiv = lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = lazy_glGetShaderSource;
+	glad_glGetUniformLocation = lazy_glGetUniformLocation;
+	glad_glGetUniformfv = lazy_glGetUniformfv;
+	glad_glGetUniformiv = lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = lazy_glIsProgram;
+	glad_glIsShader = lazy_glIsShader;
+	glad_glLinkProgram = lazy_glLinkProgram;
+	glad_glShaderSource = lazy_glShaderSource;
+	glad_glUseProgram = lazy_glUseProgram;
+	glad_glUniform1f = lazy_glUniform1f;
+	glad_glUniform2f = lazy_glUniform2f;
+	glad_glUniform3f = lazy_glUniform3f;
+	glad_glUniform4f = lazy_glUniform4f;
+	glad_glUniform1i = lazy_glUniform1i;
+	glad_glUniform2i = lazy_glUniform2i;
+	glad_glUniform3i = lazy_glUniform3i;
+	glad_glUniform4i = lazy_glUniform4i;
+	glad_glUniform1fv = lazy_glUniform1fv;
+	glad_glUniform2fv = lazy_glUniform2fv;
+	glad_glUniform3fv = lazy_glUniform3fv;
+	glad_glUniform4fv = lazy_glUniform4fv;
+	glad_glUniform1iv = lazy_glUniform1iv;
+	glad_glUniform2iv = lazy_glUniform2iv;
+	glad_glUniform3iv = lazy_glUniform3iv;
+	glad_glUniform4iv = lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = lazy_glValidateProgram;
+	glad_glVertexAttrib1d = lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = lazy_glVertexAttribPointer;
+}
+static void lazy_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = lazy_glUniformMatrix4x3fv;
+}
+static void lazy_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = lazy_glColorMaski;
+	glad_glGetBooleani_v = lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = lazy_glGetIntegeri_v;
+	glad_glEnablei = lazy_glEnablei;
+	glad_glDisablei = lazy_glDisablei;
+	glad_glIsEnabledi = lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = lazy_glBindBufferRange;
+	glad_glBindBufferBase = lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = lazy_glClampColor;
+	glad_glBeginConditionalRender = lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = lazy_glGetFragDataLocation;
+	glad_glUniform1ui = lazy_glUniform1ui;
+	glad_glUniform2ui = lazy_glUniform2ui;
+	glad_glUniform3ui = lazy_glUniform3ui;
+	glad_glUniform4ui = lazy_glUniform4ui;
+	glad_glUniform1uiv = lazy_glUniform1uiv;
+	glad_glUniform2uiv = lazy_glUniform2uiv;
+	glad_glUniform3uiv = lazy_glUniform3uiv;
+	glad_glUniform4uiv = lazy_glUniform4uiv;
+	glad_glTexParameterIiv = lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = lazy_glClearBufferiv;
+	glad_glClearBufferuiv = lazy_glClearBufferuiv;
+	glad_glClearBufferfv = lazy_glClearBufferfv;
+	glad_glClearBufferfi = lazy_glClearBufferfi;
+	glad_glGetStringi = lazy_glGetStringi;
+	glad_glIsRenderbuffer = lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = lazy_glGenVertexArrays;
+	glad_glIsVertexArray = lazy_glIsVertexArray;
+}
+static void lazy_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = lazy_glUniformBlockBinding;
+	glad_glBindBufferRange = lazy_glBindBufferRange;
+	glad_glBindBufferBase = lazy_glBindBufferBase;
+	glad_glGetIntegeri_v = lazy_glGetIntegeri_v;
+}
+static void lazy_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = lazy_glProvokingVertex;
+	glad_glFenceSync = lazy_glFenceSync;
+	glad_glIsSync = lazy_glIsSync;
+	glad_glDeleteSync = lazy_glDeleteSync;
+	glad_glClientWaitSync = lazy_glClientWaitSync;
+	glad_glWaitSync = lazy_glWaitSync;
+	glad_glGetInteger64v = lazy_glGetInteger64v;
+	glad_glGetSynciv = lazy_glGetSynciv;
+	glad_glGetInteger64i_v = lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = lazy_glGetMultisamplefv;
+	glad_glSampleMaski = lazy_glSampleMaski;
+}
+static void lazy_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = lazy_glGetFragDataIndex;
+	glad_glGenSamplers = lazy_glGenSamplers;
+	glad_glDeleteSamplers = lazy_glDeleteSamplers;
+	glad_glIsSampler = lazy_glIsSampler;
+	glad_glBindSampler = lazy_glBindSampler;
+	glad_glSamplerParameteri = lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = lazy_glVertexAttribP4uiv;
+	glad_glVertexP2ui = lazy_glVertexP2ui;
+	glad_glVertexP2uiv = lazy_glVertexP2uiv;
+	glad_glVertexP3ui = lazy_glVertexP3ui;
+	glad_glVertexP3uiv = lazy_glVertexP3uiv;
+	glad_glVertexP4ui = lazy_glVertexP4ui;
+	glad_glVertexP4uiv = lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = lazy_glNormalP3ui;
+	glad_glNormalP3uiv = lazy_glNormalP3uiv;
+	glad_glColorP3ui = lazy_glColorP3ui;
+	glad_glColorP3uiv = lazy_glColorP3uiv;
+	glad_glColorP4ui = lazy_glColorP4ui;
+	glad_glColorP4uiv = lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = lazy_glSecondaryColorP3uiv;
+}
+static void lazy_GL_VERSION_4_0(void) {
+	if(!GLAD_GL_VERSION_4_0) return;
+	glad_glMinSampleShading = lazy_glMinSampleShading;
+	glad_glBlendEquationi = lazy_glBlendEquationi;
+	glad_glBlendEquationSeparatei = lazy_glBlendEquationSeparatei;
+	glad_glBlendFunci = lazy_glBlendFunci;
+	glad_glBlendFuncSeparatei = lazy_glBlendFuncSeparatei;
+	glad_glDrawArraysIndirect = lazy_glDrawArraysIndirect;
+	glad_glDrawElementsIndirect = lazy_glDrawElementsIndirect;
+	glad_glUniform1d = lazy_glUniform1d;
+	glad_glUniform2d = lazy_glUniform2d;
+	glad_glUniform3d = lazy_glUniform3d;
+	glad_glUniform4d = lazy_glUniform4d;
+	glad_glUniform1dv = lazy_glUniform1dv;
+	glad_glUniform2dv = lazy_glUniform2dv;
+	glad_glUniform3dv = lazy_glUniform3dv;
+	glad_glUniform4dv = lazy_glUniform4dv;
+	glad_glUniformMatrix2dv = lazy_glUniformMatrix2dv;
+	glad_glUniformMatrix3dv = lazy_glUniformMatrix3dv;
+	glad_glUniformMatrix4dv = lazy_glUniformMatrix4dv;
+	glad_glUniformMatrix2x3dv = lazy_glUniformMatrix2x3dv;
+	glad_glUniformMatrix2x4dv = lazy_glUniformMatrix2x4dv;
+	glad_glUniformMatrix3x2dv = lazy_glUniformMatrix3x2dv;
+	glad_glUniformMatrix3x4dv = lazy_glUniformMatrix3x4dv;
+	glad_glUniformMatrix4x2dv = lazy_glUniformMatrix4x2dv;
+	glad_glUniformMatrix4x3dv = lazy_glUniformMatrix4x3dv;
+	glad_glGetUniformdv = lazy_glGetUniformdv;
+	glad_glGetSubroutineUniformLocation = lazy_glGetSubroutineUniformLocation;
+	glad_glGetSubroutineIndex = lazy_glGetSubroutineIndex;
+	glad_glGetActiveSubroutineUniformiv = lazy_glGetActiveSubroutineUniformiv;
+	glad_glGetActiveSubroutineUniformName = lazy_glGetActiveSubroutineUniformName;
+	glad_glGetActiveSubroutineName = lazy_glGetActiveSubroutineName;
+	glad_glUniformSubroutinesuiv = lazy_glUniformSubroutinesuiv;
+	glad_glGetUniformSubroutineuiv = lazy_glGetUniformSubroutineuiv;
+	glad_glGetProgramStageiv = lazy_glGetProgramStageiv;
+	glad_glPatchParameteri = lazy_glPatchParameteri;
+	glad_glPatchParameterfv = lazy_glPatchParameterfv;
+	glad_glBindTransformFeedback = lazy_glBindTransformFeedback;
+	glad_glDeleteTransformFeedbacks = lazy_glDeleteTransformFeedbacks;
+	glad_glGenTransformFeedbacks = lazy_glGenTransformFeedbacks;
+	glad_glIsTransformFeedback = lazy_glIsTransformFeedback;
+	glad_glPauseTransformFeedback = lazy_glPauseTransformFeedback;
+	glad_glResumeTransformFeedback = lazy_glResumeTransformFeedback;
+	glad_glDrawTransformFeedback = lazy_glDrawTransformFeedback;
+	glad_glDrawTransformFeedbackStream = lazy_glDrawTransformFeedbackStream;
+	glad_glBeginQueryIndexed = lazy_glBeginQueryIndexed;
+	glad_glEndQueryIndexed = lazy_glEndQueryIndexed;
+	glad_glGetQueryIndexediv = lazy_glGetQueryIndexediv;
+}
+static void lazy_GL_VERSION_4_1(void) {
+	if(!GLAD_GL_VERSION_4_1) return;
+	glad_glReleaseShaderCompiler = lazy_glReleaseShaderCompiler;
+	glad_glShaderBinary = lazy_glShaderBinary;
+	glad_glGetShaderPrecisionFormat = lazy_glGetShaderPrecisionFormat;
+	glad_glDepthRangef = lazy_glDepthRangef;
+	glad_glClearDepthf = lazy_glClearDepthf;
+	glad_glGetProgramBinary = lazy_glGetProgramBinary;
+	glad_glProgramBinary = lazy_glProgramBinary;
+	glad_glProgramParameteri = lazy_glProgramParameteri;
+	glad_glUseProgramStages = lazy_glUseProgramStages;
+	glad_glActiveShaderProgram = lazy_glActiveShaderProgram;
+	glad_glCreateShaderProgramv = lazy_glCreateShaderProgramv;
+	glad_glBindProgramPipeline = lazy_glBindProgramPipeline;
+	glad_glDeleteProgramPipelines = lazy_glDeleteProgramPipelines;
+	glad_glGenProgramPipelines = lazy_glGenProgramPipelines;
+	glad_glIsProgramPipeline = lazy_glIsProgramPipeline;
+	glad_glGetProgramPipelineiv = lazy_glGetProgramPipelineiv;
+	glad_glProgramUniform1i = lazy_glProgramUniform1i;
+	glad_glProgramUniform1iv = lazy_glProgramUniform1iv;
+	glad_glProgramUniform1f = lazy_glProgramUniform1f;
+	glad_glProgramUniform1fv = lazy_glProgramUniform1fv;
+	glad_glProgramUniform1d = lazy_glProgramUniform1d;
+	glad_glProgramUniform1dv = lazy_glProgramUniform1dv;
+	glad_glProgramUniform1ui = lazy_glProgramUniform1ui;
+	glad_glProgramUniform1uiv = lazy_glProgramUniform1uiv;
+	glad_glProgramUniform2i = lazy_glProgramUniform2i;
+	glad_glProgramUniform2iv = lazy_glProgramUniform2iv;
+	glad_glProgramUniform2f = lazy_glProgramUniform2f;
+	glad_glProgramUniform2fv = lazy_glProgramUniform2fv;
+	glad_glProgramUniform2d = lazy_glProgramUniform2d;
+	glad_glProgramUniform2dv = lazy_glProgramUniform2dv;
+	glad_glProgramUniform2ui = lazy_glProgramUniform2ui;
+	glad_glProgramUniform2uiv = lazy_glProgramUniform2uiv;
+	glad_glProgramUniform3i = lazy_glProgramUniform3i;
+	glad_glProgramUniform3iv = lazy_glProgramUniform3iv;
+	glad_glProgramUniform3f = lazy_glProgramUniform3f;
+	glad_glProgramUniform3fv = lazy_glProgramUniform3fv;
+	glad_glProgramUniform3d = lazy_glProgramUniform3d;
+	glad_glProgramUniform3dv = lazy_glProgramUniform3dv;
+	glad_glProgramUniform3ui = lazy_glProgramUniform3ui;
+	glad_glProgramUniform3uiv = lazy_glProgramUniform3uiv;
+	glad_glProgramUniform4i = lazy_glProgramUniform4i;
+	glad_glProgramUniform4iv = lazy_glProgramUniform4iv;
+	glad_glProgramUniform4f = lazy_glProgramUniform4f;
+	glad_glProgramUniform4fv = lazy_glProgramUniform4fv;
+	glad_glProgramUniform4d = lazy_glProgramUniform4d;
+	glad_glProgramUniform4dv = lazy_glProgramUniform4dv;
+	glad_glProgramUniform4ui = lazy_glProgramUniform4ui;
+	glad_glProgramUniform4uiv = lazy_glProgramUniform4uiv;
+	glad_glProgramUniformMatrix2fv = lazy_glProgramUniformMatrix2fv;
+	glad_glProgramUniformMatrix3fv = lazy_glProgramUniformMatrix3fv;
+	glad_glProgramUniformMatrix4fv = lazy_glProgramUniformMatrix4fv;
+	glad_glProgramUniformMatrix2dv = lazy_glProgramUniformMatrix2dv;
+	glad_glProgramUniformMatrix3dv = lazy_glProgramUniformMatrix3dv;
+	glad_glProgramUniformMatrix4dv = lazy_glProgramUniformMatrix4dv;
+	glad_glProgramUniformMatrix2x3fv = lazy_glProgramUniformMatrix2x3fv;
+	glad_glProgramUniformMatrix3x2fv = lazy_glProgramUniformMatrix3x2fv;
+	glad_glProgramUniformMatrix2x4fv = lazy_glProgramUniformMatrix2x4fv;
+	glad_glProgramUniformMatrix4x2fv = lazy_glProgramUniformMatrix4x2fv;
+	glad_glProgramUniformMatrix3x4fv = lazy_glProgramUniformMatrix3x4fv;
+	glad_glProgramUniformMatrix4x3fv = lazy_glProgramUniformMatrix4x3fv;
+	glad_glProgramUniformMatrix2x3dv = lazy_glProgramUniformMatrix2x3dv;
+	glad_glProgramUniformMatrix3x2dv = lazy_glProgramUniformMatrix3x2dv;
+	glad_glProgramUniformMatrix2x4dv = lazy_glProgramUniformMatrix2x4dv;
+	glad_glProgramUniformMatrix4x2dv = lazy_glProgramUniformMatrix4x2dv;
+	glad_glProgramUniformMatrix3x4dv = lazy_glProgramUniformMatrix3x4dv;
+	glad_glProgramUniformMatrix4x3dv = lazy_glProgramUniformMatrix4x3dv;
+	glad_glValidateProgramPipeline = lazy_glValidateProgramPipeline;
+	glad_glGetProgramPipelineInfoLog = lazy_glGetProgramPipelineInfoLog;
+	glad_glVertexAttribL1d = lazy_glVertexAttribL1d;
+	glad_glVertexAttribL2d = lazy_glVertexAttribL2d;
+	glad_glVertexAttribL3d = lazy_glVertexAttribL3d;
+	glad_glVertexAttribL4d = lazy_glVertexAttribL4d;
+	glad_glVertexAttribL1dv = lazy_glVertexAttribL1dv;
+	glad_glVertexAttribL2dv = lazy_glVertexAttribL2dv;
+	glad_glVertexAttribL3dv = lazy_glVertexAttribL3dv;
+	glad_glVertexAttribL4dv = lazy_glVertexAttribL4dv;
+	glad_glVertexAttribLPointer = lazy_glVertexAttribLPointer;
+	glad_glGetVertexAttribLdv = lazy_glGetVertexAttribLdv;
+	glad_glViewportArrayv = lazy_glViewportArrayv;
+	glad_glViewportIndexedf = lazy_glViewportIndexedf;
+	glad_glViewportIndexedfv = lazy_glViewportIndexedfv;
+	glad_glScissorArrayv = lazy_glScissorArrayv;
+	glad_glScissorIndexed = lazy_glScissorIndexed;
+	glad_glScissorIndexedv = lazy_glScissorIndexedv;
+	glad_glDepthRangeArrayv = lazy_glDepthRangeArrayv;
+	glad_glDepthRangeIndexed = lazy_glDepthRangeIndexed;
+	glad_glGetFloati_v = lazy_glGetFloati_v;
+	glad_glGetDoublei_v = lazy_glGetDoublei_v;
+}
+static void lazy_GL_VERSION_4_2(void) {
+	if(!GLAD_GL_VERSION_4_2) return;
+	glad_glDrawArraysInstancedBaseInstance = lazy_glDrawArraysInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseInstance = lazy_glDrawElementsInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = lazy_glDrawElementsInstancedBaseVertexBaseInstance;
+	glad_glGetInternalformativ = lazy_glGetInternalformativ;
+	glad_glGetActiveAtomicCounterBufferiv = lazy_glGetActiveAtomicCounterBufferiv;
+	glad_glBindImageTexture = lazy_glBindImageTexture;
+	glad_glMemoryBarrier = lazy_glMemoryBarrier;
+	glad_glTexStorage1D = lazy_glTexStorage1D;
+	glad_glTexStorage2D = lazy_glTexStorage2D;
+	glad_glTexStorage3D = lazy_glTexStorage3D;
+	glad_glDrawTransformFeedbackInstanced = lazy_glDrawTransformFeedbackInstanced;
+	glad_glDrawTransformFeedbackStreamInstanced = lazy_glDrawTransformFeedbackStreamInstanced;
+}
+static void lazy_GL_VERSION_4_3(void) {
+	if(!GLAD_GL_VERSION_4_3) return;
+	glad_glClearBufferData = lazy_glClearBufferData;
+	glad_glClearBufferSubData = lazy_glClearBufferSubData;
+	glad_glDispatchCompute = lazy_glDispatchCompute;
+	glad_glDispatchComputeIndirect = lazy_glDispatchComputeIndirect;
+	glad_glCopyImageSubData = lazy_glCopyImageSubData;
+	glad_glFramebufferParameteri = lazy_glFramebufferParameteri;
+	glad_glGetFramebufferParameteriv = lazy_glGetFramebufferParameteriv;
+	glad_glGetInternalformati64v = lazy_glGetInternalformati64v;
+	glad_glInvalidateTexSubImage = lazy_glInvalidateTexSubImage;
+	glad_glInvalidateTexImage = lazy_glInvalidateTexImage;
+	glad_glInvalidateBufferSubData = lazy_glInvalidateBufferSubData;
+	glad_glInvalidateBufferData = lazy_glInvalidateBufferData;
+	glad_glInvalidateFramebuffer = lazy_glInvalidateFramebuffer;
+	glad_glInvalidateSubFramebuffer = lazy_glInvalidateSubFramebuffer;
+	glad_glMultiDrawArraysIndirect = lazy_glMultiDrawArraysIndirect;
+	glad_glMultiDrawElementsIndirect = lazy_glMultiDrawElementsIndirect;
+	glad_glGetProgramInterfaceiv = lazy_glGetProgramInterfaceiv;
+	glad_glGetProgramResourceIndex = lazy_glGetProgramResourceIndex;
+	glad_glGetProgramResourceName = lazy_glGetProgramResourceName;
+	glad_glGetProgramResourceiv = lazy_glGetProgramResourceiv;
+	glad_glGetProgramResourceLocation = lazy_glGetProgramResourceLocation;
+	glad_glGetProgramResourceLocationIndex = lazy_glGetProgramResourceLocationIndex;
+	glad_glShaderStorageBlockBinding = lazy_glShaderStorageBlockBinding;
+	glad_glTexBufferRange = lazy_glTexBufferRange;
+	glad_glTexStorage2DMultisample = lazy_glTexStorage2DMultisample;
+	glad_glTexStorage3DMultisample = lazy_glTexStorage3DMultisample;
+	glad_glTextureView = lazy_glTextureView;
+	glad_glBindVertexBuffer = lazy_glBindVertexBuffer;
+	glad_glVertexAttribFormat = lazy_glVertexAttribFormat;
+	glad_glVertexAttribIFormat = lazy_glVertexAttribIFormat;
+	glad_glVertexAttribLFormat = lazy_glVertexAttribLFormat;
+	glad_glVertexAttribBinding = lazy_glVertexAttribBinding;
+	glad_glVertexBindingDivisor = lazy_glVertexBindingDivisor;
+	glad_glDebugMessageControl = lazy_glDebugMessageControl;
+	glad_glDebugMessageInsert = lazy_glDebugMessageInsert;
+	glad_glDebugMessageCallback = lazy_glDebugMessageCallback;
+	glad_glGetDebugMessageLog = lazy_glGetDebugMessageLog;
+	glad_glPushDebugGroup = lazy_glPushDebugGroup;
+	glad_glPopDebugGroup = lazy_glPopDebugGroup;
+	glad_glObjectLabel = lazy_glObjectLabel;
+	glad_glGetObjectLabel = lazy_glGetObjectLabel;
+	glad_glObjectPtrLabel = lazy_glObjectPtrLabel;
+	glad_glGetObjectPtrLabel = lazy_glGetObjectPtrLabel;
+}
+static void lazy_GL_VERSION_4_4(void) {
+	if(!GLAD_GL_VERSION_4_4) return;
+	glad_glBufferStorage = lazy_glBufferStorage;
+	glad_glClearTexImage = lazy_glClearTexImage;
+	glad_glClearTexSubImage = lazy_glClearTexSubImage;
+	glad_glBindBuffersBase = lazy_glBindBuffersBase;
+	glad_glBindBuffersRange = lazy_glBindBuffersRange;
+	glad_glBindTextures = lazy_glBindTextures;
+	glad_glBindSamplers = lazy_glBindSamplers;
+	glad_glBindImageTextures = lazy_glBindImageTextures;
+	glad_glBindVertexBuffers = lazy_glBindVertexBuffers;
+}
+static void lazy_GL_VERSION_4_5(void) {
+	if(!GLAD_GL_VERSION_4_5) return;
+	glad_glClipControl = lazy_glClipControl;
+	glad_glCreateTransformFeedbacks = lazy_glCreateTransformFeedbacks;
+	glad_glTransformFeedbackBufferBase = lazy_glTransformFeedbackBufferBase;
+	glad_glTransformFeedbackBufferRange = lazy_glTransformFeedbackBufferRange;
+	glad_glGetTransformFeedbackiv = lazy_glGetTransformFeedbackiv;
+	glad_glGetTransformFeedbacki_v = lazy_glGetTransformFeedbacki_v;
+	glad_glGetTransformFeedbacki64_v = lazy_glGetTransformFeedbacki64_v;
+	glad_glCreateBuffers = lazy_glCreateBuffers;
+	glad_glNamedBufferStorage = lazy_glNamedBufferStorage;
+	glad_glNamedBufferData = lazy_glNamedBufferData;
+	glad_glNamedBufferSubData = lazy_glNamedBufferSubData;
+	glad_glCopyNamedBufferSubData = lazy_glCopyNamedBufferSubData;
+	glad_glClearNamedBufferData = lazy_glClearNamedBufferData;
+	glad_glClearNamedBufferSubData = lazy_glClearNamedBufferSubData;
+	glad_glMapNamedBuffer = lazy_glMapNamedBuffer;
+	glad_glMapNamedBufferRange = lazy_glMapNamedBufferRange;
+	glad_glUnmapNamedBuffer = lazy_glUnmapNamedBuffer;
+	glad_glFlushMappedNamedBufferRange = lazy_glFlushMappedNamedBufferRange;
+	glad_glGetNamedBufferParameteriv = lazy_glGetNamedBufferParameteriv;
+	glad_glGetNamedBufferParameteri64v = lazy_glGetNamedBufferParameteri64v;
+	glad_glGetNamedBufferPointerv = lazy_glGetNamedBufferPointerv;
+	glad_glGetNamedBufferSubData = lazy_glGetNamedBufferSubData;
+	glad_glCreateFramebuffers = lazy_glCreateFramebuffers;
+	glad_glNamedFramebufferRenderbuffer = lazy_glNamedFramebufferRenderbuffer;
+	glad_glNamedFramebufferParameteri = lazy_glNamedFramebufferParameteri;
+	glad_glNamedFramebufferTexture = lazy_glNamedFramebufferTexture;
+	glad_glNamedFramebufferTextureLayer = lazy_glNamedFramebufferTextureLayer;
+	glad_glNamedFramebufferDrawBuffer = lazy_glNamedFramebufferDrawBuffer;
+	glad_glNamedFramebufferDrawBuffers = lazy_glNamedFramebufferDrawBuffers;
+	glad_glNamedFramebufferReadBuffer = lazy_glNamedFramebufferReadBuffer;
+	glad_glInvalidateNamedFramebufferData = lazy_glInvalidateNamedFramebufferData;
+	glad_glInvalidateNamedFramebufferSubData = lazy_glInvalidateNamedFramebufferSubData;
+	glad_glClearNamedFramebufferiv = lazy_glClearNamedFramebufferiv;
+	glad_glClearNamedFramebufferuiv = lazy_glClearNamedFramebufferuiv;
+	glad_glClearNamedFramebufferfv = lazy_glClearNamedFramebufferfv;
+	glad_glClearNamedFramebufferfi = lazy_glClearNamedFramebufferfi;
+	glad_glBlitNamedFramebuffer = lazy_glBlitNamedFramebuffer;
+	glad_glCheckNamedFramebufferStatus = lazy_glCheckNamedFramebufferStatus;
+	glad_glGetNamedFramebufferParameteriv = lazy_glGetNamedFramebufferParameteriv;
+	glad_glGetNamedFramebufferAttachmentParameteriv = lazy_glGetNamedFramebufferAttachmentParameteriv;
+	glad_glCreateRenderbuffers = lazy_glCreateRenderbuffers;
+	glad_glNamedRenderbufferStorage = lazy_glNamedRenderbufferStorage;
+	glad_glNamedRenderbufferStorageMultisample = lazy_glNamedRenderbufferStorageMultisample;
+	glad_glGetNamedRenderbufferParameteriv = lazy_glGetNamedRenderbufferParameteriv;
+	glad_glCreateTextures = lazy_glCreateTextures;
+	glad_glTextureBuffer = lazy_glTextureBuffer;
+	glad_glTextureBufferRange = lazy_glTextureBufferRange;
+	glad_glTextureStorage1D = lazy_glTextureStorage1D;
+	glad_glTextureStorage2D = lazy_glTextureStorage2D;
+	glad_glTextureStorage3D = lazy_glTextureStorage3D;
+	glad_glTextureStorage2DMultisample = lazy_glTextureStorage2DMultisample;
+	glad_glTextureStorage3DMultisample = lazy_glTextureStorage3DMultisample;
+	glad_glTextureSubImage1D = lazy_glTextureSubImage1D;
+	glad_glTextureSubImage2D = lazy_glTextureSubImage2D;
+	glad_glTextureSubImage3D = lazy_glTextureSubImage3D;
+	glad_glCompressedTextureSubImage1D = lazy_glCompressedTextureSubImage1D;
+	glad_glCompressedTextureSubImage2D = lazy_glCompressedTextureSubImage2D;
+	glad_glCompressedTextureSubImage3D = lazy_glCompressedTextureSubImage3D;
+	glad_glCopyTextureSubImage1D = lazy_glCopyTextureSubImage1D;
+	glad_glCopyTextureSubImage2D = lazy_glCopyTextureSubImage2D;
+	glad_glCopyTextureSubImage3D = lazy_glCopyTextureSubImage3D;
+	glad_glTextureParameterf = lazy_glTextureParameterf;
+	glad_glTextureParameterfv = lazy_glTextureParameterfv;
+	glad_glTextureParameteri = lazy_glTextureParameteri;
+	glad_glTextureParameterIiv = lazy_glTextureParameterIiv;
+	glad_glTextureParameterIuiv = lazy_glTextureParameterIuiv;
+	glad_glTextureParameteriv = lazy_glTextureParameteriv;
+	glad_glGenerateTextureMipmap = lazy_glGenerateTextureMipmap;
+	glad_glBindTextureUnit = lazy_glBindTextureUnit;
+	glad_glGetTextureImage = lazy_glGetTextureImage;
+	glad_glGetCompressedTextureImage = lazy_glGetCompressedTextureImage;
+	glad_glGetTextureLevelParameterfv = lazy_glGetTextureLevelParameterfv;
+	glad_glGetTextureLevelParameteriv = lazy_glGetTextureLevelParameteriv;
+	glad_glGetTextureParameterfv = lazy_glGetTextureParameterfv;
+	glad_glGetTextureParameterIiv = lazy_glGetTextureParameterIiv;
+	glad_glGetTextureParameterIuiv = lazy_glGetTextureParameterIuiv;
+	glad_glGetTextureParameteriv = lazy_glGetTextureParameteriv;
+	glad_glCreateVertexArrays = lazy_glCreateVertexArrays;
+	glad_glDisableVertexArrayAttrib = lazy_glDisableVertexArrayAttrib;
+	glad_glEnableVertexArrayAttrib = lazy_glEnableVertexArrayAttrib;
+	glad_glVertexArrayElementBuffer = lazy_glVertexArrayElementBuffer;
+	glad_glVertexArrayVertexBuffer = lazy_glVertexArrayVertexBuffer;
+	glad_glVertexArrayVertexBuffers = lazy_glVertexArrayVertexBuffers;
+	glad_glVertexArrayAttribBinding = lazy_glVertexArrayAttribBinding;
+	glad_glVertexArrayAttribFormat = lazy_glVertexArrayAttribFormat;
+	glad_glVertexArrayAttribIFormat = lazy_glVertexArrayAttribIFormat;
+	glad_glVertexArrayAttribLFormat = lazy_glVertexArrayAttribLFormat;
+	glad_glVertexArrayBindingDivisor = lazy_glVertexArrayBindingDivisor;
+	glad_glGetVertexArrayiv = lazy_glGetVertexArrayiv;
+	glad_glGetVertexArrayIndexediv = lazy_glGetVertexArrayIndexediv;
+	glad_glGetVertexArrayIndexed64iv = lazy_glGetVertexArrayIndexed64iv;
+	glad_glCreateSamplers = lazy_glCreateSamplers;
+	glad_glCreateProgramPipelines = lazy_glCreateProgramPipelines;
+	glad_glCreateQueries = lazy_glCreateQueries;
+	glad_glGetQueryBufferObjecti64v = lazy_glGetQueryBufferObjecti64v;
+	glad_glGetQueryBufferObjectiv = lazy_glGetQueryBufferObjectiv;
+	glad_glGetQueryBufferObjectui64v = lazy_glGetQueryBufferObjectui64v;
+	glad_glGetQueryBufferObjectuiv = lazy_glGetQueryBufferObjectuiv;
+	glad_glMemoryBarrierByRegion = lazy_glMemoryBarrierByRegion;
+	glad_glGetTextureSubImage = lazy_glGetTextureSubImage;
+	glad_glGetCompressedTextureSubImage = lazy_glGetCompressedTextureSubImage;
+	glad_glGetGraphicsResetStatus = lazy_glGetGraphicsResetStatus;
+	glad_glGetnCompressedTexImage = lazy_glGetnCompressedTexImage;
+	glad_glGetnTexImage = lazy_glGetnTexImage;
+	glad_glGetnUniformdv = lazy_glGetnUniformdv;
+	glad_glGetnUniformfv = lazy_glGetnUniformfv;
+	glad_glGetnUniformiv = lazy_glGetnUniformiv;
+	glad_glGetnUniformuiv = lazy_glGetnUniformuiv;
+	glad_glReadnPixels = lazy_glReadnPixels;
+	glad_glTextureBarrier = lazy_glTextureBarrier;
+}
+static void lazy_GL_VERSION_4_6(void) {
+	if(!GLAD_GL_VERSION_4_6) return;
+	glad_glSpecializeShader = lazy_glSpecializeShader;
+	glad_glMultiDrawArraysIndirectCount = lazy_glMultiDrawArraysIndirectCount;
+	glad_glMultiDrawElementsIndirectCount = lazy_glMultiDrawElementsIndirectCount;
+	glad_glPolygonOffsetClamp = lazy_glPolygonOffsetClamp;
+}
+static void lazy_GL_KHR_parallel_shader_compile(void) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = lazy_glMaxShaderCompilerThreadsKHR;
+}
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
-	(void)&has_ext;
-	free_exts();
+	GLAD_GL_KHR_parallel_shader_compile = has_ext("GL_KHR_parallel_shader_compile");
 	return 1;
 }
 
@@ -1109,9 +3299,16 @@ static void find_coreGL(void) {
 	GLAD_GL_VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
 	GLAD_GL_VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
 	GLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
-	if (GLVersion.major > 3 || (GLVersion.major >= 3 && GLVersion.minor >= 3)) {
-		max_loaded_major = 3;
-		max_loaded_minor = 3;
+	GLAD_GL_VERSION_4_0 = (major == 4 && minor >= 0) || major > 4;
+	GLAD_GL_VERSION_4_1 = (major == 4 && minor >= 1) || major > 4;
+	GLAD_GL_VERSION_4_2 = (major == 4 && minor >= 2) || major > 4;
+	GLAD_GL_VERSION_4_3 = (major == 4 && minor >= 3) || major > 4;
+	GLAD_GL_VERSION_4_4 = (major == 4 && minor >= 4) || major > 4;
+	GLAD_GL_VERSION_4_5 = (major == 4 && minor >= 5) || major > 4;
+	GLAD_GL_VERSION_4_6 = (major == 4 && minor >= 6) || major > 4;
+	if (GLVersion.major > 4 || (GLVersion.major >= 4 && GLVersion.minor >= 6)) {
+		max_loaded_major = 4;
+		max_loaded_minor = 6;
 	}
 }
 
@@ -1133,8 +3330,48 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_3_1(load);
 	load_GL_VERSION_3_2(load);
 	load_GL_VERSION_3_3(load);
+	load_GL_VERSION_4_0(load);
+	load_GL_VERSION_4_1(load);
+	load_GL_VERSION_4_2(load);
+	load_GL_VERSION_4_3(load);
+	load_GL_VERSION_4_4(load);
+	load_GL_VERSION_4_5(load);
+	load_GL_VERSION_4_6(load);
+
+	if (!find_extensionsGL()) return 0;
+	load_GL_KHR_parallel_shader_compile(load);
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	lazy_load = load;
+	find_coreGL();
+	lazy_GL_VERSION_1_0();
+	lazy_GL_VERSION_1_1();
+	lazy_GL_VERSION_1_2();
+	lazy_GL_VERSION_1_3();
+	lazy_GL_VERSION_1_4();
+	lazy_GL_VERSION_1_5();
+	lazy_GL_VERSION_2_0();
+	lazy_GL_VERSION_2_1();
+	lazy_GL_VERSION_3_0();
+	lazy_GL_VERSION_3_1();
+	lazy_GL_VERSION_3_2();
+	lazy_GL_VERSION_3_3();
+	lazy_GL_VERSION_4_0();
+	lazy_GL_VERSION_4_1();
+	lazy_GL_VERSION_4_2();
+	lazy_GL_VERSION_4_3();
+	lazy_GL_VERSION_4_4();
+	lazy_GL_VERSION_4_5();
+	lazy_GL_VERSION_4_6();
 
 	if (!find_extensionsGL()) return 0;
+	lazy_GL_KHR_parallel_shader_compile();
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
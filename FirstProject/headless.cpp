@@ -0,0 +1,256 @@
+#include "headless.h"
+#include "glState.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstring>
+
+#ifdef FIRSTPROJECT_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+static void* eglLoad(const char* name) {
+     return (void*)eglGetProcAddress(name);
+}
+
+// Tries 4.6 core then 3.3 core
+static EGLContext createEGLCoreContext(EGLDisplay display, EGLConfig config, EGLContext shareContext) {
+     const EGLint versions[2][2] = { { 4, 6 }, { 3, 3 } };
+     EGLContext eglContext = EGL_NO_CONTEXT;
+     for (int i = 0; i < 2 && eglContext == EGL_NO_CONTEXT; i++) {
+          const EGLint contextAttribs[] = {
+               EGL_CONTEXT_MAJOR_VERSION, versions[i][0],
+               EGL_CONTEXT_MINOR_VERSION, versions[i][1],
+               EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+               EGL_NONE
+          };
+          eglContext = eglCreateContext(display, config, shareContext, contextAttribs);
+     }
+     return eglContext;
+}
+
+// Everything gets drawn into an FBO, so the surface only exists when the driver can't go without one
+static EGLSurface createEGLSurface(EGLDisplay display, EGLConfig config) {
+     const char* eglExtensions = eglQueryString(display, EGL_EXTENSIONS);
+     bool surfaceless = eglExtensions != NULL && strstr(eglExtensions, "EGL_KHR_surfaceless_context") != NULL;
+     if (surfaceless) {
+          return EGL_NO_SURFACE;
+     }
+     const EGLint pbufferAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+     return eglCreatePbufferSurface(display, config, pbufferAttribs);
+}
+
+static bool createEGLContext(HeadlessContext& context) {
+     // Surfaceless Mesa doesn't need a GPU or a display, fall back to the default display when the extension is missing
+     EGLDisplay display = EGL_NO_DISPLAY;
+     PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+     if (getPlatformDisplay != NULL) {
+          display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+     }
+     if (display == EGL_NO_DISPLAY) {
+          display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+     }
+     if (display == EGL_NO_DISPLAY || !eglInitialize(display, NULL, NULL)) {
+          std::cout << "ERROR::HEADLESS::EGL::NO_DISPLAY" << std::endl;
+          return false;
+     }
+     eglBindAPI(EGL_OPENGL_API);
+
+     const EGLint configAttribs[] = {
+          EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+          EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+          EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+          EGL_NONE
+     };
+     EGLConfig config;
+     EGLint configCount = 0;
+     if (!eglChooseConfig(display, configAttribs, &config, 1, &configCount) || configCount == 0) {
+          std::cout << "ERROR::HEADLESS::EGL::NO_CONFIG" << std::endl;
+          eglTerminate(display);
+          return false;
+     }
+
+     EGLContext eglContext = createEGLCoreContext(display, config, EGL_NO_CONTEXT);
+     if (eglContext == EGL_NO_CONTEXT) {
+          std::cout << "ERROR::HEADLESS::EGL::CONTEXT_CREATION_FAILED" << std::endl;
+          eglTerminate(display);
+          return false;
+     }
+
+     EGLSurface surface = createEGLSurface(display, config);
+     if (!eglMakeCurrent(display, surface, surface, eglContext)) {
+          std::cout << "ERROR::HEADLESS::EGL::MAKE_CURRENT_FAILED" << std::endl;
+          eglDestroyContext(display, eglContext);
+          eglTerminate(display);
+          return false;
+     }
+
+     context.eglDisplay = display;
+     context.eglContext = eglContext;
+     context.eglSurface = surface;
+     context.eglConfig = config;
+     return true;
+}
+#endif
+
+bool createHeadlessContext(HeadlessContext& context) {
+#ifdef FIRSTPROJECT_EGL
+     if (createEGLContext(context)) {
+          return true;
+     }
+     std::cout << "EGL headless context failed, trying a hidden GLFW window" << std::endl;
+#endif
+     // Same hints as the normal window, it just never gets shown
+     glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+     context.window = glfwCreateWindow(1, 1, "Headless", NULL, NULL);
+     if (context.window == NULL) {
+          glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+          glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+          context.window = glfwCreateWindow(1, 1, "Headless", NULL, NULL);
+     }
+     if (context.window == NULL) {
+          std::cout << "ERROR::HEADLESS::GLFW::WINDOW_CREATION_FAILED" << std::endl;
+          return false;
+     }
+     glfwMakeContextCurrent(context.window);
+     return true;
+}
+
+GLADloadproc headlessLoader(const HeadlessContext& context) {
+#ifdef FIRSTPROJECT_EGL
+     if (context.eglContext != NULL) {
+          return eglLoad;
+     }
+#else
+     (void)context;
+#endif
+     return (GLADloadproc)glfwGetProcAddress;
+}
+
+void destroyHeadlessContext(HeadlessContext& context) {
+#ifdef FIRSTPROJECT_EGL
+     if (context.eglContext != NULL) {
+          EGLDisplay display = (EGLDisplay)context.eglDisplay;
+          if (!context.shared) { // A shared one was already released by its own thread, this would drop the main context instead
+               eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+          }
+          if (context.eglSurface != NULL) {
+               eglDestroySurface(display, (EGLSurface)context.eglSurface);
+          }
+          eglDestroyContext(display, (EGLContext)context.eglContext);
+          if (!context.shared) {
+               eglTerminate(display);
+          }
+     }
+#endif
+     if (context.window != NULL) {
+          glfwDestroyWindow(context.window);
+     }
+     context = HeadlessContext();
+}
+
+bool createSharedContext(GLFWwindow* window, const HeadlessContext& main, HeadlessContext& shared) {
+     shared = HeadlessContext();
+     shared.shared = true;
+#ifdef FIRSTPROJECT_EGL
+     if (main.eglContext != NULL) {
+          EGLDisplay display = (EGLDisplay)main.eglDisplay;
+          EGLConfig config = (EGLConfig)main.eglConfig;
+          EGLContext eglContext = createEGLCoreContext(display, config, (EGLContext)main.eglContext);
+          if (eglContext == EGL_NO_CONTEXT) {
+               std::cout << "ERROR::HEADLESS::EGL::SHARED_CONTEXT_CREATION_FAILED" << std::endl;
+               return false;
+          }
+          shared.eglDisplay = display;
+          shared.eglContext = eglContext;
+          shared.eglSurface = createEGLSurface(display, config);
+          shared.eglConfig = config;
+          return true;
+     }
+#else
+     (void)main;
+#endif
+     // GLFW only shares through a window, a hidden 1x1 one is enough, the hints from the main window still apply
+     glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+     shared.window = glfwCreateWindow(1, 1, "Shared", NULL, window);
+     glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+     if (shared.window == NULL) {
+          std::cout << "ERROR::HEADLESS::GLFW::SHARED_CONTEXT_CREATION_FAILED" << std::endl;
+          return false;
+     }
+     return true;
+}
+
+bool makeContextCurrent(const HeadlessContext& context) {
+#ifdef FIRSTPROJECT_EGL
+     if (context.eglContext != NULL) {
+          eglBindAPI(EGL_OPENGL_API); // The bound API is per thread, so a fresh thread starts on GLES
+          return eglMakeCurrent((EGLDisplay)context.eglDisplay, (EGLSurface)context.eglSurface, (EGLSurface)context.eglSurface, (EGLContext)context.eglContext) == EGL_TRUE;
+     }
+#endif
+     glfwMakeContextCurrent(context.window);
+     return context.window != NULL;
+}
+
+void releaseContext(const HeadlessContext& context) {
+#ifdef FIRSTPROJECT_EGL
+     if (context.eglContext != NULL) {
+          eglMakeCurrent((EGLDisplay)context.eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+          return;
+     }
+#endif
+     (void)context;
+     glfwMakeContextCurrent(NULL);
+}
+
+OffscreenTarget createOffscreenTarget(int width, int height) {
+     OffscreenTarget target;
+     target.width = width;
+     target.height = height;
+
+     // A renderbuffer instead of a texture since we only ever draw into it and read it back
+     glGenRenderbuffers(1, &target.colorRBO);
+     glBindRenderbuffer(GL_RENDERBUFFER, target.colorRBO);
+     glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+     glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+     glGenFramebuffers(1, &target.FBO);
+     glState.bindFramebuffer(GL_FRAMEBUFFER, target.FBO);
+     glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, target.colorRBO);
+     if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+          std::cout << "ERROR::HEADLESS::FRAMEBUFFER::INCOMPLETE" << std::endl;
+     }
+     // Left bound, all the headless drawing goes here
+     return target;
+}
+
+void deleteOffscreenTarget(OffscreenTarget& target) {
+     glState.bindFramebuffer(GL_FRAMEBUFFER, 0);
+     glState.forgetFramebuffer(target.FBO);
+     glDeleteFramebuffers(1, &target.FBO);
+     glDeleteRenderbuffers(1, &target.colorRBO);
+     target = OffscreenTarget();
+}
+
+bool dumpOffscreenTarget(const OffscreenTarget& target, const char* path) {
+     std::vector<unsigned char> pixels((size_t)target.width * target.height * 3);
+     glState.bindFramebuffer(GL_READ_FRAMEBUFFER, target.FBO);
+     glPixelStorei(GL_PACK_ALIGNMENT, 1); // Rows of RGB bytes aren't 4 byte aligned for every width
+     glReadPixels(0, 0, target.width, target.height, GL_RGB, GL_UNSIGNED_BYTE, pixels.data());
+
+     std::ofstream file(path, std::ios::binary);
+     if (!file) {
+          std::cout << "ERROR::HEADLESS::DUMP::FILE_NOT_OPENED " << path << std::endl;
+          return false;
+     }
+     file << "P6\n" << target.width << " " << target.height << "\n255\n";
+     // GL's first row is the bottom of the image, PPM's is the top
+     size_t rowBytes = (size_t)target.width * 3;
+     for (int row = target.height - 1; row >= 0; row--) {
+          file.write((const char*)pixels.data() + row * rowBytes, rowBytes);
+     }
+     return true;
+}
@@ -0,0 +1,47 @@
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <cstddef>
+
+// A GL context with nothing on screen, for batch and CI runs
+     // Built with FIRSTPROJECT_EGL it is an EGL surfaceless (or pbuffer) context, which needs no display server at all
+     // Otherwise it is a hidden GLFW window, which still needs a display (Xvfb is enough)
+// Either way works on Mesa's llvmpipe, set LIBGL_ALWAYS_SOFTWARE=1 to force it
+struct HeadlessContext {
+     GLFWwindow* window = NULL;
+     void* eglDisplay = NULL;
+     void* eglContext = NULL;
+     void* eglSurface = NULL;
+     void* eglConfig = NULL;
+     bool shared = false; // Shared contexts borrow the main context's EGL display and leave it alone on destroy
+};
+
+// Tries a 4.6 core context first and falls back to 3.3, the context is current on return
+bool createHeadlessContext(HeadlessContext& context);
+GLADloadproc headlessLoader(const HeadlessContext& context);
+void destroyHeadlessContext(HeadlessContext& context);
+
+// A second context that shares programs, buffers and textures with the main one, so work can be done on another thread
+     // Pass the main window, or the headless context when there isn't one, it comes back not current anywhere
+bool createSharedContext(GLFWwindow* window, const HeadlessContext& main, HeadlessContext& shared);
+// Makes the context current on (or releases it from) the calling thread
+bool makeContextCurrent(const HeadlessContext& context);
+void releaseContext(const HeadlessContext& context);
+
+// Where headless frames get drawn, since there is no default framebuffer worth reading
+struct OffscreenTarget {
+     unsigned int FBO = 0;
+     unsigned int colorRBO = 0;
+     int width = 0;
+     int height = 0;
+};
+
+OffscreenTarget createOffscreenTarget(int width, int height);
+void deleteOffscreenTarget(OffscreenTarget& target);
+
+// Reads the color attachment back and writes it as a binary PPM
+bool dumpOffscreenTarget(const OffscreenTarget& target, const char* path);
+
+#endif
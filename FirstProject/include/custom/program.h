@@ -0,0 +1,100 @@
+#ifndef PROGRAM_H
+#define PROGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+class ProgramCache;
+class ShaderBatch;
+
+// FNV-1a, constexpr so literal names can be hashed by the compiler instead of every frame
+constexpr uint32_t hashUniformName(const char* name, uint32_t hash = 2166136261u) {
+     return *name == '\0' ? hash : hashUniformName(name + 1, (hash ^ (uint8_t)*name) * 16777619u);
+}
+
+// What set() takes, a string literal converts to one implicitly
+     // Declaring it constexpr guarantees the hash is done at compile time: constexpr UniformName color("ourColor");
+struct UniformName {
+     uint32_t hash;
+     const char* name;
+     constexpr UniformName(const char* name) : hash(hashUniformName(name)), name(name) {}
+};
+
+// A linked vertex + fragment shader program made from two shader files
+     // Both files go through preprocessShader(), so they can #include shared code and be specialized on ShaderFeature bits
+     // The files are the copies embedded at build time unless an override folder has them (see embeddedShaders.h)
+class Program {
+public:
+     unsigned int ID = 0;
+
+     // The cache is optional, without one the shaders are always compiled from source
+     Program(const char* vertexPath, const char* fragmentPath, ProgramCache* cache = NULL, unsigned int features = 0);
+     // Only submits the shaders to the batch, ID stays 0 until the first use() needs the program
+     Program(const char* vertexPath, const char* fragmentPath, ShaderBatch& batch, unsigned int features = 0);
+
+     void use();
+     // Deletes the program (waiting for it first if it's still in a batch), the GL context has to still be around
+     void release();
+     // Swaps in a newly linked program and deletes the old one, see shaderReloader.h
+     void replace(unsigned int program);
+
+     // Typed uniform setters, the locations come from a table filled once after linking instead of glGetUniformLocation each call
+          // A value that's the same as the last one set is never uploaded again
+          // Returns false when the program has no active uniform with that name (unused uniforms get optimized out)
+          // On 4.1+ these work whether or not the program is in use, on 3.3 call use() first
+     bool set(UniformName name, int value);
+     bool set(UniformName name, float value);
+     bool set(UniformName name, float x, float y);
+     bool set(UniformName name, float x, float y, float z);
+     bool set(UniformName name, float x, float y, float z, float w);
+     bool setMatrix4(UniformName name, const float* values); // Column major, like GL expects
+
+     // How many set() calls were skipped because the value hadn't changed
+     unsigned long long skippedUploads() const { return skipped; }
+
+private:
+     struct Uniform {
+          uint32_t hash = 0;
+          std::string name; // Two names can share a hash, find() checks this before trusting a match
+          int location = -1; // -1 marks an empty slot
+          unsigned int type = 0;
+          bool valid = false; // Whether value holds what was last uploaded
+          float value[16] = {};
+     };
+
+     void resolve();
+     void reflect();
+     Uniform* find(const UniformName& name);
+     // Copies the value into the cache, false when it's the same as what's already there
+     bool changed(Uniform& uniform, const void* value, size_t bytes);
+
+     ShaderBatch* batch = NULL;
+     int pending = -1;
+
+     std::vector<Uniform> uniforms; // Open addressing, the size is a power of two
+     unsigned long long skipped = 0;
+};
+
+// Every specialization of one vertex + fragment pair, built the first time its feature mask is asked for
+class ShaderVariants {
+public:
+     ShaderVariants(const char* vertexPath, const char* fragmentPath, ShaderBatch& batch);
+
+     // The reference stays valid until release()
+     Program& get(unsigned int features);
+     void release();
+
+     const std::string& vertexPath() const { return vertex; }
+     const std::string& fragmentPath() const { return fragment; }
+
+private:
+     std::string vertex;
+     std::string fragment;
+     ShaderBatch* batch;
+     std::map<unsigned int, Program> variants;
+};
+
+#endif
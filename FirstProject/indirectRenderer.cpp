@@ -0,0 +1,145 @@
+#include "indirectRenderer.h"
+#include "glState.h"
+#include "uniformBlocks.h"
+#include <cstring>
+#include <iostream>
+
+bool IndirectRenderer::supported(RenderPath path) {
+     // The DSA path means 4.5, so multi draw indirect and shader storage are there, gl_DrawID is the only extra
+          // The shaders are #version 330 and read gl_DrawIDARB, so the extension has to be listed even on 4.6 where gl_DrawID is core
+     return path == RenderPath::DSA45 && gladHasExtension("GL_ARB_shader_draw_parameters");
+}
+
+bool IndirectRenderer::init(RenderPath path, size_t maxDraws, size_t drawDataBytes) {
+     gpuPath = supported(path);
+     capacity = maxDraws > 0 ? maxDraws : 1;
+     dataBytes = drawDataBytes;
+     draws.reserve(capacity);
+     drawData.reserve(capacity * dataBytes);
+     if (!gpuPath) {
+          return true;
+     }
+
+     int alignment = 0;
+     glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+     if (alignment > 0) {
+          storageAlignment = (size_t)alignment;
+     }
+
+     // Mutable storage, orphaned every pass so the GPU can still be reading the last one
+     glCreateBuffers(1, &commandBuffer);
+     glNamedBufferData(commandBuffer, capacity * sizeof(DrawElementsIndirectCommand), NULL, GL_STREAM_DRAW);
+     glCreateBuffers(1, &dataBuffer);
+     glNamedBufferData(dataBuffer, capacity * dataBytes + storageAlignment, NULL, GL_STREAM_DRAW);
+     return true;
+}
+
+void IndirectRenderer::shutdown() {
+     for (unsigned int* buffer : { &commandBuffer, &dataBuffer }) {
+          if (*buffer != 0) {
+               glState.forgetBuffer(*buffer);
+               glDeleteBuffers(1, buffer);
+               *buffer = 0;
+          }
+     }
+     draws.clear();
+     drawData.clear();
+}
+
+void IndirectRenderer::add(const PooledMesh& mesh, const void* data) {
+     add(mesh, 0, mesh.indexCount, data);
+}
+
+void IndirectRenderer::add(const PooledMesh& mesh, int first, int count, const void* data) {
+     if (!mesh.valid()) {
+          return;
+     }
+     if (draws.size() == capacity) {
+          overflows++;
+          return;
+     }
+     Draw draw;
+     draw.mesh = mesh;
+     draw.first = first;
+     draw.count = count;
+     draws.push_back(draw);
+     const unsigned char* bytes = (const unsigned char*)data;
+     drawData.insert(drawData.end(), bytes, bytes + dataBytes);
+}
+
+void IndirectRenderer::submit(const MeshPool& pool, const std::function<void(const void* drawData)>& perDraw) {
+     if (draws.empty()) {
+          return;
+     }
+     passes++;
+     drawCount += (long long)draws.size();
+
+     if (gpuPath) {
+          submitMultiDraw(pool);
+     }
+     else {
+          for (size_t i = 0; i < draws.size(); i++) {
+               perDraw(drawData.data() + i * dataBytes);
+               pool.draw(draws[i].mesh, draws[i].first, draws[i].count);
+               calls++;
+          }
+     }
+     draws.clear();
+     drawData.clear();
+}
+
+void IndirectRenderer::submitMultiDraw(const MeshPool& pool) {
+     // One multi draw takes one index type, so 16 bit meshes go first and 32 bit ones after, each run with its own gl_DrawID numbering
+     commands.clear();
+     orderedData.clear();
+     size_t shortDraws = 0;
+     for (int pass = 0; pass < 2; pass++) {
+          GLenum type = pass == 0 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+          GLuint indexSize = pass == 0 ? 2 : 4;
+          if (pass == 1) {
+               shortDraws = commands.size();
+               // The second run's data has to start on a storage buffer offset boundary, gl_DrawID starts from 0 again there
+               orderedData.resize((orderedData.size() + storageAlignment - 1) / storageAlignment * storageAlignment);
+          }
+          for (size_t i = 0; i < draws.size(); i++) {
+               const Draw& draw = draws[i];
+               if (draw.mesh.indexType != type) {
+                    continue;
+               }
+               DrawElementsIndirectCommand command;
+               command.count = (GLuint)draw.count;
+               command.instanceCount = 1;
+               command.firstIndex = (GLuint)(draw.mesh.indexOffset / indexSize) + draw.first;
+               command.baseVertex = draw.mesh.baseVertex;
+               command.baseInstance = 0;
+               commands.push_back(command);
+               const unsigned char* bytes = drawData.data() + i * dataBytes;
+               orderedData.insert(orderedData.end(), bytes, bytes + dataBytes);
+          }
+     }
+     size_t intDataOffset = (shortDraws * dataBytes + storageAlignment - 1) / storageAlignment * storageAlignment;
+
+     glNamedBufferData(commandBuffer, capacity * sizeof(DrawElementsIndirectCommand), NULL, GL_STREAM_DRAW);
+     glNamedBufferSubData(commandBuffer, 0, commands.size() * sizeof(DrawElementsIndirectCommand), commands.data());
+     glNamedBufferData(dataBuffer, capacity * dataBytes + storageAlignment, NULL, GL_STREAM_DRAW);
+     glNamedBufferSubData(dataBuffer, 0, orderedData.size(), orderedData.data());
+
+     glState.bindVertexArray(pool.vertexArray());
+     glState.bindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+     if (shortDraws > 0) {
+          glState.bindBufferRange(GL_SHADER_STORAGE_BUFFER, DrawDataBinding, dataBuffer, 0, shortDraws * dataBytes);
+          glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, (void*)0, (GLsizei)shortDraws, 0);
+          calls++;
+     }
+     size_t intDraws = commands.size() - shortDraws;
+     if (intDraws > 0) {
+          glState.bindBufferRange(GL_SHADER_STORAGE_BUFFER, DrawDataBinding, dataBuffer, intDataOffset, intDraws * dataBytes);
+          glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (void*)(shortDraws * sizeof(DrawElementsIndirectCommand)), (GLsizei)intDraws, 0);
+          calls++;
+     }
+}
+
+void IndirectRenderer::printStats() const {
+     std::cout << "Indirect draws (" << (gpuPath ? "multi draw indirect" : "CPU loop") << "): " << drawCount << " draws in " << passes << " passes, "
+          << calls << " draw calls, " << overflows << " dropped" << std::endl;
+}
@@ -0,0 +1,79 @@
+#ifndef INDIRECT_RENDERER_H
+#define INDIRECT_RENDERER_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "meshPool.h"
+#include "renderPath.h"
+
+// The layout glMultiDrawElementsIndirect reads, one per draw
+struct DrawElementsIndirectCommand {
+     GLuint count;
+     GLuint instanceCount;
+     GLuint firstIndex;    // In indices, not bytes
+     GLint baseVertex;
+     GLuint baseInstance;
+};
+
+static_assert(sizeof(DrawElementsIndirectCommand) == 20, "DrawElementsIndirectCommand has to be tightly packed");
+
+// Collects a pass of draws from one MeshPool and submits the whole pass with one glMultiDrawElementsIndirect
+     // add() writes a command and copies the draw's data (a DrawBlock, or whatever the shader wants), nothing reaches GL until submit()
+     // submit() uploads the commands and the draw data, then one call draws everything, the shader finds its data with gl_DrawID
+     // So the CPU cost of a pass stays the same however many draws are in it
+// Needs 4.3 (indirect multi draw, shader storage) plus gl_DrawID (ARB_shader_draw_parameters), the program needs ShaderFeatureMultiDraw
+// Without them submit() falls back to a loop, calling perDraw with each draw's data before its glDrawElementsBaseVertex
+class IndirectRenderer {
+public:
+     static bool supported(RenderPath path);
+
+     // drawDataBytes is the size of one draw's data, a multiple of 16 so it lines up with a std430 array of vec4/mat4 structs
+     bool init(RenderPath path, size_t maxDraws, size_t drawDataBytes);
+     void shutdown();
+
+     // True when submit() uses one multi draw, pick the program variant with this
+     bool multiDraw() const { return gpuPath; }
+
+     void add(const PooledMesh& mesh, const void* drawData);
+     // Part of a mesh, first and count are in indices
+     void add(const PooledMesh& mesh, int first, int count, const void* drawData);
+
+     // Draws everything added since the last submit with the pool's VAO and whatever program is in use
+     void submit(const MeshPool& pool, const std::function<void(const void* drawData)>& perDraw);
+
+     // Multi draws (or plain draws on the CPU loop) that reached GL so far, one or two a pass on the GPU path
+     long long glCalls() const { return calls; }
+
+     void printStats() const;
+
+private:
+     struct Draw {
+          PooledMesh mesh;
+          int first = 0;
+          int count = 0;
+     };
+
+     void submitMultiDraw(const MeshPool& pool);
+
+     bool gpuPath = false;
+     size_t capacity = 0;
+     size_t dataBytes = 0;
+     size_t storageAlignment = 256;
+     unsigned int commandBuffer = 0;
+     unsigned int dataBuffer = 0;
+     std::vector<Draw> draws;
+     std::vector<unsigned char> drawData;
+
+     // Staging for the upload, kept around so a pass doesn't allocate
+     std::vector<DrawElementsIndirectCommand> commands;
+     std::vector<unsigned char> orderedData;
+
+     long long passes = 0;
+     long long drawCount = 0;
+     long long calls = 0; // Draw calls that actually reached GL
+     long long overflows = 0;
+};
+
+#endif
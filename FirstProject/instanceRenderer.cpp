@@ -0,0 +1,181 @@
+#include "instanceRenderer.h"
+#include "glState.h"
+#include "uniformBlocks.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+bool InstanceRenderer::init(RenderPath path, UniformRing& uniformRing, size_t maxInstances) {
+     this->path = path;
+     this->uniformRing = &uniformRing;
+     capacity = maxInstances > 0 ? maxInstances : 1;
+     baseInstance = GLAD_GL_VERSION_4_2 != 0;
+
+     // Mutable storage, it's orphaned every flush so the GPU can keep reading last frame's copy
+     if (path == RenderPath::DSA45) {
+          glCreateBuffers(1, &buffer);
+          glNamedBufferData(buffer, capacity * sizeof(InstanceData), NULL, GL_STREAM_DRAW);
+     }
+     else {
+          glGenBuffers(1, &buffer);
+          glState.bindBuffer(GL_ARRAY_BUFFER, buffer);
+          glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(InstanceData), NULL, GL_STREAM_DRAW);
+          glState.bindBuffer(GL_ARRAY_BUFFER, 0);
+     }
+     return true;
+}
+
+void InstanceRenderer::shutdown() {
+     if (buffer != 0) {
+          glState.forgetBuffer(buffer);
+          glDeleteBuffers(1, &buffer);
+          buffer = 0;
+     }
+     batches.clear();
+     attachedVAOs.clear();
+     pending = 0;
+}
+
+void InstanceRenderer::submit(Program& program, const Mesh& mesh, const InstanceData& instance) {
+     if (pending == capacity) {
+          flush();
+     }
+
+     // A handful of meshes and programs a frame, a linear search beats hashing here
+     Batch* batch = nullptr;
+     for (Batch& candidate : batches) {
+          if (candidate.program == &program && candidate.mesh.VAO == mesh.VAO) {
+               batch = &candidate;
+               break;
+          }
+     }
+     if (batch == nullptr) {
+          batches.emplace_back();
+          batch = &batches.back();
+          batch->program = &program;
+          batch->mesh = mesh;
+     }
+     batch->instances.push_back(instance);
+     pending++;
+     submitted++;
+}
+
+void InstanceRenderer::attachInstanceAttributes(unsigned int VAO) {
+     if (std::find(attachedVAOs.begin(), attachedVAOs.end(), VAO) != attachedVAOs.end()) {
+          return;
+     }
+     attachedVAOs.push_back(VAO);
+
+     VertexFormat format = vertexFormat<InstanceData>();
+     if (path == RenderPath::DSA45) {
+          glVertexArrayVertexBuffer(VAO, instanceBinding, buffer, 0, format.stride);
+          glVertexArrayBindingDivisor(VAO, instanceBinding, 1); // Advance once per instance instead of once per vertex
+          for (int i = 0; i < format.attributeCount; i++) {
+               setVertexArrayAttribute(VAO, format.attributes[i], instanceBinding, format.attributes[i].offset);
+          }
+     }
+     else {
+          pointInstanceAttributes(VAO, 0);
+     }
+}
+
+void InstanceRenderer::pointInstanceAttributes(unsigned int VAO, size_t offset) {
+     VertexFormat format = vertexFormat<InstanceData>();
+     if (path == RenderPath::DSA45) {
+          glVertexArrayVertexBuffer(VAO, instanceBinding, buffer, (GLintptr)offset, format.stride);
+          return;
+     }
+
+     glState.bindVertexArray(VAO);
+     glState.bindBuffer(GL_ARRAY_BUFFER, buffer);
+     for (int i = 0; i < format.attributeCount; i++) {
+          const VertexAttribute& attribute = format.attributes[i];
+          setVertexAttributePointer(attribute, format.stride, offset + attribute.offset);
+          for (int column = 0; column < attribute.columns; column++) {
+               glVertexAttribDivisor(attribute.location + column, 1);
+          }
+     }
+     glState.bindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void InstanceRenderer::flush() {
+     if (pending == 0 || buffer == 0) {
+          return;
+     }
+     flushes++;
+
+     // Orphan, then one upload per batch into consecutive ranges
+     size_t offset = 0;
+     if (path == RenderPath::DSA45) {
+          glNamedBufferData(buffer, capacity * sizeof(InstanceData), NULL, GL_STREAM_DRAW);
+     }
+     else {
+          glState.bindBuffer(GL_ARRAY_BUFFER, buffer);
+          glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(InstanceData), NULL, GL_STREAM_DRAW);
+     }
+     for (const Batch& batch : batches) {
+          size_t bytes = batch.instances.size() * sizeof(InstanceData);
+          if (bytes == 0) {
+               continue;
+          }
+          if (path == RenderPath::DSA45) {
+               glNamedBufferSubData(buffer, (GLintptr)offset, (GLsizeiptr)bytes, batch.instances.data());
+          }
+          else {
+               glBufferSubData(GL_ARRAY_BUFFER, (GLintptr)offset, (GLsizeiptr)bytes, batch.instances.data());
+          }
+          offset += bytes;
+     }
+     if (path == RenderPath::Bind33) {
+          glState.bindBuffer(GL_ARRAY_BUFFER, 0);
+     }
+
+     GLuint firstInstance = 0;
+     for (Batch& batch : batches) {
+          GLsizei count = (GLsizei)batch.instances.size();
+          if (count == 0) {
+               continue;
+          }
+
+          batch.program->use();
+          DrawBlock drawBlock = makeDrawBlock(NULL, batch.mesh.quantization); // The instance transforms do the placing
+          uniformRing->push(DrawBinding, &drawBlock, sizeof(drawBlock));
+
+          attachInstanceAttributes(batch.mesh.VAO);
+          if (!baseInstance) {
+               // No base instance on this context, so the attributes themselves have to start at this batch
+               pointInstanceAttributes(batch.mesh.VAO, firstInstance * sizeof(InstanceData));
+          }
+          glState.bindVertexArray(batch.mesh.VAO);
+          if (baseInstance) {
+               glDrawElementsInstancedBaseInstance(GL_TRIANGLES, batch.mesh.indexCount, batch.mesh.indexType, 0, count, firstInstance);
+          }
+          else {
+               glDrawElementsInstanced(GL_TRIANGLES, batch.mesh.indexCount, batch.mesh.indexType, 0, count);
+          }
+          draws++;
+          firstInstance += count;
+          batch.instances.clear();
+     }
+     if (path == RenderPath::Bind33) {
+          glState.bindVertexArray(0); // Same as drawMesh, keeps later bind-to-edit code away from these VAOs
+     }
+     pending = 0;
+}
+
+void InstanceRenderer::forgetMesh(const Mesh& mesh) {
+     attachedVAOs.erase(std::remove(attachedVAOs.begin(), attachedVAOs.end(), mesh.VAO), attachedVAOs.end());
+     batches.erase(std::remove_if(batches.begin(), batches.end(), [&](const Batch& batch) {
+          if (batch.mesh.VAO == mesh.VAO) {
+               pending -= batch.instances.size();
+               return true;
+          }
+          return false;
+     }), batches.end());
+}
+
+void InstanceRenderer::printStats() const {
+     double perDraw = draws > 0 ? (double)submitted / draws : 0.0;
+     std::cout << "Instancing: " << submitted << " instances in " << draws << " instanced draws (" << perDraw << " per draw), "
+          << flushes << " flushes" << std::endl;
+}
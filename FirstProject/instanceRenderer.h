@@ -0,0 +1,72 @@
+#ifndef INSTANCE_RENDERER_H
+#define INSTANCE_RENDERER_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <vector>
+#include <custom/program.h>
+#include "renderPath.h"
+#include "uniformRing.h"
+#include "vertexFormat.h"
+
+// What each copy of an instanced mesh gets, read in the vertex shader as attributes with a divisor of 1
+struct InstanceData {
+     float model[4][4]; // Column major, applied before DrawBlock's model
+     float tint[4];     // Multiplies the fragment color
+};
+
+template<> struct VertexLayout<InstanceData> {
+     static constexpr VertexAttribute attributes[] = {
+          VERTEX_ATTRIBUTE(InstanceData, model, 2, false), // locations 2 to 5
+          VERTEX_ATTRIBUTE(InstanceData, tint, 6, false)
+     };
+};
+
+static_assert(vertexFormat<InstanceData>().stride == 80, "InstanceData has padding");
+
+// Draws lots of copies of the same mesh with one glDrawElementsInstanced each, instead of a draw per copy
+     // submit() just records the copy, copies of the same mesh with the same program are gathered up until flush()
+     // flush() uploads every instance into one buffer, then issues one instanced draw per mesh and program
+// The program has to be built with ShaderFeatureInstanced so it reads the per-instance attributes
+// Instance attributes get added to each mesh's own VAO the first time it's drawn instanced, call forgetMesh() before deleting one
+class InstanceRenderer {
+public:
+     // DSA vertex buffer binding for the instance data, clear of the mesh's own (split meshes use one per attribute)
+     static const GLuint instanceBinding = 8;
+
+     // Flushes on its own when maxInstances copies are waiting
+     bool init(RenderPath path, UniformRing& uniformRing, size_t maxInstances);
+     void shutdown();
+
+     void submit(Program& program, const Mesh& mesh, const InstanceData& instance);
+     void flush();
+
+     void forgetMesh(const Mesh& mesh);
+
+     void printStats() const;
+
+private:
+     struct Batch {
+          Program* program = nullptr;
+          Mesh mesh;
+          std::vector<InstanceData> instances; // Emptied by flush, the capacity stays for the next frame
+     };
+
+     void attachInstanceAttributes(unsigned int VAO);
+     void pointInstanceAttributes(unsigned int VAO, size_t offset);
+
+     RenderPath path = RenderPath::Bind33;
+     UniformRing* uniformRing = nullptr;
+     unsigned int buffer = 0;
+     size_t capacity = 0;
+     size_t pending = 0;
+     bool baseInstance = false; // 4.2+, lets every batch start at its own instance without moving the attributes
+     std::vector<Batch> batches;
+     std::vector<unsigned int> attachedVAOs;
+
+     long long submitted = 0;
+     long long draws = 0;
+     long long flushes = 0;
+};
+
+#endif
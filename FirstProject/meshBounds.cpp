@@ -0,0 +1,26 @@
+#include "meshBounds.h"
+#include <cmath>
+
+MeshBounds computeMeshBounds(const PositionColorVertex* vertices, size_t vertexCount) {
+     MeshBounds bounds;
+     if (vertexCount == 0) {
+          return bounds;
+     }
+     for (int axis = 0; axis < 3; axis++) {
+          bounds.low[axis] = bounds.high[axis] = vertices[0].position[axis];
+     }
+     for (size_t i = 1; i < vertexCount; i++) {
+          for (int axis = 0; axis < 3; axis++) {
+               float value = vertices[i].position[axis];
+               bounds.low[axis] = value < bounds.low[axis] ? value : bounds.low[axis];
+               bounds.high[axis] = value > bounds.high[axis] ? value : bounds.high[axis];
+          }
+     }
+     float squaredRadius = 0.0f;
+     for (int axis = 0; axis < 3; axis++) {
+          bounds.center[axis] = (bounds.low[axis] + bounds.high[axis]) * 0.5f;
+          squaredRadius += (bounds.high[axis] - bounds.low[axis]) * (bounds.high[axis] - bounds.low[axis]) * 0.25f;
+     }
+     bounds.radius = std::sqrt(squaredRadius);
+     return bounds;
+}
@@ -0,0 +1,18 @@
+#ifndef MESH_BOUNDS_H
+#define MESH_BOUNDS_H
+
+#include <cstddef>
+#include "vertexFormat.h"
+
+// Object space bounds, for placing a mesh without reading its vertices back
+struct MeshBounds {
+     float low[3] = {};    // Axis aligned box
+     float high[3] = {};
+     float center[3] = {}; // Bounding sphere around the box
+     float radius = 0.0f;
+};
+
+// The box around the positions and the sphere around that box, all zero for no vertices
+MeshBounds computeMeshBounds(const PositionColorVertex* vertices, size_t vertexCount);
+
+#endif
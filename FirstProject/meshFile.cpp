@@ -0,0 +1,226 @@
+#include "meshFile.h"
+#include "meshBounds.h"
+#include "vertexQuantize.h"
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static size_t alignUp(size_t bytes) {
+     return (bytes + meshFileAlignment - 1) / meshFileAlignment * meshFileAlignment;
+}
+
+template<typename Index>
+static bool indicesBelow(const Index* indices, size_t indexCount, uint32_t vertexCount) {
+     Index largest = 0;
+     for (size_t i = 0; i < indexCount; i++) {
+          largest = indices[i] > largest ? indices[i] : largest; // No early out, so the loop stays branch free and vectorizes
+     }
+     return indexCount == 0 || largest < vertexCount;
+}
+
+static bool indicesInRange(const unsigned char* indices, uint32_t indexType, uint32_t indexCount, uint32_t vertexCount) {
+     return indexType == GL_UNSIGNED_SHORT
+          ? indicesBelow((const uint16_t*)indices, indexCount, vertexCount)
+          : indicesBelow((const uint32_t*)indices, indexCount, vertexCount);
+}
+
+MeshFile::~MeshFile() {
+     close();
+}
+
+bool MeshFile::open(const std::string& path, std::string& error) {
+     close();
+#ifdef _WIN32
+     HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+     if (file == INVALID_HANDLE_VALUE) {
+          error = "can't open " + path;
+          return false;
+     }
+     LARGE_INTEGER fileSize;
+     GetFileSizeEx(file, &fileSize);
+     HANDLE mapping = fileSize.QuadPart > 0 ? CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+     const void* view = mapping != NULL ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+     if (view == NULL) {
+          if (mapping != NULL) {
+               CloseHandle(mapping);
+          }
+          CloseHandle(file);
+          error = "can't map " + path;
+          return false;
+     }
+     fileHandle = file;
+     mappingHandle = mapping;
+     data = (const unsigned char*)view;
+     size = (size_t)fileSize.QuadPart;
+#else
+     int fd = ::open(path.c_str(), O_RDONLY);
+     if (fd == -1) {
+          error = "can't open " + path;
+          return false;
+     }
+     struct stat info;
+     void* view = fstat(fd, &info) == 0 && info.st_size > 0 ? mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+     ::close(fd); // The mapping keeps the file alive on its own
+     if (view == MAP_FAILED) {
+          error = "can't map " + path;
+          return false;
+     }
+     data = (const unsigned char*)view;
+     size = (size_t)info.st_size;
+#endif
+
+     const MeshFileHeader& fileHeader = header();
+     bool complete = size >= sizeof(MeshFileHeader); // Nothing in the header is read before this says it's all there
+     size_t indexSize = complete && fileHeader.indexType == GL_UNSIGNED_SHORT ? sizeof(unsigned short) : sizeof(unsigned int);
+     std::string problem;
+     if (!complete || fileHeader.magic != meshFileMagic) {
+          problem = path + " isn't a mesh file";
+     }
+     else if (fileHeader.version != meshFileVersion) {
+          problem = path + " is version " + std::to_string(fileHeader.version) + ", expected " + std::to_string(meshFileVersion);
+     }
+     else if (fileHeader.attributeCount < 1 || fileHeader.attributeCount > (uint32_t)meshFileMaxAttributes
+          || fileHeader.attributesOffset + fileHeader.attributeCount * sizeof(MeshFileAttribute) > size
+          || fileHeader.vertexOffset + fileHeader.vertexBytes > size || fileHeader.indexOffset + fileHeader.indexBytes > size
+          || fileHeader.vertexBytes != (uint64_t)fileHeader.vertexCount * fileHeader.vertexStride
+          || (fileHeader.indexType != GL_UNSIGNED_SHORT && fileHeader.indexType != GL_UNSIGNED_INT)
+          || fileHeader.indexBytes != (uint64_t)fileHeader.indexCount * indexSize
+          || fileHeader.vertexOffset % meshFileAlignment != 0 || fileHeader.indexOffset % meshFileAlignment != 0) {
+          problem = path + " is truncated or corrupt";
+     }
+     else if (!indicesInRange(data + fileHeader.indexOffset, fileHeader.indexType, fileHeader.indexCount, fileHeader.vertexCount)) {
+          problem = path + " has an index past its last vertex";
+     }
+     if (!problem.empty()) {
+          error = problem;
+          close();
+          return false;
+     }
+
+     const MeshFileAttribute* fileAttributes = (const MeshFileAttribute*)(data + fileHeader.attributesOffset);
+     for (uint32_t i = 0; i < fileHeader.attributeCount; i++) {
+          attributes[i].location = fileAttributes[i].location;
+          attributes[i].components = (GLint)fileAttributes[i].components;
+          attributes[i].type = fileAttributes[i].type;
+          attributes[i].normalized = fileAttributes[i].normalized ? GL_TRUE : GL_FALSE;
+          attributes[i].offset = fileAttributes[i].offset;
+          attributes[i].bytes = fileAttributes[i].bytes;
+          attributes[i].columns = (GLint)fileAttributes[i].columns;
+     }
+     layout.attributes = attributes;
+     layout.attributeCount = (int)fileHeader.attributeCount;
+     layout.stride = (GLsizei)fileHeader.vertexStride;
+     return true;
+}
+
+void MeshFile::close() {
+     if (data == NULL) {
+          return;
+     }
+#ifdef _WIN32
+     UnmapViewOfFile(data);
+     CloseHandle(mappingHandle);
+     CloseHandle(fileHandle);
+     mappingHandle = fileHandle = NULL;
+#else
+     munmap((void*)data, size);
+#endif
+     data = NULL;
+     size = 0;
+}
+
+PositionQuantization MeshFile::quantization() const {
+     PositionQuantization quantization;
+     memcpy(quantization.scale, header().positionScale, sizeof(quantization.scale));
+     memcpy(quantization.bias, header().positionBias, sizeof(quantization.bias));
+     return quantization;
+}
+
+bool MeshFile::matches(const VertexFormat& format) const {
+     if (format.stride != layout.stride || format.attributeCount != layout.attributeCount) {
+          return false;
+     }
+     for (int i = 0; i < format.attributeCount; i++) {
+          const VertexAttribute& a = format.attributes[i];
+          const VertexAttribute& b = layout.attributes[i];
+          if (a.location != b.location || a.components != b.components || a.type != b.type || a.normalized != b.normalized
+               || a.offset != b.offset || a.bytes != b.bytes || a.columns != b.columns) {
+               return false;
+          }
+     }
+     return true;
+}
+
+bool writeMeshFile(const std::string& path, const PositionColorVertex* vertices, size_t vertexCount, const unsigned int* indices, size_t indexCount,
+     bool compact, std::string& error) {
+     MeshFileHeader header = {};
+     header.magic = meshFileMagic;
+     header.version = meshFileVersion;
+     header.vertexCount = (uint32_t)vertexCount;
+     header.indexCount = (uint32_t)indexCount;
+
+     // Bounds come from the float positions, before quantizing rounds them
+     MeshBounds bounds = computeMeshBounds(vertices, vertexCount);
+     memcpy(header.boundsCenter, bounds.center, sizeof(header.boundsCenter));
+     header.boundsRadius = bounds.radius;
+
+     QuantizedVertices quantized;
+     const void* vertexData = vertices;
+     VertexFormat format = vertexFormat<PositionColorVertex>();
+     PositionQuantization quantization;
+     if (compact) {
+          quantized = quantizeVertices(vertices, vertexCount);
+          vertexData = quantized.vertices.data();
+          format = vertexFormat<CompactVertex>();
+          quantization = quantized.quantization;
+     }
+     memcpy(header.positionScale, quantization.scale, sizeof(header.positionScale));
+     memcpy(header.positionBias, quantization.bias, sizeof(header.positionBias));
+
+     std::vector<unsigned short> shortIndices;
+     const void* indexData = indices;
+     header.indexType = pooledIndexType(vertexCount);
+     if (header.indexType == GL_UNSIGNED_SHORT) {
+          shortIndices.assign(indices, indices + indexCount);
+          indexData = shortIndices.data();
+     }
+     size_t indexSize = header.indexType == GL_UNSIGNED_SHORT ? sizeof(unsigned short) : sizeof(unsigned int);
+
+     header.vertexStride = (uint32_t)format.stride;
+     header.attributeCount = (uint32_t)format.attributeCount;
+     header.attributesOffset = (uint32_t)alignUp(sizeof(MeshFileHeader));
+     header.vertexOffset = alignUp(header.attributesOffset + format.attributeCount * sizeof(MeshFileAttribute));
+     header.vertexBytes = (uint64_t)vertexCount * format.stride;
+     header.indexOffset = alignUp((size_t)(header.vertexOffset + header.vertexBytes));
+     header.indexBytes = (uint64_t)indexCount * indexSize;
+
+     std::vector<unsigned char> bytes((size_t)(header.indexOffset + header.indexBytes), 0);
+     memcpy(bytes.data(), &header, sizeof(header));
+     MeshFileAttribute* fileAttributes = (MeshFileAttribute*)(bytes.data() + header.attributesOffset);
+     for (int i = 0; i < format.attributeCount; i++) {
+          const VertexAttribute& attribute = format.attributes[i];
+          fileAttributes[i] = { attribute.location, (uint32_t)attribute.components, attribute.type, attribute.normalized ? 1u : 0u,
+               attribute.offset, attribute.bytes, (uint32_t)attribute.columns, 0 };
+     }
+     memcpy(bytes.data() + header.vertexOffset, vertexData, (size_t)header.vertexBytes);
+     memcpy(bytes.data() + header.indexOffset, indexData, (size_t)header.indexBytes);
+
+     std::ofstream file(path, std::ios::binary);
+     file.write((const char*)bytes.data(), (std::streamsize)bytes.size());
+     if (!file) {
+          error = "can't write " + path;
+          return false;
+     }
+     return true;
+}
@@ -0,0 +1,91 @@
+#ifndef MESH_FILE_H
+#define MESH_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "vertexFormat.h"
+
+// Binary mesh files (.mesh), made by MeshConvert from OBJ files
+     // Laid out so a memory mapped file can be handed to GL as it is, with no parse step and no copy on the CPU
+     // Only the format lives here, no GL calls, so MeshConvert builds without a context (createMesh in renderPath.h uploads one)
+     // MeshFileHeader, then MeshFileAttribute[attributeCount] (the vertex layout), then the vertex stream, then the index stream
+     // Every section starts on a meshFileAlignment boundary, everything is little endian
+     // Vertices are interleaved as the layout says (usually CompactVertex), indices are already 16 bit when the mesh is small enough
+
+const uint32_t meshFileMagic = 0x48534D46; // "FMSH"
+const uint32_t meshFileVersion = 1;
+const size_t meshFileAlignment = 64;
+const int meshFileMaxAttributes = 8;
+
+struct MeshFileHeader {
+     uint32_t magic;
+     uint32_t version;
+     uint32_t vertexCount;
+     uint32_t indexCount;
+     uint32_t vertexStride;
+     uint32_t indexType;        // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+     uint32_t attributeCount;
+     uint32_t attributesOffset;
+     uint64_t vertexOffset;     // Bytes from the start of the file
+     uint64_t vertexBytes;
+     uint64_t indexOffset;
+     uint64_t indexBytes;
+     float positionScale[4];    // PositionQuantization, the identity for float positions
+     float positionBias[4];
+     float boundsCenter[3];     // Bounding sphere in object space
+     float boundsRadius;
+};
+
+// VertexAttribute with fixed size fields
+struct MeshFileAttribute {
+     uint32_t location;
+     uint32_t components;
+     uint32_t type;
+     uint32_t normalized;
+     uint32_t offset;
+     uint32_t bytes;
+     uint32_t columns;
+     uint32_t reserved;
+};
+
+static_assert(sizeof(MeshFileHeader) == 112, "MeshFileHeader has padding");
+static_assert(sizeof(MeshFileAttribute) == 32, "MeshFileAttribute has padding");
+
+// A .mesh file mapped into memory, the pointers stay valid until close()
+class MeshFile {
+public:
+     MeshFile() = default;
+     ~MeshFile();
+     MeshFile(const MeshFile&) = delete;
+     MeshFile& operator=(const MeshFile&) = delete;
+
+     // Checks the header, that every section is inside the file and that every index names a vertex the file has
+          // The vertices aren't read, the indices are scanned once since a bad one would reach the GPU as it is
+     bool open(const std::string& path, std::string& error);
+     void close();
+
+     const MeshFileHeader& header() const { return *(const MeshFileHeader*)data; }
+     const VertexFormat& format() const { return layout; }
+     const void* vertices() const { return data + header().vertexOffset; }
+     const void* indices() const { return data + header().indexOffset; }
+     PositionQuantization quantization() const;
+     // Same stride and attributes, what a MeshPool needs before it takes the vertices
+     bool matches(const VertexFormat& format) const;
+
+private:
+     const unsigned char* data = NULL;
+     size_t size = 0;
+     VertexAttribute attributes[meshFileMaxAttributes];
+     VertexFormat layout;
+#ifdef _WIN32
+     void* fileHandle = NULL;
+     void* mappingHandle = NULL;
+#endif
+};
+
+// Optionally quantizes to CompactVertex, works out the bounds and narrows the indices, then writes the file
+bool writeMeshFile(const std::string& path, const PositionColorVertex* vertices, size_t vertexCount, const unsigned int* indices, size_t indexCount,
+     bool compact, std::string& error);
+
+#endif
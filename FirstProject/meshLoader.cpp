@@ -0,0 +1,253 @@
+#include "meshLoader.h"
+#include "glState.h"
+#include "meshOptimize.h"
+#include "objLoader.h"
+#include "vertexQuantize.h"
+#include <cstring>
+#include <iostream>
+
+MeshLoader::~MeshLoader() {
+     shutdown();
+}
+
+bool MeshLoader::init(RenderPath path, const MeshLoaderSettings& settings) {
+     this->path = path;
+     this->settings = settings;
+     if (this->settings.queueCapacity < 1) {
+          this->settings.queueCapacity = 1;
+     }
+     VertexFormat format = settings.compactVertices ? vertexFormat<CompactVertex>() : vertexFormat<PositionColorVertex>();
+     meshPool.init(path, format, settings.vertexCapacityBytes, settings.indexCapacityBytes);
+
+     if (GLAD_GL_VERSION_4_4) {
+          const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+          size_t totalBytes = settings.uploadBudgetBytes * regions;
+          glGenBuffers(1, &staging);
+          glState.bindBuffer(GL_COPY_READ_BUFFER, staging);
+          glBufferStorage(GL_COPY_READ_BUFFER, totalBytes, NULL, flags);
+          mapped = (unsigned char*)glMapBufferRange(GL_COPY_READ_BUFFER, 0, totalBytes, flags);
+          if (mapped == NULL) {
+               // Not fatal, uploads go through glBufferSubData instead
+               std::cout << "ERROR::MESH_LOADER::MAP_FAILED" << std::endl;
+               glState.forgetBuffer(staging);
+               glDeleteBuffers(1, &staging);
+               staging = 0;
+          }
+          persistent = mapped != NULL;
+     }
+
+     workers.start(settings.workers, this->settings.queueCapacity, [this](const Request& request) { return parse(request); });
+     return true;
+}
+
+void MeshLoader::shutdown() {
+     if (!workers.running()) {
+          return;
+     }
+     workers.stop();
+     current = ParsedMesh();
+     uploading = false;
+
+     fences.release();
+     if (staging != 0) {
+          glState.bindBuffer(GL_COPY_READ_BUFFER, staging);
+          glUnmapBuffer(GL_COPY_READ_BUFFER);
+          glState.forgetBuffer(staging);
+          glDeleteBuffers(1, &staging);
+          staging = 0;
+          mapped = NULL;
+     }
+     meshPool.shutdown();
+}
+
+int MeshLoader::load(const std::string& path) {
+     int handle = (int)slots.size();
+     Slot slot;
+     slot.path = path;
+     slots.push_back(slot);
+     loading++;
+     workers.push({ handle, path });
+     return handle;
+}
+
+MeshLoader::ParsedMesh MeshLoader::parse(const Request& request) const {
+     ParsedMesh mesh;
+     mesh.handle = request.handle;
+     if (request.path.size() > 5 && request.path.compare(request.path.size() - 5, 5, ".mesh") == 0) {
+          mesh.file.reset(new MeshFile());
+          if (!mesh.file->open(request.path, mesh.error)) {
+               return mesh;
+          }
+          const MeshFileHeader& header = mesh.file->header();
+          if (!mesh.file->matches(meshPool.vertexFormat())) {
+               mesh.error = settings.compactVertices ? "vertex layout isn't CompactVertex" : "vertex layout isn't PositionColorVertex (convert it with --float)";
+               return mesh;
+          }
+          if (header.indexType != pooledIndexType(header.vertexCount)) {
+               mesh.error = "index type doesn't match the vertex count";
+               return mesh;
+          }
+          mesh.vertexCount = header.vertexCount;
+          mesh.indexCount = header.indexCount;
+          mesh.vertices = (const unsigned char*)mesh.file->vertices();
+          mesh.vertexBytes = (size_t)header.vertexBytes;
+          mesh.indices = (const unsigned char*)mesh.file->indices();
+          mesh.indexBytes = (size_t)header.indexBytes;
+          mesh.quantization = mesh.file->quantization();
+          memcpy(mesh.bounds.center, header.boundsCenter, sizeof(mesh.bounds.center));
+          mesh.bounds.radius = header.boundsRadius;
+          mesh.lods = singleLevelChain((int)header.indexCount);
+          return mesh;
+     }
+
+     std::vector<PositionColorVertex> vertices;
+     std::vector<unsigned int> indices;
+     if (!loadObj(request.path, vertices, indices, mesh.error)) {
+          return mesh;
+     }
+     if (settings.lodLevels > 1) {
+          mesh.lods = optimizeMeshWithLods(vertices, indices, settings.lodLevels);
+     }
+     else {
+          if (settings.optimize) {
+               optimizeMesh(vertices, indices);
+          }
+          mesh.lods = singleLevelChain((int)indices.size());
+     }
+
+     mesh.bounds = computeMeshBounds(vertices.data(), vertices.size());
+
+     mesh.vertexCount = vertices.size();
+     mesh.indexCount = indices.size();
+     if (settings.compactVertices) {
+          QuantizedVertices quantized = quantizeVertices(vertices.data(), vertices.size());
+          const unsigned char* bytes = (const unsigned char*)quantized.vertices.data();
+          mesh.vertexData.assign(bytes, bytes + quantized.vertices.size() * sizeof(CompactVertex));
+          mesh.quantization = quantized.quantization;
+     }
+     else {
+          const unsigned char* bytes = (const unsigned char*)vertices.data();
+          mesh.vertexData.assign(bytes, bytes + vertices.size() * sizeof(PositionColorVertex));
+     }
+
+     // Narrowed here so the GL thread only ever copies bytes
+     if (pooledIndexType(mesh.vertexCount) == GL_UNSIGNED_SHORT) {
+          mesh.indexData.resize(indices.size() * sizeof(unsigned short));
+          unsigned short* shortIndices = (unsigned short*)mesh.indexData.data();
+          for (size_t i = 0; i < indices.size(); i++) {
+               shortIndices[i] = (unsigned short)indices[i];
+          }
+     }
+     else {
+          const unsigned char* bytes = (const unsigned char*)indices.data();
+          mesh.indexData.assign(bytes, bytes + indices.size() * sizeof(unsigned int));
+     }
+     mesh.vertices = mesh.vertexData.data();
+     mesh.vertexBytes = mesh.vertexData.size();
+     mesh.indices = mesh.indexData.data();
+     mesh.indexBytes = mesh.indexData.size();
+     return mesh;
+}
+
+// Takes the next parsed mesh off the queue and claims its room in the pool, false when nothing is waiting
+bool MeshLoader::startUpload() {
+     while (workers.pop(current)) {
+          Slot& slot = slots[current.handle];
+          if (current.error.empty()) {
+               slot.mesh = meshPool.reserve(current.vertexCount, current.indexCount);
+               if (!slot.mesh.valid()) {
+                    current.error = "doesn't fit in the mesh pool";
+               }
+          }
+          if (!current.error.empty()) {
+               std::cout << "ERROR::MESH_LOADER::LOAD_FAILED " << slot.path << ": " << current.error << std::endl;
+               slot.state = MeshLoadState::Failed;
+               loading--;
+               failedCount++;
+               continue;
+          }
+          slot.mesh.quantization = current.quantization;
+          slot.bounds = current.bounds;
+          slot.lods = current.lods;
+          slot.mesh.indexCount = current.lods.levels[0].indexCount;
+          vertexBytesDone = 0;
+          indexBytesDone = 0;
+          uploading = true;
+          return true;
+     }
+     return false;
+}
+
+void MeshLoader::uploadChunk(unsigned int buffer, size_t offset, const unsigned char* data, size_t bytes) {
+     if (mapped != NULL) {
+          size_t stagingOffset = settings.uploadBudgetBytes * fences.region() + regionUsed;
+          memcpy(mapped + stagingOffset, data, bytes);
+          if (path == RenderPath::DSA45) {
+               glCopyNamedBufferSubData(staging, buffer, (GLintptr)stagingOffset, (GLintptr)offset, (GLsizeiptr)bytes);
+          }
+          else {
+               glState.bindBuffer(GL_COPY_READ_BUFFER, staging);
+               glState.bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+               glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, (GLintptr)stagingOffset, (GLintptr)offset, (GLsizeiptr)bytes);
+          }
+     }
+     else {
+          glState.bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+          glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)offset, (GLsizeiptr)bytes, data);
+     }
+     regionUsed += bytes;
+}
+
+void MeshLoader::update() {
+     if (!workers.running() || loading == 0) {
+          return;
+     }
+     frames++;
+
+     // Waiting here would put the GPU's backlog into this frame's time, trying again next frame doesn't
+     if (mapped != NULL && !fences.advance(false)) {
+          return;
+     }
+     regionUsed = 0;
+
+     while (regionUsed < settings.uploadBudgetBytes) {
+          if (!uploading && !startUpload()) {
+               break;
+          }
+          Slot& slot = slots[current.handle];
+          size_t room = settings.uploadBudgetBytes - regionUsed;
+          if (vertexBytesDone < current.vertexBytes) {
+               size_t bytes = current.vertexBytes - vertexBytesDone < room ? current.vertexBytes - vertexBytesDone : room;
+               uploadChunk(meshPool.vertexBuffer(), slot.mesh.vertexOffset + vertexBytesDone, current.vertices + vertexBytesDone, bytes);
+               vertexBytesDone += bytes;
+               continue;
+          }
+          if (indexBytesDone < current.indexBytes) {
+               size_t bytes = current.indexBytes - indexBytesDone < room ? current.indexBytes - indexBytesDone : room;
+               uploadChunk(meshPool.indexBuffer(), slot.mesh.indexOffset + indexBytesDone, current.indices + indexBytesDone, bytes);
+               indexBytesDone += bytes;
+               continue;
+          }
+          // Draws are queued after the copies, so the mesh can be drawn as soon as the last one is issued
+          slot.state = MeshLoadState::Ready;
+          loading--;
+          readyCount++;
+          current = ParsedMesh();
+          uploading = false;
+     }
+
+     if (regionUsed > 0) {
+          uploadFrames++;
+          bytesUploaded += (long long)regionUsed;
+          maxFrameBytes = regionUsed > maxFrameBytes ? regionUsed : maxFrameBytes;
+          if (mapped != NULL) {
+               fences.fence();
+          }
+     }
+}
+
+void MeshLoader::printStats() const {
+     std::cout << "Mesh loader (" << workers.workerCount() << " workers, " << (persistent ? "mapped staging" : "glBufferSubData") << "): "
+          << readyCount << " ready, " << failedCount << " failed, " << bytesUploaded << " bytes over " << uploadFrames << " frames, at most "
+          << maxFrameBytes << " in one, " << fences.stalls() << " frames skipped waiting on the GPU" << std::endl;
+}
@@ -0,0 +1,136 @@
+#ifndef MESH_LOADER_H
+#define MESH_LOADER_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "frameFences.h"
+#include "meshBounds.h"
+#include "meshFile.h"
+#include "meshLod.h"
+#include "meshPool.h"
+#include "renderPath.h"
+#include "workerPool.h"
+
+enum class MeshLoadState {
+     Loading,  // Queued, parsing on a worker, or partway through its upload
+     Ready,    // Fully uploaded, safe to draw
+     Failed    // Didn't parse or didn't fit in the pool, never becomes ready
+};
+
+struct MeshLoaderSettings {
+     int workers = 0;                       // Parsing threads, 0 picks one less than the hardware has (at least 1)
+     size_t queueCapacity = 8;              // Parsed meshes waiting for the GL thread, workers wait when it's full
+     size_t uploadBudgetBytes = 1 << 20;    // Most bytes update() copies into the pool per frame, big meshes take several frames
+     size_t vertexCapacityBytes = 64 << 20; // Size of the pool every mesh goes into
+     size_t indexCapacityBytes = 32 << 20;
+     bool compactVertices = false;          // Quantize on the worker, the pool holds CompactVertex instead of PositionColorVertex
+     bool optimize = true;                  // Vertex cache and fetch optimization on the worker, see meshOptimize.h
+     int lodLevels = 1;                     // More than 1 simplifies OBJ files into a LOD chain on the worker (always optimized), see meshLod.h
+};
+
+// Loads mesh files (OBJ, see objLoader.h, or binary .mesh, see meshFile.h) without the render loop ever waiting on a file, a parser or a big upload
+     // load() only queues the path, worker threads read, parse, optimize and quantize it into CPU memory
+     // A .mesh file is only mapped and checked against the pool's format, its streams are uploaded from the mapping as they are
+     // Finished meshes go through a bounded queue, so a fast disk can't pile up more parsed meshes than the GL thread is taking
+     // update() runs once a frame on the GL thread and copies at most uploadBudgetBytes into the MeshPool, a mesh bigger than that spreads over several frames
+     // On 4.4+ the bytes go through a persistently mapped staging buffer and glCopyBufferSubData, with a region per frame in flight like UniformRing
+     // On 3.3 they go straight in with glBufferSubData
+// Handles are ints like ShaderBatch's, draw a mesh only once ready() says so
+class MeshLoader {
+public:
+     static const int regions = FrameFences::regions;
+
+     MeshLoader() = default;
+     ~MeshLoader();
+     MeshLoader(const MeshLoader&) = delete;
+     MeshLoader& operator=(const MeshLoader&) = delete;
+
+     bool init(RenderPath path, const MeshLoaderSettings& settings);
+     void shutdown();
+
+     // GL thread only, returns right away
+     int load(const std::string& path);
+     // Once per frame on the GL thread, uploads within the budget and never waits on a worker or the GPU
+     void update();
+
+     MeshLoadState state(int handle) const { return slots[handle].state; }
+     bool ready(int handle) const { return slots[handle].state == MeshLoadState::Ready; }
+     // Only meaningful once ready
+     const PooledMesh& mesh(int handle) const { return slots[handle].mesh; }
+     const MeshBounds& bounds(int handle) const { return slots[handle].bounds; }
+     // Every level is in the mesh's index range, mesh().indexCount only covers level 0 so a plain draw gets the full mesh
+     const LodChain& lods(int handle) const { return slots[handle].lods; }
+     const MeshPool& pool() const { return meshPool; }
+     // Nothing left loading or waiting to upload
+     bool idle() const { return loading == 0; }
+
+     void printStats() const;
+
+private:
+     struct Request {
+          int handle;
+          std::string path;
+     };
+
+     // What a worker hands the GL thread, already in the pool's vertex format and index type
+     struct ParsedMesh {
+          int handle = -1;
+          std::string error; // Empty when it parsed
+          std::vector<unsigned char> vertexData; // OBJ files, converted on the worker
+          std::vector<unsigned char> indexData;
+          std::unique_ptr<MeshFile> file;        // .mesh files, nothing is converted or copied
+          const unsigned char* vertices = NULL;  // Into whichever of the two holds the mesh
+          const unsigned char* indices = NULL;
+          size_t vertexBytes = 0;
+          size_t indexBytes = 0;
+          size_t vertexCount = 0;
+          size_t indexCount = 0;
+          PositionQuantization quantization;
+          MeshBounds bounds;
+          LodChain lods;
+     };
+
+     struct Slot {
+          std::string path;
+          MeshLoadState state = MeshLoadState::Loading;
+          PooledMesh mesh;
+          MeshBounds bounds;
+          LodChain lods;
+     };
+
+     ParsedMesh parse(const Request& request) const;
+     bool startUpload();
+     void uploadChunk(unsigned int buffer, size_t offset, const unsigned char* data, size_t bytes);
+
+     RenderPath path = RenderPath::Bind33;
+     MeshLoaderSettings settings;
+     MeshPool meshPool;
+     std::vector<Slot> slots; // GL thread only
+     int loading = 0;
+
+     WorkerPool<Request, ParsedMesh> workers; // At most queueCapacity parsed meshes wait for the GL thread
+
+     // The mesh being uploaded, and how far along it is
+     ParsedMesh current;
+     bool uploading = false;
+     size_t vertexBytesDone = 0;
+     size_t indexBytesDone = 0;
+
+     unsigned int staging = 0;
+     unsigned char* mapped = NULL; // NULL when falling back to glBufferSubData
+     bool persistent = false;
+     size_t regionUsed = 0;
+     FrameFences fences;
+
+     long long frames = 0;
+     long long uploadFrames = 0;  // Frames that uploaded anything
+     long long bytesUploaded = 0;
+     size_t maxFrameBytes = 0;
+     int readyCount = 0;
+     int failedCount = 0;
+};
+
+#endif
@@ -0,0 +1,306 @@
+#include "meshLod.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// Symmetric 4x4 matrix, p^T Q p with p = (x, y, z, 1) is the summed squared distance from p to every plane added to it
+     // Planes are weighted by their triangle's area, dividing by the total weight makes the error an average distance squared
+struct Quadric {
+     double a00 = 0.0, a01 = 0.0, a02 = 0.0, a03 = 0.0;
+     double a11 = 0.0, a12 = 0.0, a13 = 0.0;
+     double a22 = 0.0, a23 = 0.0;
+     double a33 = 0.0;
+     double weight = 0.0;
+};
+
+// Plane ax + by + cz + d = 0 with (a, b, c) unit length
+static void addPlane(Quadric& q, double a, double b, double c, double d, double weight) {
+     q.a00 += weight * a * a; q.a01 += weight * a * b; q.a02 += weight * a * c; q.a03 += weight * a * d;
+     q.a11 += weight * b * b; q.a12 += weight * b * c; q.a13 += weight * b * d;
+     q.a22 += weight * c * c; q.a23 += weight * c * d;
+     q.a33 += weight * d * d;
+     q.weight += weight;
+}
+
+static void addQuadric(Quadric& q, const Quadric& other) {
+     q.a00 += other.a00; q.a01 += other.a01; q.a02 += other.a02; q.a03 += other.a03;
+     q.a11 += other.a11; q.a12 += other.a12; q.a13 += other.a13;
+     q.a22 += other.a22; q.a23 += other.a23;
+     q.a33 += other.a33;
+     q.weight += other.weight;
+}
+
+static double quadricError(const Quadric& q, const float* p) {
+     if (q.weight <= 0.0) {
+          return 0.0;
+     }
+     double x = p[0], y = p[1], z = p[2];
+     double error = q.a00 * x * x + 2.0 * q.a01 * x * y + 2.0 * q.a02 * x * z + 2.0 * q.a03 * x
+          + q.a11 * y * y + 2.0 * q.a12 * y * z + 2.0 * q.a13 * y
+          + q.a22 * z * z + 2.0 * q.a23 * z
+          + q.a33;
+     return error > 0.0 ? error / q.weight : 0.0; // Rounding can take it a hair under 0
+}
+
+static void triangleNormal(const float* p0, const float* p1, const float* p2, double normal[3]) {
+     double e1[3] = { (double)p1[0] - p0[0], (double)p1[1] - p0[1], (double)p1[2] - p0[2] };
+     double e2[3] = { (double)p2[0] - p0[0], (double)p2[1] - p0[1], (double)p2[2] - p0[2] };
+     normal[0] = e1[1] * e2[2] - e1[2] * e2[1];
+     normal[1] = e1[2] * e2[0] - e1[0] * e2[2];
+     normal[2] = e1[0] * e2[1] - e1[1] * e2[0];
+}
+
+static uint64_t edgeKey(unsigned int a, unsigned int b) {
+     return a < b ? ((uint64_t)a << 32) | b : ((uint64_t)b << 32) | a;
+}
+
+// Every edge of the triangles, each one once
+static void collectEdges(const unsigned int* indices, size_t indexCount, std::vector<uint64_t>& edges) {
+     edges.clear();
+     for (size_t i = 0; i + 2 < indexCount; i += 3) {
+          edges.push_back(edgeKey(indices[i], indices[i + 1]));
+          edges.push_back(edgeKey(indices[i + 1], indices[i + 2]));
+          edges.push_back(edgeKey(indices[i + 2], indices[i]));
+     }
+     std::sort(edges.begin(), edges.end());
+}
+
+struct Collapse {
+     unsigned int from = 0;
+     unsigned int to = 0;
+     double cost = 0.0;
+};
+
+size_t simplifyMesh(unsigned int* destination, const unsigned int* indices, size_t indexCount, const float* positions, size_t positionStride,
+     size_t vertexCount, size_t targetIndexCount, float targetError, float* resultError) {
+     auto position = [&](unsigned int vertex) { return (const float*)((const unsigned char*)positions + vertex * positionStride); };
+     indexCount -= indexCount % 3;
+     memmove(destination, indices, indexCount * sizeof(unsigned int));
+     if (resultError != NULL) {
+          *resultError = 0.0f;
+     }
+
+     std::vector<Quadric> quadrics(vertexCount);
+     for (size_t i = 0; i < indexCount; i += 3) {
+          const float* p0 = position(destination[i]);
+          double normal[3];
+          triangleNormal(p0, position(destination[i + 1]), position(destination[i + 2]), normal);
+          double length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+          if (length == 0.0) {
+               continue; // Degenerate, it has no plane
+          }
+          double a = normal[0] / length, b = normal[1] / length, c = normal[2] / length;
+          double d = -(a * p0[0] + b * p0[1] + c * p0[2]);
+          for (int corner = 0; corner < 3; corner++) {
+               addPlane(quadrics[destination[i + corner]], a, b, c, d, length * 0.5);
+          }
+     }
+
+     // An edge with one triangle is on an open boundary, more than two is non-manifold, neither kind of vertex moves
+     std::vector<uint64_t> edges;
+     std::vector<bool> locked(vertexCount, false);
+     collectEdges(destination, indexCount, edges);
+     for (size_t i = 0; i < edges.size();) {
+          size_t run = i + 1;
+          while (run < edges.size() && edges[run] == edges[i]) {
+               run++;
+          }
+          if (run - i != 2) {
+               locked[(unsigned int)(edges[i] >> 32)] = true;
+               locked[(unsigned int)(edges[i] & 0xffffffffu)] = true;
+          }
+          i = run;
+     }
+
+     double errorLimit = (double)targetError * targetError;
+     double largestError = 0.0;
+     std::vector<unsigned int> remap(vertexCount);
+     std::vector<bool> touched(vertexCount);
+     std::vector<size_t> firstTriangle(vertexCount + 1);
+     std::vector<unsigned int> vertexTriangles;
+     std::vector<Collapse> collapses;
+
+     // Each pass collapses the cheapest edges whose vertices no other collapse in the pass has touched, then rewrites the indices
+     while (indexCount > targetIndexCount) {
+          // Triangles around each vertex
+          std::fill(firstTriangle.begin(), firstTriangle.end(), 0);
+          for (size_t i = 0; i < indexCount; i++) {
+               firstTriangle[destination[i] + 1]++;
+          }
+          for (size_t v = 0; v < vertexCount; v++) {
+               firstTriangle[v + 1] += firstTriangle[v];
+          }
+          vertexTriangles.resize(indexCount);
+          {
+               std::vector<size_t> filled(firstTriangle.begin(), firstTriangle.end() - 1);
+               for (size_t i = 0; i < indexCount; i++) {
+                    vertexTriangles[filled[destination[i]]++] = (unsigned int)(i / 3);
+               }
+          }
+
+          // The cheaper way round for every edge, the vertex that moves is the one whose planes mind less
+          collectEdges(destination, indexCount, edges);
+          edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+          collapses.clear();
+          for (uint64_t edge : edges) {
+               unsigned int a = (unsigned int)(edge >> 32), b = (unsigned int)(edge & 0xffffffffu);
+               Collapse collapse;
+               collapse.cost = DBL_MAX;
+               if (!locked[a]) {
+                    collapse.from = a;
+                    collapse.to = b;
+                    collapse.cost = quadricError(quadrics[a], position(b));
+               }
+               if (!locked[b]) {
+                    double cost = quadricError(quadrics[b], position(a));
+                    if (cost < collapse.cost) {
+                         collapse.from = b;
+                         collapse.to = a;
+                         collapse.cost = cost;
+                    }
+               }
+               if (collapse.cost <= errorLimit) {
+                    collapses.push_back(collapse);
+               }
+          }
+          std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.cost < b.cost; });
+
+          for (size_t v = 0; v < vertexCount; v++) {
+               remap[v] = (unsigned int)v;
+          }
+          std::fill(touched.begin(), touched.end(), false);
+          size_t trianglesToRemove = (indexCount - targetIndexCount + 2) / 3;
+          size_t removed = 0;
+          size_t collapsed = 0;
+          for (const Collapse& collapse : collapses) {
+               if (removed >= trianglesToRemove) {
+                    break;
+               }
+               if (touched[collapse.from] || touched[collapse.to]) {
+                    continue;
+               }
+
+               // Moving from onto to mustn't turn any of the triangles that survive it over
+               bool flips = false;
+               size_t dying = 0;
+               const float* target = position(collapse.to);
+               for (size_t k = firstTriangle[collapse.from]; k < firstTriangle[collapse.from + 1] && !flips; k++) {
+                    const unsigned int* triangle = destination + vertexTriangles[k] * 3;
+                    unsigned int corners[3] = { remap[triangle[0]], remap[triangle[1]], remap[triangle[2]] };
+                    if (corners[0] == corners[1] || corners[1] == corners[2] || corners[2] == corners[0]) {
+                         continue; // Already gone
+                    }
+                    if (corners[0] == collapse.to || corners[1] == collapse.to || corners[2] == collapse.to) {
+                         dying++;
+                         continue;
+                    }
+                    const float* before[3] = { position(corners[0]), position(corners[1]), position(corners[2]) };
+                    const float* after[3] = { before[0], before[1], before[2] };
+                    for (int corner = 0; corner < 3; corner++) {
+                         if (corners[corner] == collapse.from) {
+                              after[corner] = target;
+                         }
+                    }
+                    double normalBefore[3], normalAfter[3];
+                    triangleNormal(before[0], before[1], before[2], normalBefore);
+                    triangleNormal(after[0], after[1], after[2], normalAfter);
+                    flips = normalBefore[0] * normalAfter[0] + normalBefore[1] * normalAfter[1] + normalBefore[2] * normalAfter[2] <= 0.0;
+               }
+               if (flips) {
+                    continue;
+               }
+
+               remap[collapse.from] = collapse.to;
+               addQuadric(quadrics[collapse.to], quadrics[collapse.from]);
+               touched[collapse.from] = true;
+               touched[collapse.to] = true;
+               removed += dying;
+               collapsed++;
+               largestError = std::max(largestError, collapse.cost);
+          }
+          if (collapsed == 0) {
+               break; // Everything left is locked, too expensive or would flip
+          }
+
+          // A collapse target never moves in the same pass, so one lookup is the final vertex
+          size_t kept = 0;
+          for (size_t i = 0; i < indexCount; i += 3) {
+               unsigned int a = remap[destination[i]], b = remap[destination[i + 1]], c = remap[destination[i + 2]];
+               if (a != b && b != c && c != a) {
+                    destination[kept++] = a;
+                    destination[kept++] = b;
+                    destination[kept++] = c;
+               }
+          }
+          indexCount = kept;
+     }
+
+     if (resultError != NULL) {
+          *resultError = (float)std::sqrt(largestError);
+     }
+     return indexCount;
+}
+
+// Below this many triangles another level doesn't save enough to be worth the draw's setup
+static const size_t minLodTriangles = 16;
+
+LodChain buildLodChain(const float* positions, size_t positionStride, size_t vertexCount, std::vector<unsigned int>& indices, int maxLevels) {
+     LodChain chain = singleLevelChain((int)indices.size());
+     if (maxLevels > maxLodLevels) {
+          maxLevels = maxLodLevels;
+     }
+
+     std::vector<unsigned int> level(indices.begin(), indices.end());
+     std::vector<unsigned int> simplified;
+     while (chain.levelCount < maxLevels && level.size() / 3 >= minLodTriangles * 2) {
+          size_t target = level.size() / 6 * 3;
+          simplified.resize(level.size());
+          float error = 0.0f;
+          size_t count = simplifyMesh(simplified.data(), level.data(), level.size(), positions, positionStride, vertexCount, target, FLT_MAX, &error);
+          if (count > level.size() * 3 / 4) {
+               break; // Mostly locked or flat out of cheap collapses, the next level would look the same for the same cost
+          }
+          simplified.resize(count);
+          optimizeVertexCache(simplified.data(), simplified.size(), vertexCount);
+
+          // Each level is simplified from the one before, so its error builds on the last one's, still an estimate and not a bound (see LodLevel)
+          LodLevel& lod = chain.levels[chain.levelCount];
+          lod.firstIndex = (int)indices.size();
+          lod.indexCount = (int)count;
+          lod.error = chain.levels[chain.levelCount - 1].error + error;
+          chain.levelCount++;
+          indices.insert(indices.end(), simplified.begin(), simplified.end());
+          level.swap(simplified);
+     }
+     return chain;
+}
+
+LodChain singleLevelChain(int indexCount) {
+     LodChain chain;
+     chain.levels[0].indexCount = indexCount;
+     chain.levelCount = 1;
+     return chain;
+}
+
+float projectedPixelsPerUnit(float distance, float fovY, float viewportHeight) {
+     if (distance <= 0.0f) {
+          return FLT_MAX; // At or behind the eye, only the full mesh will do
+     }
+     return viewportHeight / (2.0f * std::tan(fovY * 0.5f) * distance);
+}
+
+int selectLod(const LodChain& chain, float pixelsPerUnit, int current, float maxErrorPixels, float hysteresis) {
+     if (chain.levelCount <= 1) {
+          return 0;
+     }
+     int level = current < 0 ? 0 : current >= chain.levelCount ? chain.levelCount - 1 : current;
+     while (level + 1 < chain.levelCount && chain.levels[level + 1].error * pixelsPerUnit <= maxErrorPixels * (1.0f - hysteresis)) {
+          level++;
+     }
+     while (level > 0 && chain.levels[level].error * pixelsPerUnit > maxErrorPixels * (1.0f + hysteresis)) {
+          level--;
+     }
+     return level;
+}
@@ -0,0 +1,63 @@
+#ifndef MESH_LOD_H
+#define MESH_LOD_H
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include "meshOptimize.h"
+
+// Levels of detail for a mesh, so far away objects don't pay for triangles smaller than a pixel
+     // simplifyMesh : quadric error metric edge collapses (Garland and Heckbert), always onto one of the two existing vertices
+     // So every level indexes the same vertices, a whole LOD chain is one vertex buffer and one index buffer with each level after the last
+     // selectLod : picks a level per object per frame from how many pixels its error would cover on screen
+
+const int maxLodLevels = 6;
+
+struct LodLevel {
+     int firstIndex = 0;
+     int indexCount = 0;
+     // Roughly how far the surface moved from the full mesh, in object space units, not a bound
+          // Each level adds the square root of its costliest collapse's quadric error (an area weighted average squared distance to the planes it replaced)
+          // Narrow features can move further than this, it stands for how much a level changed the mesh rather than where the worst spot is
+     float error = 0.0f;
+};
+
+struct LodChain {
+     LodLevel levels[maxLodLevels];
+     int levelCount = 0;        // Level 0 is the full mesh
+};
+
+// Collapses edges until the triangles fit in targetIndexCount or the next collapse's error (as in LodLevel) would pass targetError
+     // Writes the remaining triangles to destination (room for indexCount), returns how many indices that is
+     // Vertices on an open boundary never move so holes can't open up, resultError gets the largest error it accepted
+size_t simplifyMesh(unsigned int* destination, const unsigned int* indices, size_t indexCount, const float* positions, size_t positionStride,
+     size_t vertexCount, size_t targetIndexCount, float targetError, float* resultError = NULL);
+
+// Simplifies indices[0, indexCount) to half the triangles, then that to half again, up to maxLevels levels in all
+     // Each level is cache optimized and appended to indices, stops early when a level can't get meaningfully smaller
+LodChain buildLodChain(const float* positions, size_t positionStride, size_t vertexCount, std::vector<unsigned int>& indices, int maxLevels = maxLodLevels);
+
+// optimizeMesh with a LOD chain, the fetch order covers every level so no level reads vertices out of order
+template<typename Vertex>
+LodChain optimizeMeshWithLods(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, int maxLevels = maxLodLevels) {
+     static_assert(std::is_same<decltype(Vertex::position), float[3]>::value, "LODs need float positions, quantize after building them");
+     optimizeTriangleOrder(indices.data(), indices.size(), vertices.size());
+     const float* positions = (const float*)((const unsigned char*)vertices.data() + offsetof(Vertex, position));
+     LodChain chain = buildLodChain(positions, sizeof(Vertex), vertices.size(), indices, maxLevels);
+     vertices.resize(optimizeVertexFetch(vertices.data(), sizeof(Vertex), vertices.size(), indices.data(), indices.size()));
+     return chain;
+}
+
+// A chain with just the full mesh, for meshes nobody built LODs for
+LodChain singleLevelChain(int indexCount);
+
+// Pixels one object space unit covers, viewportHeight / (2 * tan(fovY / 2) * distance) for a perspective camera, times the object's scale
+float projectedPixelsPerUnit(float distance, float fovY, float viewportHeight);
+
+// The coarsest level whose error covers at most maxErrorPixels on screen
+     // LodLevel::error is an estimate, so this is a quality knob rather than a promise that nothing moves further than maxErrorPixels
+     // current is the level the object used last frame, it only moves to a coarser level once that one is hysteresis under the threshold,
+     // and only back to a finer one once its own error is hysteresis over it, so an object sitting on a boundary doesn't pop every frame
+int selectLod(const LodChain& chain, float pixelsPerUnit, int current, float maxErrorPixels = 1.0f, float hysteresis = 0.25f);
+
+#endif
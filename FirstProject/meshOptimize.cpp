@@ -0,0 +1,196 @@
+#include "meshOptimize.h"
+#include <cmath>
+#include <cstring>
+
+float computeACMR(const unsigned int* indices, size_t indexCount, size_t vertexCount, int cacheSize) {
+     if (indexCount < 3) {
+          return 0.0f;
+     }
+
+     // When each vertex entered the cache, it's still in there if fewer than cacheSize misses happened since
+     std::vector<size_t> enteredAt(vertexCount, 0);
+     std::vector<bool> seen(vertexCount, false);
+     size_t misses = 0;
+     for (size_t i = 0; i < indexCount; i++) {
+          unsigned int vertex = indices[i];
+          if (!seen[vertex] || misses - enteredAt[vertex] >= (size_t)cacheSize) {
+               seen[vertex] = true;
+               enteredAt[vertex] = misses;
+               misses++;
+          }
+     }
+     return (float)misses / (float)(indexCount / 3);
+}
+
+// Scoring from Tom Forsyth's "Linear-Speed Vertex Cache Optimisation"
+     // Vertices near the front of the cache score high (except the last triangle's, which the GPU probably still has anyway)
+     // Vertices with few triangles left score high too, so they get finished off instead of leaving stragglers that need reloading later
+static const float cacheDecayPower = 1.5f;
+static const float lastTriangleScore = 0.75f;
+static const float valenceBoostScale = 2.0f;
+static const float valenceBoostPower = 0.5f;
+
+static float vertexScore(int cachePosition, int remainingTriangles) {
+     if (remainingTriangles == 0) {
+          return -1.0f; // Nothing left to draw with it
+     }
+
+     float score = 0.0f;
+     if (cachePosition >= 0) {
+          if (cachePosition < 3) {
+               score = lastTriangleScore;
+          }
+          else {
+               float scaler = 1.0f / (vertexCacheSize - 3);
+               score = std::pow(1.0f - (cachePosition - 3) * scaler, cacheDecayPower);
+          }
+     }
+     score += valenceBoostScale * std::pow((float)remainingTriangles, -valenceBoostPower);
+     return score;
+}
+
+void optimizeVertexCache(unsigned int* indices, size_t indexCount, size_t vertexCount) {
+     size_t triangleCount = indexCount / 3;
+     if (triangleCount == 0) {
+          return;
+     }
+
+     // Triangles using each vertex, packed into one array, the first remaining[v] entries of each vertex's run are the ones not drawn yet
+     std::vector<int> remaining(vertexCount, 0);
+     for (size_t i = 0; i < triangleCount * 3; i++) {
+          remaining[indices[i]]++;
+     }
+     std::vector<size_t> firstTriangle(vertexCount + 1, 0);
+     for (size_t v = 0; v < vertexCount; v++) {
+          firstTriangle[v + 1] = firstTriangle[v] + remaining[v];
+     }
+     std::vector<unsigned int> vertexTriangles(triangleCount * 3);
+     {
+          std::vector<size_t> filled(firstTriangle.begin(), firstTriangle.end() - 1);
+          for (size_t t = 0; t < triangleCount; t++) {
+               for (int corner = 0; corner < 3; corner++) {
+                    unsigned int vertex = indices[t * 3 + corner];
+                    vertexTriangles[filled[vertex]++] = (unsigned int)t;
+               }
+          }
+     }
+
+     std::vector<int> cachePosition(vertexCount, -1);
+     std::vector<float> score(vertexCount);
+     for (size_t v = 0; v < vertexCount; v++) {
+          score[v] = vertexScore(-1, remaining[v]);
+     }
+
+     std::vector<bool> drawn(triangleCount, false);
+     std::vector<unsigned int> output;
+     output.reserve(triangleCount * 3);
+     // Three extra slots for the triangle being added, the ones that fall off the end get their scores dropped
+     std::vector<unsigned int> cache, nextCache;
+     cache.reserve(vertexCacheSize + 3);
+     nextCache.reserve(vertexCacheSize + 3);
+
+     size_t scanCursor = 0; // Where the search for a fresh start picks up, everything before it is drawn
+     long long best = -1;
+     for (size_t added = 0; added < triangleCount; added++) {
+          if (best < 0) {
+               // Nothing in the cache is worth anything, start somewhere new
+               while (drawn[scanCursor]) {
+                    scanCursor++;
+               }
+               best = (long long)scanCursor;
+          }
+
+          unsigned int triangle = (unsigned int)best;
+          drawn[triangle] = true;
+          nextCache.clear();
+          for (int corner = 0; corner < 3; corner++) {
+               unsigned int vertex = indices[triangle * 3 + corner];
+               output.push_back(vertex);
+               nextCache.push_back(vertex);
+
+               // Takes the triangle out of the vertex's remaining run
+               size_t begin = firstTriangle[vertex];
+               size_t end = begin + remaining[vertex];
+               for (size_t i = begin; i < end; i++) {
+                    if (vertexTriangles[i] == triangle) {
+                         vertexTriangles[i] = vertexTriangles[end - 1];
+                         vertexTriangles[end - 1] = triangle;
+                         break;
+                    }
+               }
+               remaining[vertex]--;
+          }
+          for (unsigned int vertex : cache) {
+               if (vertex != nextCache[0] && vertex != nextCache[1] && vertex != nextCache[2]) {
+                    nextCache.push_back(vertex);
+               }
+          }
+
+          // Rescore everything in the new cache, and whatever just fell out of it
+          for (size_t i = 0; i < nextCache.size(); i++) {
+               unsigned int vertex = nextCache[i];
+               cachePosition[vertex] = i < (size_t)vertexCacheSize ? (int)i : -1;
+               score[vertex] = vertexScore(cachePosition[vertex], remaining[vertex]);
+          }
+          if (nextCache.size() > (size_t)vertexCacheSize) {
+               nextCache.resize(vertexCacheSize);
+          }
+          cache.swap(nextCache);
+
+          // The next triangle is the best one touching the cache, anything further away didn't change score
+          best = -1;
+          float bestScore = -1.0f;
+          for (unsigned int vertex : cache) {
+               size_t begin = firstTriangle[vertex];
+               size_t end = begin + remaining[vertex];
+               for (size_t i = begin; i < end; i++) {
+                    unsigned int candidate = vertexTriangles[i];
+                    const unsigned int* corners = indices + candidate * 3;
+                    float candidateScore = score[corners[0]] + score[corners[1]] + score[corners[2]];
+                    if (candidateScore > bestScore) {
+                         bestScore = candidateScore;
+                         best = candidate;
+                    }
+               }
+          }
+     }
+
+     memcpy(indices, output.data(), triangleCount * 3 * sizeof(unsigned int));
+}
+
+MeshOptimizeStats optimizeTriangleOrder(unsigned int* indices, size_t indexCount, size_t vertexCount) {
+     MeshOptimizeStats stats;
+     stats.acmrBefore = computeACMR(indices, indexCount, vertexCount);
+     std::vector<unsigned int> input(indices, indices + indexCount);
+     optimizeVertexCache(indices, indexCount, vertexCount);
+     stats.acmrReordered = computeACMR(indices, indexCount, vertexCount);
+     stats.reordered = stats.acmrReordered <= stats.acmrBefore;
+     if (!stats.reordered) {
+          memcpy(indices, input.data(), indexCount * sizeof(unsigned int));
+     }
+     stats.acmrAfter = stats.reordered ? stats.acmrReordered : stats.acmrBefore;
+     return stats;
+}
+
+size_t optimizeVertexFetch(void* vertices, size_t vertexStride, size_t vertexCount, unsigned int* indices, size_t indexCount) {
+     const unsigned int unused = ~0u;
+     std::vector<unsigned int> remap(vertexCount, unused);
+     unsigned int nextVertex = 0;
+     for (size_t i = 0; i < indexCount; i++) {
+          unsigned int& newIndex = remap[indices[i]];
+          if (newIndex == unused) {
+               newIndex = nextVertex++;
+          }
+          indices[i] = newIndex;
+     }
+
+     std::vector<unsigned char> reordered((size_t)nextVertex * vertexStride);
+     const unsigned char* source = (const unsigned char*)vertices;
+     for (size_t v = 0; v < vertexCount; v++) {
+          if (remap[v] != unused) {
+               memcpy(reordered.data() + remap[v] * vertexStride, source + v * vertexStride, vertexStride);
+          }
+     }
+     memcpy(vertices, reordered.data(), reordered.size());
+     return nextVertex;
+}
@@ -0,0 +1,46 @@
+#ifndef MESH_OPTIMIZE_H
+#define MESH_OPTIMIZE_H
+
+#include <cstddef>
+#include <vector>
+
+// Reorders a triangle list so the GPU does less work drawing it, the triangles themselves don't change
+     // optimizeVertexCache : triangle order, so vertices the GPU just transformed get reused before its post-transform cache forgets them
+     // optimizeVertexFetch : vertex order, so vertices are read from memory roughly front to back
+// 16 bit indices are picked by createMesh on its own, see renderPath.h
+
+// Size of the simulated post-transform cache, real hardware ranges from about 16 to 32 entries
+const int vertexCacheSize = 32;
+
+// Average cache miss ratio, vertex shader runs per triangle through a FIFO cache
+     // 3 is the worst (nothing reused), a regular grid can get close to 0.5
+float computeACMR(const unsigned int* indices, size_t indexCount, size_t vertexCount, int cacheSize = vertexCacheSize);
+
+// Forsyth's linear-speed vertex cache optimization, rewrites indices in place
+void optimizeVertexCache(unsigned int* indices, size_t indexCount, size_t vertexCount);
+
+// Moves vertices into the order the indices first use them and remaps the indices to match
+     // Vertices nothing uses are dropped, returns how many are left
+size_t optimizeVertexFetch(void* vertices, size_t vertexStride, size_t vertexCount, unsigned int* indices, size_t indexCount);
+
+struct MeshOptimizeStats {
+     float acmrBefore = 0.0f;
+     float acmrAfter = 0.0f;     // Of the order that was kept
+     float acmrReordered = 0.0f; // Of optimizeVertexCache's order, whether or not it was kept
+     bool reordered = false;
+};
+
+// optimizeVertexCache, but the input order stays when the new one misses more
+     // Forsyth's greedy pass can lose to an input that's already well ordered, small grids especially
+MeshOptimizeStats optimizeTriangleOrder(unsigned int* indices, size_t indexCount, size_t vertexCount);
+
+// Both passes, cache first since the fetch order follows the triangle order
+template<typename Vertex>
+MeshOptimizeStats optimizeMesh(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices) {
+     MeshOptimizeStats stats = optimizeTriangleOrder(indices.data(), indices.size(), vertices.size());
+     // Renumbering vertices in first-use order doesn't change which ones hit the cache, so acmrAfter still holds
+     vertices.resize(optimizeVertexFetch(vertices.data(), sizeof(Vertex), vertices.size(), indices.data(), indices.size()));
+     return stats;
+}
+
+#endif
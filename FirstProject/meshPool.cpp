@@ -0,0 +1,141 @@
+#include "meshPool.h"
+#include "glState.h"
+#include <iostream>
+#include <vector>
+
+bool MeshPool::init(RenderPath path, const VertexFormat& format, size_t vertexCapacityBytes, size_t indexCapacityBytes) {
+     this->path = path;
+     this->format = format;
+     vertexRanges.init(vertexCapacityBytes);
+     indexRanges.init(indexCapacityBytes);
+
+     if (path == RenderPath::DSA45) {
+          glCreateVertexArrays(1, &VAO);
+          glCreateBuffers(1, &VBO);
+          glCreateBuffers(1, &EBO);
+          // Immutable size, but the contents change every time a mesh is added
+          glNamedBufferStorage(VBO, vertexCapacityBytes, NULL, GL_DYNAMIC_STORAGE_BIT);
+          glNamedBufferStorage(EBO, indexCapacityBytes, NULL, GL_DYNAMIC_STORAGE_BIT);
+
+          glVertexArrayVertexBuffer(VAO, 0, VBO, 0, format.stride);
+          glVertexArrayElementBuffer(VAO, EBO);
+          for (int i = 0; i < format.attributeCount; i++) {
+               setVertexArrayAttribute(VAO, format.attributes[i], 0, format.attributes[i].offset);
+          }
+     }
+     else {
+          glGenVertexArrays(1, &VAO);
+          glGenBuffers(1, &VBO);
+          glGenBuffers(1, &EBO);
+
+          glState.bindVertexArray(VAO);
+          glState.bindBuffer(GL_ARRAY_BUFFER, VBO);
+          glBufferData(GL_ARRAY_BUFFER, vertexCapacityBytes, NULL, GL_STATIC_DRAW);
+          glState.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+          glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexCapacityBytes, NULL, GL_STATIC_DRAW);
+          for (int i = 0; i < format.attributeCount; i++) {
+               setVertexAttributePointer(format.attributes[i], format.stride, format.attributes[i].offset);
+          }
+          glState.bindBuffer(GL_ARRAY_BUFFER, 0);
+          glState.bindVertexArray(0);
+     }
+     return true;
+}
+
+void MeshPool::shutdown() {
+     if (VAO == 0) {
+          return;
+     }
+     glState.forgetVertexArray(VAO);
+     glState.forgetBuffer(VBO);
+     glState.forgetBuffer(EBO);
+     glDeleteVertexArrays(1, &VAO);
+     glDeleteBuffers(1, &VBO);
+     glDeleteBuffers(1, &EBO);
+     VAO = VBO = EBO = 0;
+     meshes = 0;
+}
+
+// The bind path uploads through GL_COPY_WRITE_BUFFER, binding the EBO to GL_ELEMENT_ARRAY_BUFFER would change whatever VAO is bound
+static void uploadBytes(RenderPath path, unsigned int buffer, size_t offset, size_t bytes, const void* data) {
+     if (path == RenderPath::DSA45) {
+          glNamedBufferSubData(buffer, (GLintptr)offset, (GLsizeiptr)bytes, data);
+     }
+     else {
+          glState.bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+          glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)offset, (GLsizeiptr)bytes, data);
+     }
+}
+
+PooledMesh MeshPool::add(const void* vertices, size_t vertexCount, const unsigned int* indices, size_t indexCount) {
+     PooledMesh mesh = reserve(vertexCount, indexCount);
+     if (!mesh.valid()) {
+          return mesh;
+     }
+
+     std::vector<unsigned short> shortIndices;
+     const void* indexData = indices;
+     if (mesh.indexType == GL_UNSIGNED_SHORT) {
+          shortIndices.assign(indices, indices + indexCount);
+          indexData = shortIndices.data();
+     }
+     uploadBytes(path, VBO, mesh.vertexOffset, mesh.vertexBytes, vertices);
+     uploadBytes(path, EBO, mesh.indexOffset, mesh.indexBytes, indexData);
+     return mesh;
+}
+
+PooledMesh MeshPool::reserve(size_t vertexCount, size_t indexCount) {
+     PooledMesh mesh;
+     GLenum indexType = pooledIndexType(vertexCount);
+     size_t indexSize = indexType == GL_UNSIGNED_SHORT ? sizeof(unsigned short) : sizeof(unsigned int);
+
+     // Vertices are aligned to a whole vertex so the offset divides into a baseVertex, indices to their own size
+     mesh.vertexBytes = vertexCount * format.stride;
+     mesh.indexBytes = indexCount * indexSize;
+     mesh.vertexOffset = vertexRanges.allocate(mesh.vertexBytes, format.stride);
+     if (mesh.vertexOffset == RangeAllocator::invalid) {
+          std::cout << "ERROR::MESH_POOL::VERTEX_BUFFER_FULL " << mesh.vertexBytes << " bytes" << std::endl;
+          failedAdds++;
+          return PooledMesh();
+     }
+     mesh.indexOffset = indexRanges.allocate(mesh.indexBytes, indexSize);
+     if (mesh.indexOffset == RangeAllocator::invalid) {
+          std::cout << "ERROR::MESH_POOL::INDEX_BUFFER_FULL " << mesh.indexBytes << " bytes" << std::endl;
+          vertexRanges.free(mesh.vertexOffset, mesh.vertexBytes);
+          failedAdds++;
+          return PooledMesh();
+     }
+
+     mesh.baseVertex = (GLint)(mesh.vertexOffset / format.stride);
+     mesh.indexCount = (int)indexCount;
+     mesh.indexType = indexType;
+     meshes++;
+     return mesh;
+}
+
+void MeshPool::remove(PooledMesh& mesh) {
+     if (!mesh.valid()) {
+          return;
+     }
+     // The old contents are left in the buffer, nothing draws them anymore and the next add overwrites them
+     vertexRanges.free(mesh.vertexOffset, mesh.vertexBytes);
+     indexRanges.free(mesh.indexOffset, mesh.indexBytes);
+     meshes--;
+     mesh = PooledMesh();
+}
+
+void MeshPool::draw(const PooledMesh& mesh) const {
+     draw(mesh, 0, mesh.indexCount);
+}
+
+void MeshPool::draw(const PooledMesh& mesh, int first, int count) const {
+     glState.bindVertexArray(VAO); // Only reaches GL for the first draw, every mesh in the pool shares it
+     size_t indexSize = mesh.indexType == GL_UNSIGNED_SHORT ? sizeof(unsigned short) : sizeof(unsigned int);
+     glDrawElementsBaseVertex(GL_TRIANGLES, count, mesh.indexType, (void*)(mesh.indexOffset + first * indexSize), mesh.baseVertex);
+}
+
+void MeshPool::printStats() const {
+     std::cout << "Mesh pool: " << meshes << " meshes, vertices " << vertexRanges.used() << "/" << vertexRanges.capacity()
+          << " bytes, indices " << indexRanges.used() << "/" << indexRanges.capacity() << " bytes, "
+          << vertexRanges.freeRanges() + indexRanges.freeRanges() << " free ranges, " << failedAdds << " failed adds" << std::endl;
+}
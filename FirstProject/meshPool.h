@@ -0,0 +1,67 @@
+#ifndef MESH_POOL_H
+#define MESH_POOL_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include "rangeAllocator.h"
+#include "renderPath.h"
+#include "vertexFormat.h"
+
+// Where one mesh lives inside a MeshPool
+struct PooledMesh {
+     GLint baseVertex = 0;           // Added to every index, so the indices stay relative to the mesh's own vertices
+     size_t vertexOffset = RangeAllocator::invalid;
+     size_t vertexBytes = 0;
+     size_t indexOffset = RangeAllocator::invalid; // Bytes into the index buffer
+     size_t indexBytes = 0;
+     int indexCount = 0;
+     GLenum indexType = GL_UNSIGNED_INT;
+     PositionQuantization quantization;
+
+     bool valid() const { return indexOffset != RangeAllocator::invalid; }
+};
+
+// Packs many meshes of one vertex format into one vertex buffer and one index buffer, all drawn through one VAO
+     // Instead of a VAO, VBO and EBO per object, so binding doesn't grow with the object count and the data sits together
+     // Draws use glDrawElementsBaseVertex, the index range picks the mesh and baseVertex points its indices at its vertices
+// Vertices are always interleaved, a split layout would need its own range per attribute
+// Capacity is fixed at init, add() fails (and says so) when a buffer is full
+class MeshPool {
+public:
+     bool init(RenderPath path, const VertexFormat& format, size_t vertexCapacityBytes, size_t indexCapacityBytes);
+     void shutdown();
+
+     // vertices have to be in the pool's format, indices follow the same rules as createMesh (unsigned short when the mesh is small enough)
+     PooledMesh add(const void* vertices, size_t vertexCount, const unsigned int* indices, size_t indexCount);
+     // Claims the ranges for a mesh without uploading anything, for callers that fill the buffers themselves (MeshLoader)
+          // The index range is sized for pooledIndexType(vertexCount)
+     PooledMesh reserve(size_t vertexCount, size_t indexCount);
+     void remove(PooledMesh& mesh);
+
+     // The shared VAO stays bound after a draw even on the bind path, bind-to-edit code always binds its own VAO first
+     void draw(const PooledMesh& mesh) const;
+     // Part of a mesh, first and count are in indices
+     void draw(const PooledMesh& mesh, int first, int count) const;
+
+     // For callers that draw from the pool themselves (IndirectRenderer)
+     unsigned int vertexArray() const { return VAO; }
+     unsigned int vertexBuffer() const { return VBO; }
+     unsigned int indexBuffer() const { return EBO; }
+     const VertexFormat& vertexFormat() const { return format; }
+
+     void printStats() const;
+
+private:
+     RenderPath path = RenderPath::Bind33;
+     VertexFormat format;
+     unsigned int VAO = 0;
+     unsigned int VBO = 0;
+     unsigned int EBO = 0;
+     RangeAllocator vertexRanges;
+     RangeAllocator indexRanges;
+
+     int meshes = 0;
+     long long failedAdds = 0;
+};
+
+#endif
@@ -0,0 +1,118 @@
+#include "objLoader.h"
+#include "meshBounds.h"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+// Reads one face corner ("7", "7/2", "7//3", "-1/2/3"), returns false at the end of the line
+static bool parseCorner(const char*& at, long& index) {
+     while (*at == ' ' || *at == '\t') {
+          at++;
+     }
+     if (*at == '\0' || *at == '\r' || *at == '\n' || *at == '#') {
+          return false;
+     }
+     char* end = NULL;
+     index = strtol(at, &end, 10);
+     if (end == at) {
+          return false;
+     }
+     at = end;
+     while (*at != '\0' && *at != ' ' && *at != '\t' && *at != '\r' && *at != '\n') {
+          at++; // Skips the /texture/normal part
+     }
+     return true;
+}
+
+bool loadObj(const std::string& path, std::vector<PositionColorVertex>& vertices, std::vector<unsigned int>& indices, std::string& error) {
+     std::ifstream file(path, std::ios::binary);
+     if (!file) {
+          error = "can't open " + path;
+          return false;
+     }
+     std::stringstream stream;
+     stream << file.rdbuf();
+     std::string text = stream.str();
+     text.push_back('\n'); // So every line, the last one too, ends in a newline that can be swapped for a terminator
+
+     vertices.clear();
+     indices.clear();
+     bool hasColors = true;
+     std::vector<unsigned int> face;
+     int lineNumber = 0;
+
+     size_t lineStart = 0;
+     while (lineStart < text.size()) {
+          size_t lineEnd = text.find('\n', lineStart);
+          text[lineEnd] = '\0';
+          const char* line = text.c_str() + lineStart;
+          lineNumber++;
+          lineStart = lineEnd + 1;
+
+          while (*line == ' ' || *line == '\t') {
+               line++;
+          }
+          if (line[0] == 'v' && (line[1] == ' ' || line[1] == '\t')) {
+               PositionColorVertex vertex = {};
+               const char* at = line + 2;
+               float values[6] = {};
+               int count = 0;
+               for (; count < 6; count++) {
+                    char* end = NULL;
+                    values[count] = strtof(at, &end);
+                    if (end == at) {
+                         break;
+                    }
+                    at = end;
+               }
+               if (count < 3) {
+                    error = path + ":" + std::to_string(lineNumber) + ": vertex needs 3 coordinates";
+                    return false;
+               }
+               memcpy(vertex.position, values, sizeof(vertex.position));
+               if (count == 6) {
+                    memcpy(vertex.color, values + 3, sizeof(vertex.color));
+               }
+               else {
+                    hasColors = false;
+               }
+               vertices.push_back(vertex);
+          }
+          else if (line[0] == 'f' && (line[1] == ' ' || line[1] == '\t')) {
+               face.clear();
+               const char* at = line + 2;
+               long index = 0;
+               while (parseCorner(at, index)) {
+                    // 1 based, negative counts back from the last vertex so far
+                    long resolved = index < 0 ? (long)vertices.size() + index : index - 1;
+                    if (index == 0 || resolved < 0 || resolved >= (long)vertices.size()) {
+                         error = path + ":" + std::to_string(lineNumber) + ": face uses a vertex that doesn't exist";
+                         return false;
+                    }
+                    face.push_back((unsigned int)resolved);
+               }
+               for (size_t corner = 2; corner < face.size(); corner++) {
+                    indices.push_back(face[0]);
+                    indices.push_back(face[corner - 1]);
+                    indices.push_back(face[corner]);
+               }
+          }
+     }
+
+     if (indices.empty()) {
+          error = path + ": no faces";
+          return false;
+     }
+
+     if (!hasColors) {
+          MeshBounds bounds = computeMeshBounds(vertices.data(), vertices.size());
+          for (PositionColorVertex& vertex : vertices) {
+               for (int axis = 0; axis < 3; axis++) {
+                    float extent = bounds.high[axis] - bounds.low[axis];
+                    vertex.color[axis] = extent > 0.0f ? 0.25f + 0.75f * (vertex.position[axis] - bounds.low[axis]) / extent : 1.0f;
+               }
+          }
+     }
+     return true;
+}
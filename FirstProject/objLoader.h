@@ -0,0 +1,16 @@
+#ifndef OBJ_LOADER_H
+#define OBJ_LOADER_H
+
+#include <string>
+#include <vector>
+#include "vertexFormat.h"
+
+// Reads the geometry out of a Wavefront OBJ file into an indexed triangle list
+     // v x y z [r g b] : positions, with the common vertex color extension, files without colors get them from where the vertex sits in the bounding box
+     // f a b c ... : faces of any size, fanned into triangles, a/b/c, a//c and negative (relative) indices all work
+     // Texture coordinates, normals, groups and materials are skipped, PositionColorVertex has nowhere to put them
+// Vertices are the file's own v lines in order, so faces sharing a v share the vertex
+// Safe to call from any thread, it touches no GL and no shared state
+bool loadObj(const std::string& path, std::vector<PositionColorVertex>& vertices, std::vector<unsigned int>& indices, std::string& error);
+
+#endif
@@ -0,0 +1,273 @@
+#include <glad/glad.h>
+#include <custom/program.h>
+#include "programCache.h"
+#include "shaderBatch.h"
+#include "uniformBlocks.h"
+#include "shaderPreprocessor.h"
+#include "glState.h"
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+Program::Program(const char* vertexPath, const char* fragmentPath, ProgramCache* cache, unsigned int features) {
+     PreprocessedShader vertex = preprocessShader(vertexPath, features);
+     PreprocessedShader fragment = preprocessShader(fragmentPath, features);
+
+     if (cache != NULL) {
+          ID = cache->build(vertex.source, fragment.source, ProgramCache::combineKeys(vertex.hash, fragment.hash));
+     }
+     else {
+          ID = ProgramCache::compileFromSource(vertex.source, fragment.source, false);
+     }
+     reflect();
+}
+
+Program::Program(const char* vertexPath, const char* fragmentPath, ShaderBatch& batch, unsigned int features) : batch(&batch) {
+     PreprocessedShader vertex = preprocessShader(vertexPath, features);
+     PreprocessedShader fragment = preprocessShader(fragmentPath, features);
+     pending = batch.submit(vertex.source, fragment.source, ProgramCache::combineKeys(vertex.hash, fragment.hash));
+}
+
+void Program::resolve() {
+     if (pending != -1) {
+          ID = batch->get(pending);
+          pending = -1;
+          reflect();
+     }
+}
+
+void Program::use() {
+     resolve();
+     glState.useProgram(ID);
+}
+
+void Program::release() {
+     replace(0);
+}
+
+void Program::replace(unsigned int program) {
+     if (pending != -1) {
+          glDeleteProgram(batch->get(pending));
+          pending = -1;
+     }
+     glState.forgetProgram(ID);
+     glDeleteProgram(ID);
+     ID = program;
+     reflect(); // Locations can move between links and the new program starts with every uniform at zero
+}
+
+void Program::reflect() {
+     uniforms.clear();
+     if (ID == 0) {
+          return;
+     }
+     bindUniformBlocks(ID);
+
+     // Collect name/location/type for every active uniform, uniforms inside blocks have no location and are left out
+     struct Active {
+          std::string name;
+          int location;
+          unsigned int type;
+     };
+     std::vector<Active> active;
+
+     if (GLAD_GL_VERSION_4_3) {
+          int count = 0;
+          int maxLength = 0;
+          glGetProgramInterfaceiv(ID, GL_UNIFORM, GL_ACTIVE_RESOURCES, &count);
+          glGetProgramInterfaceiv(ID, GL_UNIFORM, GL_MAX_NAME_LENGTH, &maxLength);
+          std::vector<char> name(maxLength + 1);
+          const GLenum properties[] = { GL_LOCATION, GL_TYPE };
+          for (int i = 0; i < count; i++) {
+               int values[2];
+               glGetProgramResourceiv(ID, GL_UNIFORM, i, 2, properties, 2, NULL, values);
+               if (values[0] == -1) {
+                    continue;
+               }
+               glGetProgramResourceName(ID, GL_UNIFORM, i, (int)name.size(), NULL, name.data());
+               active.push_back({ name.data(), values[0], (unsigned int)values[1] });
+          }
+     }
+     else {
+          int count = 0;
+          int maxLength = 0;
+          glGetProgramiv(ID, GL_ACTIVE_UNIFORMS, &count);
+          glGetProgramiv(ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+          std::vector<char> name(maxLength + 1);
+          for (int i = 0; i < count; i++) {
+               int size;
+               GLenum type;
+               glGetActiveUniform(ID, i, (int)name.size(), NULL, &size, &type, name.data());
+               int location = glGetUniformLocation(ID, name.data());
+               if (location == -1) {
+                    continue;
+               }
+               active.push_back({ name.data(), location, type });
+          }
+     }
+
+     // At most half full so probes stay short
+     size_t slots = 8;
+     while (slots < active.size() * 2) {
+          slots *= 2;
+     }
+     uniforms.resize(slots);
+
+     for (Active& uniform : active) {
+          // Arrays are reported as "name[0]", set() takes just "name"
+          size_t bracket = uniform.name.find("[0]");
+          if (bracket != std::string::npos && bracket + 3 == uniform.name.size()) {
+               uniform.name.erase(bracket);
+          }
+          uint32_t hash = hashUniformName(uniform.name.c_str());
+          size_t slot = hash & (slots - 1);
+          while (uniforms[slot].location != -1) {
+               slot = (slot + 1) & (slots - 1);
+          }
+          uniforms[slot].hash = hash;
+          uniforms[slot].name = std::move(uniform.name);
+          uniforms[slot].location = uniform.location;
+          uniforms[slot].type = uniform.type;
+     }
+}
+
+Program::Uniform* Program::find(const UniformName& name) {
+     resolve();
+     if (uniforms.empty()) {
+          return NULL;
+     }
+     size_t mask = uniforms.size() - 1;
+     for (size_t slot = name.hash & mask; uniforms[slot].location != -1; slot = (slot + 1) & mask) {
+          if (uniforms[slot].hash == name.hash && uniforms[slot].name == name.name) {
+               return &uniforms[slot];
+          }
+     }
+     return NULL;
+}
+
+bool Program::changed(Uniform& uniform, const void* value, size_t bytes) {
+     if (uniform.valid && memcmp(uniform.value, value, bytes) == 0) {
+          skipped++;
+          return false;
+     }
+     memcpy(uniform.value, value, bytes);
+     uniform.valid = true;
+     return true;
+}
+
+bool Program::set(UniformName name, int value) {
+     Uniform* uniform = find(name);
+     if (uniform == NULL) {
+          return false;
+     }
+     if (changed(*uniform, &value, sizeof(value))) {
+          if (GLAD_GL_VERSION_4_1) {
+               glProgramUniform1i(ID, uniform->location, value);
+          }
+          else {
+               glUniform1i(uniform->location, value);
+          }
+     }
+     return true;
+}
+
+bool Program::set(UniformName name, float value) {
+     Uniform* uniform = find(name);
+     if (uniform == NULL) {
+          return false;
+     }
+     if (changed(*uniform, &value, sizeof(value))) {
+          if (GLAD_GL_VERSION_4_1) {
+               glProgramUniform1f(ID, uniform->location, value);
+          }
+          else {
+               glUniform1f(uniform->location, value);
+          }
+     }
+     return true;
+}
+
+bool Program::set(UniformName name, float x, float y) {
+     Uniform* uniform = find(name);
+     if (uniform == NULL) {
+          return false;
+     }
+     const float value[2] = { x, y };
+     if (changed(*uniform, value, sizeof(value))) {
+          if (GLAD_GL_VERSION_4_1) {
+               glProgramUniform2f(ID, uniform->location, x, y);
+          }
+          else {
+               glUniform2f(uniform->location, x, y);
+          }
+     }
+     return true;
+}
+
+bool Program::set(UniformName name, float x, float y, float z) {
+     Uniform* uniform = find(name);
+     if (uniform == NULL) {
+          return false;
+     }
+     const float value[3] = { x, y, z };
+     if (changed(*uniform, value, sizeof(value))) {
+          if (GLAD_GL_VERSION_4_1) {
+               glProgramUniform3f(ID, uniform->location, x, y, z);
+          }
+          else {
+               glUniform3f(uniform->location, x, y, z);
+          }
+     }
+     return true;
+}
+
+bool Program::set(UniformName name, float x, float y, float z, float w) {
+     Uniform* uniform = find(name);
+     if (uniform == NULL) {
+          return false;
+     }
+     const float value[4] = { x, y, z, w };
+     if (changed(*uniform, value, sizeof(value))) {
+          if (GLAD_GL_VERSION_4_1) {
+               glProgramUniform4f(ID, uniform->location, x, y, z, w);
+          }
+          else {
+               glUniform4f(uniform->location, x, y, z, w);
+          }
+     }
+     return true;
+}
+
+bool Program::setMatrix4(UniformName name, const float* values) {
+     Uniform* uniform = find(name);
+     if (uniform == NULL) {
+          return false;
+     }
+     if (changed(*uniform, values, 16 * sizeof(float))) {
+          if (GLAD_GL_VERSION_4_1) {
+               glProgramUniformMatrix4fv(ID, uniform->location, 1, GL_FALSE, values);
+          }
+          else {
+               glUniformMatrix4fv(uniform->location, 1, GL_FALSE, values);
+          }
+     }
+     return true;
+}
+
+ShaderVariants::ShaderVariants(const char* vertexPath, const char* fragmentPath, ShaderBatch& batch) : vertex(vertexPath), fragment(fragmentPath), batch(&batch) {
+}
+
+Program& ShaderVariants::get(unsigned int features) {
+     auto found = variants.find(features);
+     if (found == variants.end()) {
+          found = variants.emplace(std::piecewise_construct, std::forward_as_tuple(features), std::forward_as_tuple(vertex.c_str(), fragment.c_str(), *batch, features)).first;
+     }
+     return found->second;
+}
+
+void ShaderVariants::release() {
+     for (auto& variant : variants) {
+          variant.second.release();
+     }
+     variants.clear();
+}
@@ -0,0 +1,234 @@
+#include <glad/glad.h>
+#include "programCache.h"
+#include "embeddedShaders.h"
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+// Written at the front of every cache file so a file from some other version of this code gets ignored
+static const char cacheMagic[4] = { 'F', 'P', 'P', 'B' };
+static const uint32_t cacheVersion = 1;
+
+static uint64_t hashBytes(uint64_t hash, const void* data, size_t length) {
+     // FNV-1a, 64 bit
+     const unsigned char* bytes = (const unsigned char*)data;
+     for (size_t i = 0; i < length; i++) {
+          hash ^= bytes[i];
+          hash *= 1099511628211ull;
+     }
+     hash ^= 0xff; // Separator so "ab" + "c" and "a" + "bc" hash differently
+     hash *= 1099511628211ull;
+     return hash;
+}
+
+static std::string glString(GLenum name) {
+     const char* value = (const char*)glGetString(name);
+     return value != NULL ? value : "";
+}
+
+ProgramCache::ProgramCache(const std::string& directory) : directory(directory) {
+     if (directory.empty()) {
+          return;
+     }
+
+     // Program binaries are core in 4.1, some drivers expose them with no formats at all
+          // ARB_get_program_binary would do on 3.3, but glad only loads glProgramBinary and friends with 4.1, so they'd be NULL there
+     GLint formats = 0;
+     if (GLAD_GL_VERSION_4_1) {
+          glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+     }
+     if (formats <= 0) {
+          std::cout << "Program binary cache disabled, the driver has no binary formats" << std::endl;
+          return;
+     }
+
+     std::error_code error;
+     std::filesystem::create_directories(directory, error);
+     if (error) {
+          std::cout << "ERROR::PROGRAM_CACHE::DIRECTORY_NOT_CREATED " << directory << std::endl;
+          return;
+     }
+
+     driverKey = glString(GL_VENDOR) + "|" + glString(GL_RENDERER) + "|" + glString(GL_VERSION);
+     usable = true;
+}
+
+uint64_t ProgramCache::sourceKey(const std::string& vertexSource, const std::string& fragmentSource) {
+     return combineKeys(hashShaderSource(vertexSource.data(), vertexSource.size()), hashShaderSource(fragmentSource.data(), fragmentSource.size()));
+}
+
+uint64_t ProgramCache::combineKeys(uint64_t vertexKey, uint64_t fragmentKey) {
+     uint64_t hash = 14695981039346656037ull;
+     hash = hashBytes(hash, &vertexKey, sizeof(vertexKey));
+     hash = hashBytes(hash, &fragmentKey, sizeof(fragmentKey));
+     return hash;
+}
+
+std::string ProgramCache::entryPath(uint64_t key) const {
+     uint64_t hash = 14695981039346656037ull;
+     hash = hashBytes(hash, &key, sizeof(key));
+     hash = hashBytes(hash, driverKey.data(), driverKey.size());
+
+     char name[17];
+     const char* digits = "0123456789abcdef";
+     for (int i = 0; i < 16; i++) {
+          name[i] = digits[(hash >> (60 - i * 4)) & 0xf];
+     }
+     name[16] = '\0';
+     return directory + "/" + name + ".bin";
+}
+
+unsigned int ProgramCache::build(const std::string& vertexSource, const std::string& fragmentSource, uint64_t key) {
+     auto start = std::chrono::steady_clock::now();
+
+     if (key == 0) {
+          key = sourceKey(vertexSource, fragmentSource);
+     }
+     unsigned int program = lookup(key);
+     if (program == 0) {
+          program = compileFromSource(vertexSource, fragmentSource, usable);
+          insert(program, key);
+     }
+
+     milliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+     return program;
+}
+
+unsigned int ProgramCache::lookup(uint64_t key) {
+     if (!usable) {
+          return 0;
+     }
+     unsigned int program = load(entryPath(key));
+     if (program != 0) {
+          hits++;
+     }
+     return program;
+}
+
+void ProgramCache::insert(unsigned int program, uint64_t key) {
+     if (!usable) {
+          return;
+     }
+     misses++;
+     if (program != 0) {
+          store(program, entryPath(key));
+     }
+}
+
+unsigned int ProgramCache::load(const std::string& path) {
+     std::ifstream file(path, std::ios::binary);
+     if (!file) {
+          return 0;
+     }
+
+     char magic[4];
+     uint32_t version = 0, format = 0, length = 0;
+     file.read(magic, 4);
+     file.read((char*)&version, sizeof(version));
+     file.read((char*)&format, sizeof(format));
+     file.read((char*)&length, sizeof(length));
+     if (!file || std::string(magic, 4) != std::string(cacheMagic, 4) || version != cacheVersion || length == 0) {
+          return 0;
+     }
+     std::vector<char> binary(length);
+     file.read(binary.data(), length);
+     if (!file) {
+          return 0;
+     }
+
+     unsigned int program = glCreateProgram();
+     glProgramBinary(program, (GLenum)format, binary.data(), (GLsizei)length);
+
+     int success;
+     glGetProgramiv(program, GL_LINK_STATUS, &success);
+     if (!success) {
+          // Not an error, the driver just won't take this binary anymore (update, different GPU, ...), it gets rebuilt from source
+          glDeleteProgram(program);
+          rejected++;
+          return 0;
+     }
+     return program;
+}
+
+void ProgramCache::store(unsigned int program, const std::string& path) {
+     GLint length = 0;
+     glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+     if (length <= 0) {
+          return;
+     }
+
+     std::vector<char> binary(length);
+     GLenum format = 0;
+     glGetProgramBinary(program, length, NULL, &format, binary.data());
+
+     // Written to a temporary name first so a crash halfway through can't leave a truncated entry behind
+     std::string temporaryPath = path + ".tmp";
+     {
+          std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+          uint32_t version = cacheVersion, storedFormat = format, storedLength = (uint32_t)length;
+          file.write(cacheMagic, 4);
+          file.write((const char*)&version, sizeof(version));
+          file.write((const char*)&storedFormat, sizeof(storedFormat));
+          file.write((const char*)&storedLength, sizeof(storedLength));
+          file.write(binary.data(), length);
+          if (!file) {
+               std::cout << "ERROR::PROGRAM_CACHE::WRITE_FAILED " << temporaryPath << std::endl;
+               return;
+          }
+     }
+     std::error_code error;
+     std::filesystem::rename(temporaryPath, path, error);
+}
+
+unsigned int ProgramCache::compileFromSource(const std::string& vertexSource, const std::string& fragmentSource, bool retrievable) {
+     int success;
+     char infoLog[512];
+     const char* vertexText = vertexSource.c_str();
+     const char* fragmentText = fragmentSource.c_str();
+
+     unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+     glShaderSource(vertexShader, 1, &vertexText, NULL);
+     glCompileShader(vertexShader);
+     glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
+     if (!success) {
+          glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
+          std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+     }
+
+     unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+     glShaderSource(fragmentShader, 1, &fragmentText, NULL);
+     glCompileShader(fragmentShader);
+     glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
+     if (!success) {
+          glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
+          std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+     }
+
+     unsigned int program = glCreateProgram();
+     if (retrievable && GLAD_GL_VERSION_4_1) {
+          // Tells the driver we'll ask for the binary, some only keep it around when this is set before linking
+          glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+     }
+     glAttachShader(program, vertexShader);
+     glAttachShader(program, fragmentShader);
+     glLinkProgram(program);
+
+     glGetProgramiv(program, GL_LINK_STATUS, &success);
+     if (!success) {
+          glGetProgramInfoLog(program, 512, NULL, infoLog);
+          std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+          glDeleteProgram(program);
+          program = 0;
+     }
+     glDeleteShader(vertexShader);
+     glDeleteShader(fragmentShader);
+     return program;
+}
+
+void ProgramCache::printStats() const {
+     std::cout << "Program cache: " << hits << " loaded, " << misses << " compiled, " << rejected << " rejected binaries, "
+          << milliseconds << " ms building programs" << std::endl;
+}
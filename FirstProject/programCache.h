@@ -0,0 +1,49 @@
+#ifndef PROGRAM_CACHE_H
+#define PROGRAM_CACHE_H
+
+#include <cstdint>
+#include <string>
+
+// Keeps linked program binaries on disk so later launches can skip compiling and linking
+     // Key: a hash of the shader sources (see sourceKey) plus GL_VENDOR, GL_RENDERER and GL_VERSION, so a driver update misses instead of loading stale binaries
+     // Drivers are allowed to reject a binary at any time, when that happens the program is built from source and the cache entry rewritten
+class ProgramCache {
+public:
+     // An empty directory turns the cache off, every program is then compiled from source
+     explicit ProgramCache(const std::string& directory);
+
+     // Returns a linked program, or 0 if it didn't compile or link
+          // key can be left 0 to have it hashed from the sources
+     unsigned int build(const std::string& vertexSource, const std::string& fragmentSource, uint64_t key = 0);
+
+     // The two halves of build(), for callers that compile on their own (see shaderBatch.h)
+          // lookup returns 0 on a miss or when the driver rejects the stored binary
+     unsigned int lookup(uint64_t key);
+     void insert(unsigned int program, uint64_t key);
+
+     // Any hash that changes whenever the sources do works as a key
+          // This one hashes the text, preprocessed shaders already have one that didn't need to (PreprocessedShader::hash)
+     static uint64_t sourceKey(const std::string& vertexSource, const std::string& fragmentSource);
+     static uint64_t combineKeys(uint64_t vertexKey, uint64_t fragmentKey);
+
+     bool enabled() const { return usable; }
+     void printStats() const;
+
+     // Compiles and links without touching the cache, errors are printed like the rest of the project
+     static unsigned int compileFromSource(const std::string& vertexSource, const std::string& fragmentSource, bool retrievable);
+
+private:
+     std::string entryPath(uint64_t key) const;
+     unsigned int load(const std::string& path);
+     void store(unsigned int program, const std::string& path);
+
+     std::string directory;
+     std::string driverKey;
+     bool usable = false;
+     int hits = 0;
+     int misses = 0;
+     int rejected = 0;
+     double milliseconds = 0.0;
+};
+
+#endif
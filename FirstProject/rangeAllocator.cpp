@@ -0,0 +1,69 @@
+#include "rangeAllocator.h"
+#include <iterator>
+
+void RangeAllocator::init(size_t capacity) {
+     freeList.clear();
+     padding.clear();
+     totalBytes = capacity;
+     usedBytes = 0;
+     if (capacity > 0) {
+          freeList[0] = capacity;
+     }
+}
+
+size_t RangeAllocator::allocate(size_t bytes, size_t alignment) {
+     if (bytes == 0) {
+          return invalid;
+     }
+     if (alignment == 0) {
+          alignment = 1;
+     }
+
+     for (auto range = freeList.begin(); range != freeList.end(); ++range) {
+          size_t start = range->first;
+          size_t size = range->second;
+          size_t aligned = (start + alignment - 1) / alignment * alignment;
+          if (aligned + bytes > start + size) {
+               continue;
+          }
+
+          // Whatever is left after the allocation stays free, the bit skipped in front for alignment goes with the allocation
+          freeList.erase(range);
+          size_t end = aligned + bytes;
+          if (end < start + size) {
+               freeList[end] = start + size - end;
+          }
+          if (aligned > start) {
+               padding[aligned] = aligned - start;
+          }
+          usedBytes += end - start;
+          return aligned;
+     }
+     return invalid;
+}
+
+void RangeAllocator::free(size_t offset, size_t bytes) {
+     size_t start = offset;
+     auto skipped = padding.find(offset);
+     if (skipped != padding.end()) {
+          start -= skipped->second;
+          padding.erase(skipped);
+     }
+     size_t size = offset + bytes - start;
+     usedBytes -= size;
+
+     // Merge with the free range right after, then the one right before
+     auto next = freeList.lower_bound(start);
+     if (next != freeList.end() && next->first == start + size) {
+          size += next->second;
+          next = freeList.erase(next);
+     }
+     if (next != freeList.begin()) {
+          auto previous = std::prev(next);
+          if (previous->first + previous->second == start) {
+               previous->second += size;
+               return;
+          }
+     }
+     freeList[start] = size;
+}
@@ -0,0 +1,31 @@
+#ifndef RANGE_ALLOCATOR_H
+#define RANGE_ALLOCATOR_H
+
+#include <cstddef>
+#include <map>
+
+// Hands out byte ranges of something that lives elsewhere (a GL buffer), it never touches memory itself
+     // Free ranges are kept sorted by offset, allocation is first fit and freeing merges with both neighbours
+     // Good enough for meshes that are loaded and unloaded now and then, not for thousands of allocations a frame
+class RangeAllocator {
+public:
+     static const size_t invalid = (size_t)-1;
+
+     void init(size_t capacity);
+     // Returns the offset, a multiple of alignment, or invalid when no free range is big enough
+     size_t allocate(size_t bytes, size_t alignment);
+     // bytes has to be what was asked for in allocate
+     void free(size_t offset, size_t bytes);
+
+     size_t capacity() const { return totalBytes; }
+     size_t used() const { return usedBytes; }
+     size_t freeRanges() const { return freeList.size(); }
+
+private:
+     std::map<size_t, size_t> freeList; // offset -> size
+     std::map<size_t, size_t> padding;  // Allocation offset -> bytes skipped in front of it for alignment, given back on free
+     size_t totalBytes = 0;
+     size_t usedBytes = 0;
+};
+
+#endif
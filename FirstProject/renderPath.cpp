@@ -0,0 +1,211 @@
+#include "renderPath.h"
+#include "glState.h"
+#include "meshFile.h"
+#include "vertexQuantize.h"
+#include <cstring>
+#include <vector>
+
+RenderPath chooseRenderPath(bool forceLegacy) {
+     if (!forceLegacy && GLAD_GL_VERSION_4_5) {
+          return RenderPath::DSA45;
+     }
+     return RenderPath::Bind33;
+}
+
+const char* renderPathName(RenderPath path) {
+     return path == RenderPath::DSA45 ? "4.5 DSA" : "3.3 bind-to-edit";
+}
+
+// Where one attribute's data sits in the vertex buffer
+struct AttributeSource {
+     GLuint binding = 0;          // Vertex buffer binding index, split storage gives each attribute its own
+     GLintptr bufferOffset = 0;   // Start of the binding's data in the buffer
+     GLuint relativeOffset = 0;   // Offset of the attribute inside one vertex of that binding
+     GLsizei stride = 0;
+};
+
+// Split storage rewrites the interleaved vertices into one run per attribute, interleaved storage uploads them as they are
+static const void* arrangeVertices(const VertexFormat& format, const void* vertices, GLsizeiptr vertexBytes, VertexStorage storage,
+     std::vector<unsigned char>& splitData, std::vector<AttributeSource>& sources, GLsizeiptr& bufferBytes) {
+     sources.resize(format.attributeCount);
+     if (storage == VertexStorage::Interleaved) {
+          for (int i = 0; i < format.attributeCount; i++) {
+               sources[i].relativeOffset = format.attributes[i].offset;
+               sources[i].stride = format.stride;
+          }
+          bufferBytes = vertexBytes;
+          return vertices;
+     }
+
+     size_t vertexCount = (size_t)vertexBytes / format.stride;
+     GLintptr offset = 0;
+     for (int i = 0; i < format.attributeCount; i++) {
+          sources[i].binding = (GLuint)i;
+          sources[i].bufferOffset = offset;
+          sources[i].stride = (GLsizei)format.attributes[i].bytes;
+          offset += (GLintptr)(format.attributes[i].bytes * vertexCount);
+          offset = (offset + 3) & ~(GLintptr)3; // Keeps every run 4 byte aligned, GL wants that for the buffer offset
+     }
+     bufferBytes = offset;
+
+     splitData.assign((size_t)bufferBytes, 0);
+     const unsigned char* source = (const unsigned char*)vertices;
+     for (int i = 0; i < format.attributeCount; i++) {
+          const VertexAttribute& attribute = format.attributes[i];
+          unsigned char* destination = splitData.data() + sources[i].bufferOffset;
+          for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+               memcpy(destination + vertex * attribute.bytes, source + vertex * format.stride + attribute.offset, attribute.bytes);
+          }
+     }
+     return splitData.data();
+}
+
+void setVertexArrayAttribute(unsigned int VAO, const VertexAttribute& attribute, GLuint binding, GLuint relativeOffset) {
+     GLuint columnBytes = attribute.bytes / attribute.columns;
+     for (int column = 0; column < attribute.columns; column++) {
+          GLuint location = attribute.location + column;
+          glVertexArrayAttribFormat(VAO, location, attribute.components, attribute.type, attribute.normalized, relativeOffset + column * columnBytes); // attribute, size, type, normalized, offset inside a vertex
+          glVertexArrayAttribBinding(VAO, location, binding);
+          glEnableVertexArrayAttrib(VAO, location);
+     }
+}
+
+void setVertexAttributePointer(const VertexAttribute& attribute, GLsizei stride, size_t offset) {
+     GLuint columnBytes = attribute.bytes / attribute.columns;
+     for (int column = 0; column < attribute.columns; column++) {
+          GLuint location = attribute.location + column;
+          // The pointer is really an offset into whatever is bound to GL_ARRAY_BUFFER
+          glVertexAttribPointer(location, attribute.components, attribute.type, attribute.normalized, stride, (void*)(offset + column * columnBytes));
+          glEnableVertexAttribArray(location);
+     }
+}
+
+static Mesh createMeshBind(const VertexFormat& format, const void* vertices, GLsizeiptr vertexBytes, const void* indices, GLsizeiptr indexBytes, VertexStorage storage) {
+     std::vector<unsigned char> splitData;
+     std::vector<AttributeSource> sources;
+     GLsizeiptr bufferBytes = 0;
+     const void* data = arrangeVertices(format, vertices, vertexBytes, storage, splitData, sources, bufferBytes);
+
+     Mesh mesh;
+     glGenVertexArrays(1, &mesh.VAO);
+     glGenBuffers(1, &mesh.VBO);
+     glGenBuffers(1, &mesh.EBO);
+     mesh.vertexBytes = bufferBytes;
+
+     // Binding
+     glState.bindVertexArray(mesh.VAO);
+
+     glState.bindBuffer(GL_ARRAY_BUFFER, mesh.VBO);
+     glBufferData(GL_ARRAY_BUFFER, bufferBytes, data, GL_STATIC_DRAW);
+
+     glState.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.EBO);
+     glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBytes, indices, GL_STATIC_DRAW);
+
+     // Vertex Attribute
+     for (int i = 0; i < format.attributeCount; i++) {
+          setVertexAttributePointer(format.attributes[i], sources[i].stride, sources[i].bufferOffset + sources[i].relativeOffset);
+     }
+
+     glState.bindBuffer(GL_ARRAY_BUFFER, 0); // We can unbind the array buffer because VBO/EBO are noted inside VAO, they will bind and unbind via VAO
+     glState.bindVertexArray(0); // This isn't directly necessary because when you are binding to a VAO, you have to call glBindVertexArray() anyway which will unbind the current ont
+
+     return mesh;
+}
+
+static Mesh createMeshDSA(const VertexFormat& format, const void* vertices, GLsizeiptr vertexBytes, const void* indices, GLsizeiptr indexBytes, VertexStorage storage) {
+     std::vector<unsigned char> splitData;
+     std::vector<AttributeSource> sources;
+     GLsizeiptr bufferBytes = 0;
+     const void* data = arrangeVertices(format, vertices, vertexBytes, storage, splitData, sources, bufferBytes);
+
+     Mesh mesh;
+     // glCreate* makes the objects right away, glGen* only reserves names until the first bind
+     glCreateVertexArrays(1, &mesh.VAO);
+     glCreateBuffers(1, &mesh.VBO);
+     glCreateBuffers(1, &mesh.EBO);
+     mesh.vertexBytes = bufferBytes;
+
+     // Immutable storage, the data never changes after this so the flags are 0
+     glNamedBufferStorage(mesh.VBO, bufferBytes, data, 0);
+     glNamedBufferStorage(mesh.EBO, indexBytes, indices, 0);
+
+     // The VAO gets told about its buffers by name instead of through whatever happens to be bound
+     glVertexArrayElementBuffer(mesh.VAO, mesh.EBO);
+     for (int i = 0; i < format.attributeCount; i++) {
+          const VertexAttribute& attribute = format.attributes[i];
+          // Interleaved attributes all share binding 0, so it only needs setting once
+          if (i == 0 || sources[i].binding != sources[i - 1].binding) {
+               glVertexArrayVertexBuffer(mesh.VAO, sources[i].binding, mesh.VBO, sources[i].bufferOffset, sources[i].stride); // binding index, offset, stride
+          }
+          setVertexArrayAttribute(mesh.VAO, attribute, sources[i].binding, sources[i].relativeOffset);
+     }
+
+     return mesh;
+}
+
+Mesh createMesh(RenderPath path, const VertexFormat& format, const void* vertices, GLsizeiptr vertexBytes, const unsigned int* indices, GLsizeiptr indexBytes, VertexStorage storage) {
+     size_t indexCount = (size_t)indexBytes / sizeof(unsigned int);
+     size_t vertexCount = (size_t)vertexBytes / format.stride;
+
+     // Half the index bandwidth when every index fits, 65535 itself is left out since it's the usual primitive restart index
+     std::vector<unsigned short> shortIndices;
+     const void* indexData = indices;
+     if (vertexCount <= 65535) {
+          shortIndices.assign(indices, indices + indexCount);
+          indexData = shortIndices.data();
+          indexBytes = (GLsizeiptr)(indexCount * sizeof(unsigned short));
+     }
+
+     Mesh mesh = path == RenderPath::DSA45
+          ? createMeshDSA(format, vertices, vertexBytes, indexData, indexBytes, storage)
+          : createMeshBind(format, vertices, vertexBytes, indexData, indexBytes, storage);
+     mesh.indexCount = (int)indexCount;
+     mesh.indexType = indexData == indices ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+     mesh.indexBytes = indexBytes;
+     return mesh;
+}
+
+Mesh createMeshFromBytes(RenderPath path, const VertexFormat& format, const void* vertices, GLsizeiptr vertexBytes,
+     const void* indices, GLsizeiptr indexBytes, GLenum indexType) {
+     Mesh mesh = path == RenderPath::DSA45
+          ? createMeshDSA(format, vertices, vertexBytes, indices, indexBytes, VertexStorage::Interleaved)
+          : createMeshBind(format, vertices, vertexBytes, indices, indexBytes, VertexStorage::Interleaved);
+     mesh.indexType = indexType;
+     mesh.indexCount = (int)(indexBytes / (indexType == GL_UNSIGNED_SHORT ? sizeof(unsigned short) : sizeof(unsigned int)));
+     mesh.indexBytes = indexBytes;
+     return mesh;
+}
+
+Mesh createMesh(RenderPath path, const MeshFile& file) {
+     const MeshFileHeader& header = file.header();
+     Mesh mesh = createMeshFromBytes(path, file.format(), file.vertices(), (GLsizeiptr)header.vertexBytes,
+          file.indices(), (GLsizeiptr)header.indexBytes, header.indexType);
+     mesh.quantization = file.quantization();
+     return mesh;
+}
+
+Mesh createQuantizedMesh(RenderPath path, const PositionColorVertex* vertices, size_t vertexCount, const unsigned int* indices, size_t indexCount, VertexStorage storage) {
+     QuantizedVertices quantized = quantizeVertices(vertices, vertexCount);
+     Mesh mesh = createMesh(path, quantized.vertices.data(), quantized.vertices.size(), indices, indexCount, storage);
+     mesh.quantization = quantized.quantization;
+     return mesh;
+}
+
+void drawMesh(RenderPath path, const Mesh& mesh) {
+     glState.bindVertexArray(mesh.VAO); // Only reaches GL when a different VAO was bound
+     glDrawElements(GL_TRIANGLES, mesh.indexCount, mesh.indexType, 0);
+     if (path == RenderPath::Bind33) {
+          glState.bindVertexArray(0); // Restting it keeps later bind-to-edit code from changing this VAO
+     }
+     // The DSA path never binds to edit, so the VAO left bound after a draw can't be changed by accident and doesn't need resetting
+}
+
+void deleteMesh(Mesh& mesh) {
+     glState.forgetVertexArray(mesh.VAO);
+     glState.forgetBuffer(mesh.VBO);
+     glState.forgetBuffer(mesh.EBO);
+     glDeleteVertexArrays(1, &mesh.VAO);
+     glDeleteBuffers(1, &mesh.VBO);
+     glDeleteBuffers(1, &mesh.EBO);
+     mesh = Mesh();
+}
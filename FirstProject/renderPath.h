@@ -0,0 +1,65 @@
+#ifndef RENDER_PATH_H
+#define RENDER_PATH_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include "vertexFormat.h"
+
+class MeshFile;
+
+// Which way buffers and vertex arrays get set up
+     // Bind33 : the bind-to-edit way from the tutorials, works on any 3.3 context
+     // DSA45 : direct state access, objects are edited by name so nothing has to be bound just to change it
+enum class RenderPath {
+     Bind33,
+     DSA45
+};
+
+// Picks DSA when the context is 4.5 or newer, unless the fallback is forced
+RenderPath chooseRenderPath(bool forceLegacy);
+const char* renderPathName(RenderPath path);
+
+struct Mesh {
+     unsigned int VAO = 0;
+     unsigned int VBO = 0;
+     unsigned int EBO = 0;
+     int indexCount = 0;
+     GLenum indexType = GL_UNSIGNED_INT; // GL_UNSIGNED_SHORT when every index fits in 16 bits
+     GLsizeiptr vertexBytes = 0;      // Size of the vertex buffer
+     GLsizeiptr indexBytes = 0;       // Size of the index buffer
+     PositionQuantization quantization; // Goes into DrawBlock, only quantized meshes have anything but the identity here
+};
+
+// vertices are always passed interleaved as described by format, storage picks how they end up in the buffer
+// Indices are always passed as unsigned int, meshes with up to 65535 vertices get them stored as unsigned short
+Mesh createMesh(RenderPath path, const VertexFormat& format, const void* vertices, GLsizeiptr vertexBytes, const unsigned int* indices, GLsizeiptr indexBytes,
+     VertexStorage storage = VertexStorage::Interleaved);
+
+template<typename Vertex>
+Mesh createMesh(RenderPath path, const Vertex* vertices, size_t vertexCount, const unsigned int* indices, size_t indexCount,
+     VertexStorage storage = VertexStorage::Interleaved) {
+     return createMesh(path, vertexFormat<Vertex>(), vertices, (GLsizeiptr)(vertexCount * sizeof(Vertex)),
+          indices, (GLsizeiptr)(indexCount * sizeof(unsigned int)), storage);
+}
+// Uploads vertices and indices exactly as given, nothing is converted or copied on the CPU first (binary mesh files, see meshFile.h)
+Mesh createMeshFromBytes(RenderPath path, const VertexFormat& format, const void* vertices, GLsizeiptr vertexBytes,
+     const void* indices, GLsizeiptr indexBytes, GLenum indexType);
+// The streams go from the mapping straight into buffer storage, the file was checked when it was opened
+Mesh createMesh(RenderPath path, const MeshFile& file);
+// Quantizes to CompactVertex (see vertexQuantize.h) and uploads in one go, the mesh keeps the scale and bias its draws need
+Mesh createQuantizedMesh(RenderPath path, const PositionColorVertex* vertices, size_t vertexCount, const unsigned int* indices, size_t indexCount,
+     VertexStorage storage = VertexStorage::Interleaved);
+
+// Points one attribute (every column of a matrix) of a VAO at a buffer binding, DSA only
+void setVertexArrayAttribute(unsigned int VAO, const VertexAttribute& attribute, GLuint binding, GLuint relativeOffset);
+// The bind-to-edit version, the VAO and the buffer on GL_ARRAY_BUFFER have to be bound already
+void setVertexAttributePointer(const VertexAttribute& attribute, GLsizei stride, size_t offset);
+
+void drawMesh(RenderPath path, const Mesh& mesh);
+// Bytes per index, for offsets into the index buffer
+inline int indexSize(const Mesh& mesh) {
+     return mesh.indexType == GL_UNSIGNED_SHORT ? 2 : 4;
+}
+void deleteMesh(Mesh& mesh);
+
+#endif
@@ -0,0 +1,128 @@
+#include <glad/glad.h>
+#include "shaderBatch.h"
+#include "programCache.h"
+#include <chrono>
+#include <iostream>
+
+ShaderBatch::ShaderBatch(ProgramCache* cache) : cache(cache) {
+     // ARB_parallel_shader_compile uses the same GL_COMPLETION_STATUS value, only the thread count call is missing
+     parallelCompile = GLAD_GL_KHR_parallel_shader_compile || gladHasExtension("GL_ARB_parallel_shader_compile");
+     if (GLAD_GL_KHR_parallel_shader_compile) {
+          glMaxShaderCompilerThreadsKHR(0xFFFFFFFF); // Let the driver use as many threads as it wants
+     }
+}
+
+int ShaderBatch::submit(const std::string& vertexSource, const std::string& fragmentSource, uint64_t key) {
+     auto start = std::chrono::steady_clock::now();
+     Entry entry;
+
+     if (cache != NULL) {
+          entry.key = key != 0 ? key : ProgramCache::sourceKey(vertexSource, fragmentSource);
+          entry.program = cache->lookup(entry.key);
+          entry.finished = entry.program != 0;
+     }
+
+     if (!entry.finished) {
+          // Same steps as ProgramCache::compileFromSource, minus every status check, those are what would block
+          const char* vertexText = vertexSource.c_str();
+          const char* fragmentText = fragmentSource.c_str();
+
+          entry.vertexShader = glCreateShader(GL_VERTEX_SHADER);
+          glShaderSource(entry.vertexShader, 1, &vertexText, NULL);
+          glCompileShader(entry.vertexShader);
+
+          entry.fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+          glShaderSource(entry.fragmentShader, 1, &fragmentText, NULL);
+          glCompileShader(entry.fragmentShader);
+
+          entry.program = glCreateProgram();
+          // enabled() already means 4.1, checked again since glProgramParameteri is NULL without it
+          if (cache != NULL && cache->enabled() && GLAD_GL_VERSION_4_1) {
+               glProgramParameteri(entry.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+          }
+          glAttachShader(entry.program, entry.vertexShader);
+          glAttachShader(entry.program, entry.fragmentShader);
+          glLinkProgram(entry.program);
+     }
+
+     entries.push_back(entry);
+     submitMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+     return (int)entries.size() - 1;
+}
+
+void ShaderBatch::poll() {
+     if (!parallelCompile) {
+          return; // Without the extension any status query can block, so there's nothing safe to ask
+     }
+     for (Entry& entry : entries) {
+          if (entry.finished) {
+               continue;
+          }
+          int done = GL_FALSE;
+          glGetProgramiv(entry.program, GL_COMPLETION_STATUS_KHR, &done);
+          if (done) {
+               finish(entry);
+               finishedByPoll++;
+          }
+     }
+}
+
+bool ShaderBatch::ready(int handle) const {
+     return entries[handle].finished;
+}
+
+unsigned int ShaderBatch::get(int handle) {
+     Entry& entry = entries[handle];
+     if (!entry.finished) {
+          auto start = std::chrono::steady_clock::now();
+          finish(entry);
+          blockedMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+     }
+     return entry.program;
+}
+
+void ShaderBatch::waitAll() {
+     for (int i = 0; i < (int)entries.size(); i++) {
+          get(i);
+     }
+}
+
+void ShaderBatch::finish(Entry& entry) {
+     int success;
+     char infoLog[512];
+
+     glGetShaderiv(entry.vertexShader, GL_COMPILE_STATUS, &success);
+     if (!success) {
+          glGetShaderInfoLog(entry.vertexShader, 512, NULL, infoLog);
+          std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+     }
+     glGetShaderiv(entry.fragmentShader, GL_COMPILE_STATUS, &success);
+     if (!success) {
+          glGetShaderInfoLog(entry.fragmentShader, 512, NULL, infoLog);
+          std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+     }
+
+     glGetProgramiv(entry.program, GL_LINK_STATUS, &success);
+     if (!success) {
+          glGetProgramInfoLog(entry.program, 512, NULL, infoLog);
+          std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+          glDeleteProgram(entry.program);
+          entry.program = 0;
+     }
+     glDeleteShader(entry.vertexShader);
+     glDeleteShader(entry.fragmentShader);
+
+     if (cache != NULL) {
+          cache->insert(entry.program, entry.key);
+     }
+
+     entry.vertexShader = 0;
+     entry.fragmentShader = 0;
+     entry.finished = true;
+}
+
+void ShaderBatch::printStats() const {
+     std::cout << "Shader batch: " << entries.size() << " programs (" << (parallelCompile ? "parallel" : "serial") << " compile), "
+          << submitMilliseconds << " ms submitting, " << blockedMilliseconds << " ms blocked waiting, "
+          << finishedByPoll << " finished in the background" << std::endl;
+}
@@ -0,0 +1,52 @@
+#ifndef SHADER_BATCH_H
+#define SHADER_BATCH_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ProgramCache;
+
+// Compiles many programs at once instead of one after the other
+     // submit() starts compiling and linking and returns right away, no status is checked yet
+     // With KHR_parallel_shader_compile the driver works on them on its own threads and poll() can tell when each one is done without blocking
+     // get() only blocks when a program is actually needed, so startup costs about as much as the slowest program instead of all of them added up
+class ShaderBatch {
+public:
+     // The cache is optional, programs it already has are ready as soon as they're submitted
+     explicit ShaderBatch(ProgramCache* cache = NULL);
+
+     // key is the program cache key, 0 hashes it from the sources (see ProgramCache::sourceKey)
+     int submit(const std::string& vertexSource, const std::string& fragmentSource, uint64_t key = 0);
+
+     // Finishes every program the driver says is done, never blocks
+     void poll();
+     bool ready(int handle) const;
+
+     // Returns the linked program (0 if it failed), blocking until it's done if it has to
+     unsigned int get(int handle);
+     void waitAll();
+
+     bool parallel() const { return parallelCompile; }
+     void printStats() const;
+
+private:
+     struct Entry {
+          uint64_t key = 0;
+          unsigned int vertexShader = 0;
+          unsigned int fragmentShader = 0;
+          unsigned int program = 0;
+          bool finished = false;
+     };
+
+     void finish(Entry& entry);
+
+     ProgramCache* cache;
+     bool parallelCompile = false;
+     std::vector<Entry> entries;
+     double submitMilliseconds = 0.0;
+     double blockedMilliseconds = 0.0;
+     int finishedByPoll = 0;
+};
+
+#endif
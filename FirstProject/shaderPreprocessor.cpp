@@ -0,0 +1,118 @@
+#include "shaderPreprocessor.h"
+#include "embeddedShaders.h"
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+
+const char* const shaderFeatureDefines[] = {
+     "VERTEX_COLOR",
+     "INSTANCED",
+     "MULTI_DRAW",
+     "TEXTURED"
+};
+const int shaderFeatureCount = sizeof(shaderFeatureDefines) / sizeof(shaderFeatureDefines[0]);
+
+// Returns the file name when the line is an #include "..." directive
+static bool parseInclude(const std::string& line, std::string& name) {
+     size_t at = line.find_first_not_of(" \t");
+     if (at == std::string::npos || line.compare(at, 8, "#include") != 0) {
+          return false;
+     }
+     size_t open = line.find('"', at + 8);
+     size_t close = open == std::string::npos ? std::string::npos : line.find('"', open + 1);
+     if (close == std::string::npos) {
+          return false;
+     }
+     name = line.substr(open + 1, close - open - 1);
+     return true;
+}
+
+// Bump when the output format changes, so cache keys made from the hash don't outlive it
+static const uint64_t preprocessorVersion = 1;
+
+static uint64_t mixHash(uint64_t hash, uint64_t value) {
+     for (int i = 0; i < 8; i++) {
+          hash ^= (value >> (i * 8)) & 0xff;
+          hash *= 1099511628211ull;
+     }
+     return hash;
+}
+
+static void writeDefines(unsigned int features, std::ostringstream& out) {
+     for (int bit = 0; bit < shaderFeatureCount; bit++) {
+          if (features & (1u << bit)) {
+               out << "#define " << shaderFeatureDefines[bit] << " 1\n";
+          }
+     }
+}
+
+static bool appendFile(const std::string& path, unsigned int features, PreprocessedShader& result, std::ostringstream& out) {
+     for (const std::string& file : result.files) {
+          if (file == path) {
+               return true; // Already pasted in once
+          }
+     }
+     std::string text;
+     uint64_t textHash;
+     std::string diskPath;
+     if (!loadShaderSource(path, text, textHash, diskPath)) {
+          return false;
+     }
+     int fileNumber = (int)result.files.size();
+     result.files.push_back(path);
+     if (!diskPath.empty()) {
+          result.diskPaths.push_back(diskPath);
+     }
+     result.hash = mixHash(result.hash, textHash);
+     std::filesystem::path directory = std::filesystem::path(path).parent_path();
+
+     std::istringstream in(text);
+     std::string line;
+     int lineNumber = 0;
+     if (fileNumber != 0) {
+          out << "#line 1 " << fileNumber << "\n";
+     }
+     else if (text.compare(0, 8, "#version") != 0) {
+          writeDefines(features, out); // No #version to put them after
+          out << "#line 1 0\n";
+     }
+     while (std::getline(in, line)) {
+          lineNumber++;
+          std::string include;
+          if (parseInclude(line, include)) {
+               std::string includePath = (directory / include).generic_string();
+               if (!appendFile(includePath, features, result, out)) {
+                    std::cout << "ERROR::SHADER::INCLUDE_NOT_FOUND " << includePath << " (from " << path << ":" << lineNumber << ")" << std::endl;
+                    result.ok = false;
+               }
+               // Back to this file's numbering, #line names the line after it
+               out << "#line " << lineNumber + 1 << " " << fileNumber << "\n";
+               continue;
+          }
+          if (line.compare(0, 8, "#version") == 0) {
+               if (fileNumber == 0) {
+                    out << line << "\n";
+                    writeDefines(features, out);
+                    out << "#line " << lineNumber + 1 << " 0\n";
+               }
+               else {
+                    // Only the top file gets to say the version, an included one just keeps its numbering
+                    out << "#line " << lineNumber + 1 << " " << fileNumber << "\n";
+               }
+               continue;
+          }
+          out << line << "\n";
+     }
+     return true;
+}
+
+PreprocessedShader preprocessShader(const std::string& path, unsigned int features) {
+     PreprocessedShader result;
+     result.hash = mixHash(mixHash(14695981039346656037ull, preprocessorVersion), features);
+     std::ostringstream out;
+     if (!appendFile(path, features, result, out)) {
+          result.ok = false;
+     }
+     result.source = out.str();
+     return result;
+}
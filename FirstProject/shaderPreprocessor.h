@@ -0,0 +1,34 @@
+#ifndef SHADER_PREPROCESSOR_H
+#define SHADER_PREPROCESSOR_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Feature flags a shader can be specialized on, each bit becomes a #define
+     // Shaders use #ifdef on these instead of branching on a uniform, so every variant only contains the code it runs
+enum ShaderFeature : unsigned int {
+     ShaderFeatureVertexColor = 1u << 0, // VERTEX_COLOR : color comes from vertex attribute 1 instead of the ourColor uniform
+     ShaderFeatureInstanced = 1u << 1,   // INSTANCED : transform and tint per instance from attributes 2 to 6, see instanceRenderer.h
+     ShaderFeatureMultiDraw = 1u << 2,   // MULTI_DRAW : DrawBlock comes from a storage buffer indexed by gl_DrawID, see indirectRenderer.h
+     ShaderFeatureTextured = 1u << 3     // TEXTURED : color is multiplied by diffuseTexture (unit 0) at the texture coordinate from attribute 7
+};
+
+// The #define name for each bit, in bit order
+extern const char* const shaderFeatureDefines[];
+extern const int shaderFeatureCount;
+
+struct PreprocessedShader {
+     std::string source;
+     std::vector<std::string> files; // The file itself and everything it included, #line gives each its number in this order (drivers that report it print "file:line")
+     std::vector<std::string> diskPaths; // The ones that were read from disk rather than embedded, what a file watcher should look at
+     uint64_t hash = 0; // Made from the files' hashes (compile time ones for embedded files) and the features, without hashing the output
+     bool ok = true;
+};
+
+// Reads a shader file (see loadShaderSource() in embeddedShaders.h), pastes in #include "file" (relative to the including file) and adds the defines for the features right after #version
+     // A file is only ever pasted once, later includes of it are dropped, so there's no need for include guards
+     // Includes are always followed, even inside an #ifdef that turns out to be off
+PreprocessedShader preprocessShader(const std::string& path, unsigned int features);
+
+#endif
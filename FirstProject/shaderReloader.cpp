@@ -0,0 +1,144 @@
+#include "shaderReloader.h"
+#include "fileWatcher.h"
+#include "programCache.h"
+#include "shaderPreprocessor.h"
+#include <custom/program.h>
+#include <chrono>
+#include <iostream>
+
+ShaderReloader::~ShaderReloader() {
+     stop();
+}
+
+void ShaderReloader::watch(Program& program, const char* vertexPath, const char* fragmentPath, unsigned int features) {
+     programs.push_back({ &program, vertexPath, fragmentPath, features, {} });
+}
+
+// Fills in which files a program depends on, returns false if they don't preprocess cleanly
+static bool preprocessBoth(const std::string& vertexPath, const std::string& fragmentPath, unsigned int features,
+     std::string& vertexSource, std::string& fragmentSource, std::vector<std::string>& files) {
+     PreprocessedShader vertex = preprocessShader(vertexPath, features);
+     PreprocessedShader fragment = preprocessShader(fragmentPath, features);
+     vertexSource = vertex.source;
+     fragmentSource = fragment.source;
+     // Embedded files can't change while running, only what was read from disk is worth watching
+     files = vertex.diskPaths;
+     files.insert(files.end(), fragment.diskPaths.begin(), fragment.diskPaths.end());
+     return vertex.ok && fragment.ok;
+}
+
+bool ShaderReloader::start(const HeadlessContext& sharedContext) {
+     if (worker.joinable()) {
+          return true;
+     }
+     context = sharedContext;
+     running = true;
+     worker = std::thread(&ShaderReloader::run, this);
+     return true;
+}
+
+void ShaderReloader::stop() {
+     if (!worker.joinable()) {
+          return;
+     }
+     running = false;
+     worker.join();
+
+     // Anything that never got swapped in is thrown away, the main context is current here
+     for (Reloaded& reloaded : ready) {
+          waiting.push_back(reloaded);
+     }
+     ready.clear();
+     for (Reloaded& reloaded : waiting) {
+          glDeleteSync(reloaded.fence);
+          glDeleteProgram(reloaded.ID);
+     }
+     waiting.clear();
+}
+
+void ShaderReloader::apply() {
+     {
+          std::lock_guard<std::mutex> lock(readyMutex);
+          for (Reloaded& reloaded : ready) {
+               waiting.push_back(reloaded);
+          }
+          ready.clear();
+     }
+
+     for (size_t i = 0; i < waiting.size();) {
+          Reloaded& reloaded = waiting[i];
+          // A zero timeout only asks, a program whose link hasn't landed yet just waits for the next frame
+          GLenum status = glClientWaitSync(reloaded.fence, 0, 0);
+          if (status == GL_TIMEOUT_EXPIRED) {
+               i++;
+               continue;
+          }
+          glDeleteSync(reloaded.fence);
+          reloaded.program->replace(reloaded.ID);
+          waiting.erase(waiting.begin() + i);
+     }
+}
+
+void ShaderReloader::run() {
+     if (!makeContextCurrent(context)) {
+          std::cout << "ERROR::SHADER_RELOADER::MAKE_CURRENT_FAILED" << std::endl;
+          running = false;
+          return;
+     }
+
+     FileWatcher watcher;
+     for (Watched& watched : programs) {
+          std::string vertexSource, fragmentSource;
+          preprocessBoth(watched.vertexPath, watched.fragmentPath, watched.features, vertexSource, fragmentSource, watched.files);
+          for (const std::string& file : watched.files) {
+               watcher.watch(file);
+          }
+     }
+
+     while (running) {
+          std::vector<std::string> changed = watcher.wait(100);
+          if (changed.empty()) {
+               continue;
+          }
+          // Saving often shows up as several events (create, write, rename), let them all land before reading
+          std::vector<std::string> more;
+          do {
+               more = watcher.wait(50);
+               changed.insert(changed.end(), more.begin(), more.end());
+          } while (!more.empty());
+
+          for (Watched& watched : programs) {
+               bool touched = false;
+               for (const std::string& path : changed) {
+                    for (const std::string& file : watched.files) {
+                         touched = touched || path == file;
+                    }
+               }
+               if (!touched) {
+                    continue;
+               }
+
+               auto start = std::chrono::steady_clock::now();
+               std::string vertexSource, fragmentSource;
+               bool preprocessed = preprocessBoth(watched.vertexPath, watched.fragmentPath, watched.features, vertexSource, fragmentSource, watched.files);
+               for (const std::string& file : watched.files) {
+                    watcher.watch(file); // The edit may have added an include
+               }
+               unsigned int ID = preprocessed ? ProgramCache::compileFromSource(vertexSource, fragmentSource, false) : 0;
+               if (ID == 0) {
+                    std::cout << "Shader reload failed, keeping the old program (" << watched.vertexPath << ", " << watched.fragmentPath << ")" << std::endl;
+                    continue;
+               }
+               // The main context may only use the program once this context's commands are done, the fence says when
+               GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+               glFlush();
+               std::cout << "Reloaded " << watched.vertexPath << " + " << watched.fragmentPath << " in "
+                    << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() << " ms" << std::endl;
+
+               std::lock_guard<std::mutex> lock(readyMutex);
+               ready.push_back({ watched.program, ID, fence });
+          }
+     }
+
+     releaseContext(context);
+}
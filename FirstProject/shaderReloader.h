@@ -0,0 +1,63 @@
+#ifndef SHADER_RELOADER_H
+#define SHADER_RELOADER_H
+
+#include <glad/glad.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "headless.h"
+
+class Program;
+
+// Recompiles programs when their shader files change, without the render loop ever waiting on the compiler
+     // A worker thread watches the files and compiles on its own context that shares objects with the main one
+     // Finished programs are handed over with a fence, apply() swaps them in at the start of a frame once the fence has passed and never waits on it
+     // A program that fails to compile or link is dropped and the old one keeps being used
+class ShaderReloader {
+public:
+     ShaderReloader() = default;
+     ~ShaderReloader();
+     ShaderReloader(const ShaderReloader&) = delete;
+     ShaderReloader& operator=(const ShaderReloader&) = delete;
+
+     // Programs have to be added before start(), features has to match what the program was built with
+          // Files the shaders #include are watched too
+     void watch(Program& program, const char* vertexPath, const char* fragmentPath, unsigned int features = 0);
+
+     // Takes the context the worker compiles on, see createSharedContext() in headless.h
+     bool start(const HeadlessContext& sharedContext);
+     void stop();
+
+     // Call once per frame, before anything is drawn
+     void apply();
+
+private:
+     struct Watched {
+          Program* program;
+          std::string vertexPath;
+          std::string fragmentPath;
+          unsigned int features;
+          std::vector<std::string> files; // Both shaders and their includes, as read from disk
+     };
+
+     struct Reloaded {
+          Program* program;
+          unsigned int ID;
+          GLsync fence;
+     };
+
+     void run();
+
+     std::vector<Watched> programs;
+     HeadlessContext context;
+     std::thread worker;
+     std::atomic<bool> running{ false };
+
+     std::mutex readyMutex;
+     std::vector<Reloaded> ready; // Written by the worker, taken by apply()
+     std::vector<Reloaded> waiting; // Only touched by apply(), fences that hadn't passed yet
+};
+
+#endif
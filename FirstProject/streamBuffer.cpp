@@ -0,0 +1,138 @@
+#include "streamBuffer.h"
+#include "glState.h"
+#include <iostream>
+
+bool StreamBuffer::init(RenderPath path, const VertexFormat& format, size_t maxVerticesPerFrame) {
+     this->path = path;
+     this->format = format;
+     // Whole vertices per region, so every allocation's offset divides into a first vertex
+     regionBytes = maxVerticesPerFrame * format.stride;
+     size_t totalBytes = regionBytes * regions;
+
+     // Set up through GL_COPY_WRITE_BUFFER, which no VAO remembers
+     glGenBuffers(1, &buffer);
+     glState.bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+     if (GLAD_GL_VERSION_4_4) {
+          const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+          glBufferStorage(GL_COPY_WRITE_BUFFER, totalBytes, NULL, flags);
+          mapped = (unsigned char*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, totalBytes, flags);
+          if (mapped == NULL) {
+               std::cout << "ERROR::STREAM_BUFFER::MAP_FAILED" << std::endl;
+               glState.forgetBuffer(buffer);
+               glDeleteBuffers(1, &buffer);
+               buffer = 0;
+               return false;
+          }
+          persistent = true;
+     }
+     else {
+          glBufferData(GL_COPY_WRITE_BUFFER, totalBytes, NULL, GL_STREAM_DRAW);
+          staging.resize(totalBytes);
+          mapped = staging.data();
+     }
+
+     if (path == RenderPath::DSA45) {
+          glCreateVertexArrays(1, &VAO);
+          glVertexArrayVertexBuffer(VAO, 0, buffer, 0, format.stride);
+          for (int i = 0; i < format.attributeCount; i++) {
+               setVertexArrayAttribute(VAO, format.attributes[i], 0, format.attributes[i].offset);
+          }
+     }
+     else {
+          glGenVertexArrays(1, &VAO);
+          glState.bindVertexArray(VAO);
+          glState.bindBuffer(GL_ARRAY_BUFFER, buffer);
+          for (int i = 0; i < format.attributeCount; i++) {
+               setVertexAttributePointer(format.attributes[i], format.stride, format.attributes[i].offset);
+          }
+          glState.bindBuffer(GL_ARRAY_BUFFER, 0);
+          glState.bindVertexArray(0);
+     }
+     return true;
+}
+
+void StreamBuffer::shutdown() {
+     fences.release();
+     if (VAO != 0) {
+          glState.forgetVertexArray(VAO);
+          glDeleteVertexArrays(1, &VAO);
+          VAO = 0;
+     }
+     if (buffer != 0) {
+          if (persistent) {
+               glState.bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+               glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+          }
+          glState.forgetBuffer(buffer);
+          glDeleteBuffers(1, &buffer);
+          buffer = 0;
+     }
+     mapped = NULL;
+     staging.clear();
+}
+
+void StreamBuffer::beginFrame() {
+     fences.advance(true);
+     region = fences.region();
+     used = 0;
+     uploaded = 0;
+     frames++;
+}
+
+StreamAllocation StreamBuffer::allocate(size_t vertexCount) {
+     StreamAllocation allocation;
+     size_t bytes = vertexCount * format.stride;
+     if (buffer == 0 || vertexCount == 0) {
+          return allocation;
+     }
+     if (used + bytes > regionBytes) {
+          overflows++;
+          return allocation;
+     }
+
+     size_t offset = regionBytes * region + used;
+     allocation.vertices = mapped + offset;
+     allocation.firstVertex = (GLint)(offset / format.stride);
+     allocation.count = (GLsizei)vertexCount;
+     used += bytes;
+     vertices += (long long)vertexCount;
+     return allocation;
+}
+
+void StreamBuffer::draw(GLenum mode, const StreamAllocation& allocation) {
+     if (!allocation.valid()) {
+          return;
+     }
+     size_t end = (size_t)(allocation.firstVertex + allocation.count) * format.stride - regionBytes * region;
+     if (!persistent && uploaded < end) {
+          // Everything up to the end of this allocation goes up in one call, earlier allocations that weren't drawn yet included
+          size_t offset = regionBytes * region + uploaded;
+          glState.bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+          glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)offset, (GLsizeiptr)(end - uploaded), staging.data() + offset);
+          uploaded = end;
+     }
+     glState.bindVertexArray(VAO);
+     glDrawArrays(mode, allocation.firstVertex, allocation.count);
+     if (path == RenderPath::Bind33) {
+          glState.bindVertexArray(0);
+     }
+}
+
+void StreamBuffer::endFrame() {
+     if (buffer != 0) {
+          fences.fence();
+     }
+}
+
+void StreamBuffer::printStats() const {
+     if (frames == 0) {
+          return;
+     }
+     std::cout << "Stream buffer (" << (persistent ? "persistent map" : "glBufferSubData") << "): "
+          << regions << " x " << regionBytes << " bytes, " << (double)vertices / frames << " vertices per frame, "
+          << fences.stalls() << " frames waited on the GPU";
+     if (overflows > 0) {
+          std::cout << ", " << overflows << " allocations didn't fit";
+     }
+     std::cout << std::endl;
+}
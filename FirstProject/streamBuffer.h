@@ -0,0 +1,66 @@
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <vector>
+#include "frameFences.h"
+#include "renderPath.h"
+#include "vertexFormat.h"
+
+// A piece of this frame's region, write count vertices to vertices and hand it to StreamBuffer::draw()
+struct StreamAllocation {
+     void* vertices = NULL;
+     GLint firstVertex = 0; // Counted from the start of the buffer, what glDrawArrays takes as first
+     GLsizei count = 0;
+     bool valid() const { return vertices != NULL; }
+};
+
+// Vertex buffer for geometry that's rebuilt every frame (particles, debug lines, UI), set up once and never reallocated
+     // Split into a region per frame in flight like UniformRing, each fenced when its frame is submitted and waited on before it's reused
+     // On 4.4+ the buffer is mapped once with glBufferStorage (persistent + coherent), allocate() hands out pointers straight into it
+     // On 3.3 allocate() hands out pointers into a CPU copy instead, draw() uploads what was written with glBufferSubData
+// The mapping is write combined memory: write vertices in order and never read them back
+class StreamBuffer {
+public:
+     static const int regions = FrameFences::regions;
+
+     // Room for maxVerticesPerFrame vertices of the given format every frame, with its own VAO
+     bool init(RenderPath path, const VertexFormat& format, size_t maxVerticesPerFrame);
+     void shutdown();
+
+     // Moves to the next region, waiting on its fence if the GPU is still reading it
+     void beginFrame();
+     // Invalid when this frame's region is full
+     StreamAllocation allocate(size_t vertexCount);
+     template<typename Vertex>
+     Vertex* allocate(size_t vertexCount, StreamAllocation& allocation) {
+          allocation = allocate(vertexCount);
+          return (Vertex*)allocation.vertices;
+     }
+     // glDrawArrays over an allocation, with whatever program is in use
+     void draw(GLenum mode, const StreamAllocation& allocation);
+     void endFrame();
+
+     void printStats() const;
+
+private:
+     RenderPath path = RenderPath::Bind33;
+     VertexFormat format;
+     unsigned int VAO = 0;
+     unsigned int buffer = 0;
+     unsigned char* mapped = NULL; // Points at staging when falling back to glBufferSubData
+     bool persistent = false;
+     std::vector<unsigned char> staging;
+     size_t regionBytes = 0;
+     int region = 0;
+     size_t used = 0;
+     size_t uploaded = 0; // 3.3 only, how much of this frame's region glBufferSubData has already sent
+     FrameFences fences;
+
+     long long frames = 0;
+     long long vertices = 0;
+     long long overflows = 0;
+};
+
+#endif
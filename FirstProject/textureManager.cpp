@@ -0,0 +1,333 @@
+#include "textureManager.h"
+#include "glState.h"
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+// The implementation lives in this file, stb_image.h sits with the other external headers
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_ONLY_PNG
+#define STBI_ONLY_JPEG
+#include <stb_image.h>
+
+TextureManager::~TextureManager() {
+     shutdown();
+}
+
+bool TextureManager::init(RenderPath path, const TextureManagerSettings& settings) {
+     this->path = path;
+     this->settings = settings;
+     if (this->settings.queueCapacity < 1) {
+          this->settings.queueCapacity = 1;
+     }
+     glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+     // Rows wider than the budget go up a piece at a time, but a region has to fit at least one pixel
+     if (this->settings.uploadBudgetBytes < 4) {
+          std::cout << "WARNING::TEXTURE_MANAGER::UPLOAD_BUDGET " << this->settings.uploadBudgetBytes << " bytes is less than a pixel, using 4" << std::endl;
+          this->settings.uploadBudgetBytes = 4;
+     }
+     size_t regionBytes = this->settings.uploadBudgetBytes;
+
+     if (GLAD_GL_VERSION_4_4) {
+          const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+          glGenBuffers(1, &unpackBuffers[0]);
+          glState.bindBuffer(GL_PIXEL_UNPACK_BUFFER, unpackBuffers[0]);
+          glBufferStorage(GL_PIXEL_UNPACK_BUFFER, regionBytes * regions, NULL, flags);
+          mapped = (unsigned char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, regionBytes * regions, flags);
+          if (mapped == NULL) {
+               // Not fatal, uploads go through a buffer per region instead
+               std::cout << "ERROR::TEXTURE_MANAGER::MAP_FAILED" << std::endl;
+               glState.forgetBuffer(unpackBuffers[0]);
+               glDeleteBuffers(1, &unpackBuffers[0]);
+               unpackBuffers[0] = 0;
+          }
+          persistent = mapped != NULL;
+     }
+     if (!persistent) {
+          glGenBuffers(regions, unpackBuffers);
+          for (unsigned int buffer : unpackBuffers) {
+               glState.bindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+               glBufferData(GL_PIXEL_UNPACK_BUFFER, regionBytes, NULL, GL_STREAM_DRAW);
+          }
+     }
+     // Anything bound here turns the pointer of every later glTexImage2D and glTexSubImage2D into an offset into it
+     glState.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+     const unsigned char white[4] = { 255, 255, 255, 255 };
+     fallback = createTexture(1, 1);
+     if (path == RenderPath::DSA45) {
+          glTextureSubImage2D(fallback, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, white);
+     }
+     else {
+          glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, white); // createTexture left it bound
+     }
+
+     workers.start(settings.workers, this->settings.queueCapacity, [this](const Request& request) { return decode(request); });
+     return true;
+}
+
+void TextureManager::shutdown() {
+     if (!workers.running()) {
+          return;
+     }
+     workers.stop();
+     current = DecodedImage();
+     uploading = false;
+     pending.clear();
+
+     fences.release();
+     if (persistent) {
+          glState.bindBuffer(GL_PIXEL_UNPACK_BUFFER, unpackBuffers[0]);
+          glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+          glState.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+          mapped = NULL;
+     }
+     for (unsigned int& buffer : unpackBuffers) {
+          if (buffer != 0) {
+               glState.forgetBuffer(buffer);
+               glDeleteBuffers(1, &buffer);
+               buffer = 0;
+          }
+     }
+     for (Slot& slot : slots) {
+          if (slot.texture != 0) {
+               glState.forgetTexture(slot.texture);
+               glDeleteTextures(1, &slot.texture);
+               slot.texture = 0;
+          }
+     }
+     glState.forgetTexture(fallback);
+     glDeleteTextures(1, &fallback);
+     fallback = 0;
+}
+
+int TextureManager::load(const std::string& path) {
+     // "textures/../textures/wall.png" and "textures/wall.png" are the same file, so they share a handle
+     std::string key = std::filesystem::path(path).lexically_normal().generic_string();
+     auto found = handles.find(key);
+     if (found != handles.end()) {
+          sharedLoads++;
+          return found->second;
+     }
+
+     int handle = (int)slots.size();
+     Slot slot;
+     slot.path = path;
+     slots.push_back(slot);
+     handles.emplace(key, handle);
+     loading++;
+     workers.push({ handle, path });
+     return handle;
+}
+
+void TextureManager::bind(int handle, int unit) const {
+     glState.bindTexture(unit, GL_TEXTURE_2D, texture(handle));
+}
+
+TextureManager::DecodedImage TextureManager::decode(const Request& request) const {
+     DecodedImage image;
+     image.handle = request.handle;
+     int width = 0, height = 0, channels = 0;
+     unsigned char* pixels = stbi_load(request.path.c_str(), &width, &height, &channels, 4); // 4 : always RGBA8, whatever the file has
+     if (pixels == NULL) {
+          const char* reason = stbi_failure_reason();
+          image.error = reason != NULL ? reason : "couldn't decode";
+          return image;
+     }
+
+     // The copy out of stb's memory flips it for free, stbi_set_flip_vertically_on_load is a global the other workers would see too
+     size_t rowBytes = (size_t)width * 4;
+     image.pixels.resize(rowBytes * height);
+     for (int row = 0; row < height; row++) {
+          int sourceRow = settings.flipVertically ? height - 1 - row : row;
+          memcpy(image.pixels.data() + rowBytes * row, pixels + rowBytes * sourceRow, rowBytes);
+     }
+     stbi_image_free(pixels);
+     image.width = width;
+     image.height = height;
+     return image;
+}
+
+// Every level allocated at once, the base level gets filled in by update() and the rest by glGenerateMipmap
+unsigned int TextureManager::createTexture(int width, int height) {
+     int levels = 1;
+     int largest = width > height ? width : height;
+     while (settings.mipmaps && (largest >> levels) > 0) {
+          levels++;
+     }
+     GLenum internalFormat = settings.srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+     GLint minFilter = levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+
+     unsigned int texture = 0;
+     if (path == RenderPath::DSA45) {
+          glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+          glTextureStorage2D(texture, levels, internalFormat, width, height);
+          glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, minFilter);
+          glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+          return texture;
+     }
+
+     glGenTextures(1, &texture);
+     glState.bindTexture(0, GL_TEXTURE_2D, texture);
+     if (GLAD_GL_VERSION_4_2) {
+          glTexStorage2D(GL_TEXTURE_2D, levels, internalFormat, width, height);
+     }
+     else {
+          // NULL only means "no data" while nothing is bound to GL_PIXEL_UNPACK_BUFFER, and this frame's region may be
+          glState.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+          for (int level = 0; level < levels; level++) {
+               int levelWidth = width >> level > 0 ? width >> level : 1;
+               int levelHeight = height >> level > 0 ? height >> level : 1;
+               glTexImage2D(GL_TEXTURE_2D, level, internalFormat, levelWidth, levelHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+          }
+          // Without this GL looks for levels down to 1x1 past the ones that exist and treats the texture as incomplete
+          glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+     }
+     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
+     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+     return texture;
+}
+
+// Takes the next decoded image off the queue and creates its texture, false when nothing is waiting
+bool TextureManager::startUpload() {
+     while (workers.pop(current)) {
+          Slot& slot = slots[current.handle];
+          if (current.error.empty() && (current.width > maxTextureSize || current.height > maxTextureSize)) {
+               current.error = "bigger than GL_MAX_TEXTURE_SIZE (" + std::to_string(maxTextureSize) + ")";
+          }
+          if (!current.error.empty()) {
+               std::cout << "ERROR::TEXTURE_MANAGER::LOAD_FAILED " << slot.path << ": " << current.error << std::endl;
+               slot.state = TextureLoadState::Failed;
+               loading--;
+               failedCount++;
+               continue;
+          }
+          slot.texture = createTexture(current.width, current.height);
+          slot.width = current.width;
+          slot.height = current.height;
+          rowsDone = 0;
+          columnsDone = 0;
+          uploading = true;
+          return true;
+     }
+     return false;
+}
+
+// Where this frame's rows get written, the 3.3 path maps its region the first time it's asked
+unsigned char* TextureManager::mapRegion() {
+     if (persistent) {
+          return mapped + settings.uploadBudgetBytes * fences.region();
+     }
+     if (mapped == NULL) {
+          // Invalidating orphans the buffer, if the GPU is still reading last time's rows the driver hands back fresh memory instead of waiting
+          glState.bindBuffer(GL_PIXEL_UNPACK_BUFFER, unpackBuffers[fences.region()]);
+          mapped = (unsigned char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, settings.uploadBudgetBytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+     }
+     return mapped;
+}
+
+// Issues the frame's sub image calls, GL reads the rows from the unpack buffer instead of client memory so each call returns without copying them
+void TextureManager::flushRegion() {
+     if (pending.empty()) {
+          return;
+     }
+     glState.bindBuffer(GL_PIXEL_UNPACK_BUFFER, persistent ? unpackBuffers[0] : unpackBuffers[fences.region()]);
+     if (!persistent) {
+          glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER); // A buffer can't be read from while it's mapped without the persistent bit
+          mapped = NULL;
+     }
+     for (const PendingRows& rows : pending) {
+          // With an unpack buffer bound the pointer argument is an offset into it
+          if (path == RenderPath::DSA45) {
+               glTextureSubImage2D(rows.texture, 0, rows.firstColumn, rows.firstRow, rows.width, rows.rows, GL_RGBA, GL_UNSIGNED_BYTE, (void*)rows.offset);
+               if (rows.last && settings.mipmaps) {
+                    glGenerateTextureMipmap(rows.texture);
+               }
+          }
+          else {
+               glState.bindTexture(0, GL_TEXTURE_2D, rows.texture);
+               glTexSubImage2D(GL_TEXTURE_2D, 0, rows.firstColumn, rows.firstRow, rows.width, rows.rows, GL_RGBA, GL_UNSIGNED_BYTE, (void*)rows.offset);
+               if (rows.last && settings.mipmaps) {
+                    glGenerateMipmap(GL_TEXTURE_2D);
+               }
+          }
+     }
+     glState.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+     pending.clear();
+}
+
+void TextureManager::update() {
+     if (!workers.running() || loading == 0) {
+          return;
+     }
+     frames++;
+
+     // Waiting here would put the GPU's backlog into this frame's time, trying again next frame doesn't
+     if (!fences.advance(false)) {
+          return;
+     }
+     regionUsed = 0;
+
+     // Every chunk is one rectangle of the base level, whole rows while they fit and then a piece of one
+          // A row wider than the whole budget takes several frames, so any budget works with any texture size
+     while (regionUsed + 4 <= settings.uploadBudgetBytes) {
+          if (!uploading && !startUpload()) {
+               break;
+          }
+          size_t rowBytes = (size_t)current.width * 4;
+          size_t room = settings.uploadBudgetBytes - regionUsed;
+          int rows = columnsDone == 0 ? (int)(room / rowBytes) : 0;
+          rows = rows < current.height - rowsDone ? rows : current.height - rowsDone;
+          int columns = current.width;
+          if (rows == 0) {
+               // The rest of the current row, or as much of it as fits
+               rows = 1;
+               columns = current.width - columnsDone;
+               columns = (size_t)columns * 4 <= room ? columns : (int)(room / 4);
+          }
+          unsigned char* destination = mapRegion();
+          if (destination == NULL) {
+               std::cout << "ERROR::TEXTURE_MANAGER::MAP_FAILED" << std::endl;
+               break;
+          }
+
+          Slot& slot = slots[current.handle];
+          size_t offset = (persistent ? settings.uploadBudgetBytes * fences.region() : 0) + regionUsed;
+          size_t bytes = (size_t)columns * 4 * rows;
+          memcpy(destination + regionUsed, current.pixels.data() + rowBytes * rowsDone + (size_t)columnsDone * 4, bytes);
+          int firstRow = rowsDone;
+          int firstColumn = columnsDone;
+          columnsDone += columns;
+          if (columnsDone == current.width) {
+               rowsDone += rows;
+               columnsDone = 0;
+          }
+          pending.push_back({ slot.texture, firstRow, firstColumn, rows, columns, offset, rowsDone == current.height });
+          regionUsed += bytes;
+
+          if (rowsDone == current.height) {
+               // Draws are queued after flushRegion's calls, so the texture can be sampled this frame
+               slot.state = TextureLoadState::Ready;
+               loading--;
+               readyCount++;
+               current = DecodedImage();
+               uploading = false;
+          }
+     }
+     flushRegion();
+
+     if (regionUsed > 0) {
+          uploadFrames++;
+          bytesUploaded += (long long)regionUsed;
+          maxFrameBytes = regionUsed > maxFrameBytes ? regionUsed : maxFrameBytes;
+          if (persistent) {
+               fences.fence();
+          }
+     }
+}
+
+void TextureManager::printStats() const {
+     std::cout << "Texture manager (" << workers.workerCount() << " workers, " << (persistent ? "mapped unpack buffer" : "orphaned unpack buffers") << "): "
+          << readyCount << " ready, " << failedCount << " failed, " << sharedLoads << " loads shared an earlier one, " << bytesUploaded << " bytes over "
+          << uploadFrames << " frames, at most " << maxFrameBytes << " in one, " << fences.stalls() << " frames skipped waiting on the GPU" << std::endl;
+}
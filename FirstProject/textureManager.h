@@ -0,0 +1,140 @@
+#ifndef TEXTURE_MANAGER_H
+#define TEXTURE_MANAGER_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "frameFences.h"
+#include "renderPath.h"
+#include "workerPool.h"
+
+enum class TextureLoadState {
+     Loading,  // Queued, decoding on a worker, or partway through its upload
+     Ready,    // Every level is filled in, texture() returns the real one
+     Failed    // Didn't decode or is too big for GL, texture() keeps returning the fallback
+};
+
+struct TextureManagerSettings {
+     int workers = 0;                       // Decoding threads, 0 picks one less than the hardware has (at least 1)
+     size_t queueCapacity = 4;              // Decoded images waiting for the GL thread, workers wait when it's full (a 4K image is 64 MB)
+     size_t uploadBudgetBytes = 4 << 20;    // Most pixel bytes update() hands to GL per frame, big images take several frames
+     bool mipmaps = true;                   // Full mip chain, glGenerateMipmap fills it once the base level is in
+     bool srgb = false;                     // GL_SRGB8_ALPHA8 instead of GL_RGBA8, for color textures drawn into an sRGB framebuffer
+     bool flipVertically = true;            // Images store the top row first, GL's first row is the bottom one
+};
+
+// Loads PNG and JPEG textures (decoded with stb_image) without the render loop ever waiting on a file, a decoder or a big upload
+     // load() only queues the path, worker threads read and decode it to RGBA8 in CPU memory
+     // Loading a path that is already loaded or loading returns the same handle, each file is decoded and uploaded once
+     // update() runs once a frame on the GL thread and copies at most uploadBudgetBytes of pixels into a pixel unpack buffer,
+     // glTexSubImage2D then reads them from that buffer on the GPU's time instead of copying them out of client memory before it returns
+     // On 4.4+ the unpack buffer is persistently mapped with a fenced region per frame in flight like UniformRing
+     // On 3.3 each region is its own buffer, orphaned when it's mapped for the frame
+     // Storage is immutable (glTexStorage2D) on 4.2+, before that every level is allocated up front with glTexImage2D
+// texture() hands out a 1x1 white texture until the real one is ready, so drawing code never has to check
+class TextureManager {
+public:
+     static const int regions = FrameFences::regions;
+
+     TextureManager() = default;
+     ~TextureManager();
+     TextureManager(const TextureManager&) = delete;
+     TextureManager& operator=(const TextureManager&) = delete;
+
+     bool init(RenderPath path, const TextureManagerSettings& settings);
+     void shutdown();
+
+     // GL thread only, returns right away
+     int load(const std::string& path);
+     // Once per frame on the GL thread, uploads within the budget and never waits on a worker or the GPU
+     void update();
+
+     TextureLoadState state(int handle) const { return slots[handle].state; }
+     bool ready(int handle) const { return slots[handle].state == TextureLoadState::Ready; }
+     unsigned int texture(int handle) const { return ready(handle) ? slots[handle].texture : fallback; }
+     // Only meaningful once ready
+     int width(int handle) const { return slots[handle].width; }
+     int height(int handle) const { return slots[handle].height; }
+     // Binds texture(handle) to GL_TEXTURE_2D on the unit through glState
+     void bind(int handle, int unit) const;
+     // Nothing left loading or waiting to upload
+     bool idle() const { return loading == 0; }
+
+     void printStats() const;
+
+private:
+     struct Request {
+          int handle;
+          std::string path;
+     };
+
+     // What a worker hands the GL thread, rows already in GL's bottom up order
+     struct DecodedImage {
+          int handle = -1;
+          std::string error; // Empty when it decoded
+          std::vector<unsigned char> pixels; // RGBA8, width * 4 bytes a row
+          int width = 0;
+          int height = 0;
+     };
+
+     struct Slot {
+          std::string path;
+          TextureLoadState state = TextureLoadState::Loading;
+          unsigned int texture = 0;
+          int width = 0;
+          int height = 0;
+     };
+
+     // Pixels copied into this frame's region, issued once the region is done being written
+          // Whole rows (firstColumn 0 and width the image's), or a piece of one row when a whole row doesn't fit
+     struct PendingRows {
+          unsigned int texture;
+          int firstRow;
+          int firstColumn;
+          int rows;
+          int width;
+          size_t offset; // Into the unpack buffer
+          bool last;     // The image's final rows, the mipmaps come after them
+     };
+
+     DecodedImage decode(const Request& request) const;
+     bool startUpload();
+     unsigned int createTexture(int width, int height);
+     unsigned char* mapRegion();
+     void flushRegion();
+
+     RenderPath path = RenderPath::Bind33;
+     TextureManagerSettings settings;
+     std::vector<Slot> slots; // GL thread only
+     std::unordered_map<std::string, int> handles; // Normalized path to its handle, GL thread only
+     int loading = 0;
+     unsigned int fallback = 0;
+     GLint maxTextureSize = 0;
+
+     WorkerPool<Request, DecodedImage> workers; // At most queueCapacity decoded images wait for the GL thread
+
+     // The image being uploaded, how many whole rows of it are in, and how far into the next row
+     DecodedImage current;
+     bool uploading = false;
+     int rowsDone = 0;
+     int columnsDone = 0;
+
+     unsigned int unpackBuffers[regions] = {}; // Persistent : only the first, split into regions, otherwise one buffer per region
+     unsigned char* mapped = NULL;             // The whole persistent mapping, or this frame's region while it's mapped on 3.3
+     bool persistent = false;
+     size_t regionUsed = 0;
+     FrameFences fences; // Only ever fenced when persistent, on 3.3 it just counts the regions
+     std::vector<PendingRows> pending;
+
+     long long frames = 0;
+     long long uploadFrames = 0;  // Frames that uploaded anything
+     long long bytesUploaded = 0;
+     size_t maxFrameBytes = 0;
+     int readyCount = 0;
+     int failedCount = 0;
+     int sharedLoads = 0;         // load() calls that got an existing handle back
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef UNIFORM_BLOCKS_H
+#define UNIFORM_BLOCKS_H
+
+#include <cstring>
+#include "vertexFormat.h"
+
+// C++ mirrors of the uniform blocks the shaders declare, laid out by std140 rules
+     // Only vec4 and mat4 members so there is no padding to get wrong, a float goes in a vec4's x
+     // The GLSL side has to list the same members in the same order with layout(std140)
+
+// Binding points, GLSL 330 can't say layout(binding = N), so Program assigns them by block name after linking
+enum UniformBinding {
+     FrameBinding = 0, // uniform FrameBlock
+     DrawBinding = 1   // uniform DrawBlock
+};
+
+// Shader storage bindings are numbered separately from uniform block bindings
+enum StorageBinding {
+     DrawDataBinding = 0 // buffer DrawDataBlock, an array of DrawBlock read by gl_DrawID, see indirectRenderer.h
+};
+
+// Written once per frame
+struct FrameBlock {
+     float viewProjection[16];
+     float time[4]; // x = seconds since startup
+};
+
+// Written once per draw, the defaults draw a float mesh untransformed and untinted
+struct DrawBlock {
+     float model[16] = { 1, 0, 0, 0,  0, 1, 0, 0,  0, 0, 1, 0,  0, 0, 0, 1 };
+     float tint[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+     float positionScale[4] = { 1.0f, 1.0f, 1.0f, 0.0f }; // Undoes position quantization, see PositionQuantization in vertexFormat.h
+     float positionBias[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+};
+
+static_assert(sizeof(FrameBlock) == 80, "FrameBlock doesn't match its std140 layout");
+static_assert(sizeof(DrawBlock) == 112, "DrawBlock doesn't match its std140 layout");
+
+// A DrawBlock for a mesh, model is column major (NULL keeps the identity) and the quantization is the mesh's
+inline DrawBlock makeDrawBlock(const float* model, const PositionQuantization& quantization) {
+     DrawBlock block;
+     if (model != NULL) {
+          memcpy(block.model, model, sizeof(block.model));
+     }
+     memcpy(block.positionScale, quantization.scale, sizeof(block.positionScale));
+     memcpy(block.positionBias, quantization.bias, sizeof(block.positionBias));
+     return block;
+}
+
+// Points the blocks a program declares at the bindings above, blocks it doesn't have are skipped (storage blocks only on 4.3+)
+void bindUniformBlocks(unsigned int program);
+
+#endif
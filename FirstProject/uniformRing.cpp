@@ -0,0 +1,125 @@
+#include "uniformRing.h"
+#include "uniformBlocks.h"
+#include "glState.h"
+#include <cstring>
+#include <iostream>
+
+void bindUniformBlocks(unsigned int program) {
+     const struct {
+          const char* name;
+          UniformBinding binding;
+     } blocks[] = {
+          { "FrameBlock", FrameBinding },
+          { "DrawBlock", DrawBinding }
+     };
+     for (const auto& block : blocks) {
+          unsigned int index = glGetUniformBlockIndex(program, block.name);
+          if (index != GL_INVALID_INDEX) {
+               glUniformBlockBinding(program, index, block.binding);
+          }
+     }
+
+     // Same for storage blocks, GLSL 330 can't give them a binding either
+     if (GLAD_GL_VERSION_4_3) {
+          unsigned int index = glGetProgramResourceIndex(program, GL_SHADER_STORAGE_BLOCK, "DrawDataBlock");
+          if (index != GL_INVALID_INDEX) {
+               glShaderStorageBlockBinding(program, index, DrawDataBinding);
+          }
+     }
+}
+
+bool UniformRing::init(size_t maxBlockBytes, int blocksPerFrame) {
+     int offsetAlignment = 0;
+     glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment);
+     if (offsetAlignment > 0) {
+          alignment = (size_t)offsetAlignment;
+     }
+     regionBytes = align(maxBlockBytes) * blocksPerFrame;
+     size_t totalBytes = regionBytes * regions;
+
+     glGenBuffers(1, &buffer);
+     glState.bindBuffer(GL_UNIFORM_BUFFER, buffer);
+     if (GLAD_GL_VERSION_4_4) {
+          const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+          glBufferStorage(GL_UNIFORM_BUFFER, totalBytes, NULL, flags);
+          mapped = (unsigned char*)glMapBufferRange(GL_UNIFORM_BUFFER, 0, totalBytes, flags);
+          if (mapped == NULL) {
+               std::cout << "ERROR::UNIFORM_RING::MAP_FAILED" << std::endl;
+               glState.forgetBuffer(buffer);
+               glDeleteBuffers(1, &buffer);
+               buffer = 0;
+               return false;
+          }
+          persistent = true;
+     }
+     else {
+          glBufferData(GL_UNIFORM_BUFFER, totalBytes, NULL, GL_DYNAMIC_DRAW);
+     }
+     glState.bindBuffer(GL_UNIFORM_BUFFER, 0);
+     return true;
+}
+
+void UniformRing::shutdown() {
+     fences.release();
+     if (buffer != 0) {
+          if (mapped != NULL) {
+               glState.bindBuffer(GL_UNIFORM_BUFFER, buffer);
+               glUnmapBuffer(GL_UNIFORM_BUFFER);
+               glState.bindBuffer(GL_UNIFORM_BUFFER, 0);
+               mapped = NULL;
+          }
+          glState.forgetBuffer(buffer);
+          glDeleteBuffers(1, &buffer);
+          buffer = 0;
+     }
+}
+
+void UniformRing::beginFrame() {
+     fences.advance(true);
+     region = fences.region();
+     used = 0;
+     frames++;
+}
+
+bool UniformRing::push(GLuint binding, const void* data, size_t bytes) {
+     if (buffer == 0) {
+          return false;
+     }
+     if (used + bytes > regionBytes) {
+          overflows++;
+          return false;
+     }
+
+     size_t offset = regionBytes * region + used;
+     if (mapped != NULL) {
+          memcpy(mapped + offset, data, bytes);
+     }
+     else {
+          glState.bindBuffer(GL_UNIFORM_BUFFER, buffer);
+          glBufferSubData(GL_UNIFORM_BUFFER, offset, bytes, data);
+     }
+     glState.bindBufferRange(GL_UNIFORM_BUFFER, binding, buffer, offset, bytes);
+
+     used += align(bytes);
+     blocks++;
+     return true;
+}
+
+void UniformRing::endFrame() {
+     if (buffer != 0) {
+          fences.fence();
+     }
+}
+
+void UniformRing::printStats() const {
+     if (frames == 0) {
+          return;
+     }
+     std::cout << "Uniform ring (" << (persistent ? "persistent map" : "glBufferSubData") << "): "
+          << regions << " x " << regionBytes << " bytes, " << (double)blocks / frames << " blocks per frame, "
+          << fences.stalls() << " frames waited on the GPU";
+     if (overflows > 0) {
+          std::cout << ", " << overflows << " blocks didn't fit";
+     }
+     std::cout << std::endl;
+}
@@ -0,0 +1,45 @@
+#ifndef UNIFORM_RING_H
+#define UNIFORM_RING_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include "frameFences.h"
+
+// One uniform buffer split into a region per frame in flight, blocks are copied in and bound by offset
+     // On 4.4+ the buffer is mapped once with glBufferStorage (persistent + coherent), so writing a block is a memcpy
+     // On 3.3 every block is a glBufferSubData instead, still one call per block rather than one per uniform
+// Each region gets a fence when its frame is submitted, and is only written again once the GPU is past that fence
+class UniformRing {
+public:
+     static const int regions = FrameFences::regions;
+
+     // Room for blocksPerFrame blocks of up to maxBlockBytes each, every frame
+     bool init(size_t maxBlockBytes, int blocksPerFrame);
+     void shutdown();
+
+     // Moves to the next region, waiting on its fence if the GPU is still reading it
+     void beginFrame();
+     // Copies a block into this frame's region and binds it to the given binding point
+     bool push(GLuint binding, const void* data, size_t bytes);
+     void endFrame();
+
+     void printStats() const;
+
+private:
+     size_t align(size_t bytes) const { return (bytes + alignment - 1) / alignment * alignment; }
+
+     unsigned int buffer = 0;
+     unsigned char* mapped = NULL; // NULL when falling back to glBufferSubData
+     bool persistent = false;
+     size_t regionBytes = 0;
+     size_t alignment = 256;
+     int region = 0;
+     size_t used = 0;
+     FrameFences fences;
+
+     long long frames = 0;
+     long long blocks = 0;
+     long long overflows = 0;
+};
+
+#endif
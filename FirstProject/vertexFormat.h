@@ -0,0 +1,185 @@
+#ifndef VERTEX_FORMAT_H
+#define VERTEX_FORMAT_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+
+// Describes a vertex struct to GL so nobody has to hand count strides and offsets
+     // Declare the struct, then list its members once with VERTEX_ATTRIBUTE in a VertexLayout specialization
+     // Component count, GL type and size come from the member's C++ type, the offset from offsetof, all at compile time
+// Every attribute reaches the shader as floats, integer types are either normalized (0..255 -> 0..1) or converted as is
+
+struct VertexAttribute {
+     GLuint location = 0;       // layout (location = N) in the shader
+     GLint components = 0;      // 1 to 4
+     GLenum type = GL_FLOAT;
+     GLboolean normalized = GL_FALSE;
+     GLuint offset = 0;         // Bytes from the start of an interleaved vertex
+     GLuint bytes = 0;          // Size of the whole attribute, also its stride when the buffer is split
+     GLint columns = 1;         // Matrices take a location per column (a mat4 at location 2 uses 2 to 5)
+};
+
+struct VertexFormat {
+     const VertexAttribute* attributes = nullptr;
+     int attributeCount = 0;
+     GLsizei stride = 0;        // Size of one interleaved vertex
+};
+
+// How a mesh's vertices sit in its buffer
+     // Interleaved : one struct after another, every attribute of a vertex is next to each other
+     // Split : structure of arrays, all positions then all colors, each attribute in its own tightly packed run
+enum class VertexStorage {
+     Interleaved,
+     Split
+};
+
+// GL type for each C++ element type an attribute can be made of
+template<typename T> struct VertexElementType;
+template<> struct VertexElementType<float> { static constexpr GLenum value = GL_FLOAT; };
+template<> struct VertexElementType<int8_t> { static constexpr GLenum value = GL_BYTE; };
+template<> struct VertexElementType<uint8_t> { static constexpr GLenum value = GL_UNSIGNED_BYTE; };
+template<> struct VertexElementType<int16_t> { static constexpr GLenum value = GL_SHORT; };
+template<> struct VertexElementType<uint16_t> { static constexpr GLenum value = GL_UNSIGNED_SHORT; };
+template<> struct VertexElementType<int32_t> { static constexpr GLenum value = GL_INT; };
+template<> struct VertexElementType<uint32_t> { static constexpr GLenum value = GL_UNSIGNED_INT; };
+
+// A member is either a single element (float), an array of 1 to 4 of them (float[3]) or a matrix (float[4][4])
+template<typename T> struct VertexMemberTraits {
+     using Element = T;
+     static constexpr int components = 1;
+     static constexpr int columns = 1;
+};
+template<typename T, size_t N> struct VertexMemberTraits<T[N]> {
+     static_assert(N >= 1 && N <= 4, "A vertex attribute has 1 to 4 components");
+     using Element = T;
+     static constexpr int components = (int)N;
+     static constexpr int columns = 1;
+};
+// float[4][4] is a mat4, column major like GLSL
+template<typename T, size_t C, size_t R> struct VertexMemberTraits<T[C][R]> {
+     static_assert(C >= 2 && C <= 4 && R >= 2 && R <= 4, "A matrix attribute is 2x2 to 4x4");
+     using Element = T;
+     static constexpr int components = (int)R;
+     static constexpr int columns = (int)C;
+};
+
+template<typename Member>
+constexpr VertexAttribute makeVertexAttribute(GLuint location, size_t offset, bool normalized) {
+     using Traits = VertexMemberTraits<Member>;
+     VertexAttribute attribute;
+     attribute.location = location;
+     attribute.components = Traits::components;
+     attribute.type = VertexElementType<typename Traits::Element>::value;
+     attribute.normalized = normalized ? GL_TRUE : GL_FALSE;
+     attribute.offset = (GLuint)offset;
+     attribute.bytes = (GLuint)sizeof(Member);
+     attribute.columns = Traits::columns;
+     return attribute;
+}
+
+// Has to be a macro, offsetof needs the member's name
+#define VERTEX_ATTRIBUTE(Vertex, member, location, normalized) \
+     makeVertexAttribute<decltype(Vertex::member)>(location, offsetof(Vertex, member), normalized)
+
+// Specialize with a static constexpr VertexAttribute attributes[] for every vertex struct
+template<typename Vertex> struct VertexLayout;
+
+template<typename Vertex, size_t N>
+constexpr VertexFormat makeVertexFormat(const VertexAttribute (&attributes)[N]) {
+     VertexFormat format;
+     format.attributes = attributes;
+     format.attributeCount = (int)N;
+     format.stride = (GLsizei)sizeof(Vertex);
+     return format;
+}
+
+template<typename Vertex>
+constexpr VertexFormat vertexFormat() {
+     return makeVertexFormat<Vertex>(VertexLayout<Vertex>::attributes);
+}
+
+// Catches a layout that lists members overlapping or running past the end of the struct
+template<typename Vertex>
+constexpr bool vertexLayoutFits() {
+     VertexFormat format = vertexFormat<Vertex>();
+     GLuint bytes = 0;
+     for (int i = 0; i < format.attributeCount; i++) {
+          if (format.attributes[i].offset + format.attributes[i].bytes > (GLuint)format.stride) {
+               return false;
+          }
+          bytes += format.attributes[i].bytes;
+     }
+     return bytes <= (GLuint)format.stride;
+}
+
+
+// Vertex types the app uses
+
+// Position (vec3) and color (vec3), attributes 0 and 1
+struct PositionColorVertex {
+     float position[3];
+     float color[3];
+};
+
+template<> struct VertexLayout<PositionColorVertex> {
+     static constexpr VertexAttribute attributes[] = {
+          VERTEX_ATTRIBUTE(PositionColorVertex, position, 0, false),
+          VERTEX_ATTRIBUTE(PositionColorVertex, color, 1, false)
+     };
+};
+
+static_assert(vertexFormat<PositionColorVertex>().stride == 6 * sizeof(float), "PositionColorVertex has padding");
+static_assert(vertexFormat<PositionColorVertex>().attributes[1].offset == 3 * sizeof(float), "color should follow position");
+static_assert(vertexLayoutFits<PositionColorVertex>(), "PositionColorVertex layout doesn't fit the struct");
+
+// Quantized PositionColorVertex, 10 bytes instead of 24, made by quantizeVertices in vertexQuantize.h
+     // Color follows position with no padding, GL takes attributes at any byte offset and stride
+struct CompactVertex {
+     uint16_t position[3]; // Normalized over the mesh's bounding box, the vertex shader scales it back with PositionQuantization
+     uint8_t color[4];     // Normalized to 0..1, alpha is unused
+};
+
+template<> struct VertexLayout<CompactVertex> {
+     static constexpr VertexAttribute attributes[] = {
+          VERTEX_ATTRIBUTE(CompactVertex, position, 0, true),
+          VERTEX_ATTRIBUTE(CompactVertex, color, 1, true)
+     };
+};
+
+static_assert(vertexFormat<CompactVertex>().stride == 10, "CompactVertex has padding");
+static_assert(vertexLayoutFits<CompactVertex>(), "CompactVertex layout doesn't fit the struct");
+
+// PositionColorVertex with a texture coordinate at attribute 7, for the TEXTURED shader feature
+     // 7 rather than 2 because the instanced attributes take 2 to 6
+struct PositionColorTexVertex {
+     float position[3];
+     float color[3];
+     float texCoord[2];
+};
+
+template<> struct VertexLayout<PositionColorTexVertex> {
+     static constexpr VertexAttribute attributes[] = {
+          VERTEX_ATTRIBUTE(PositionColorTexVertex, position, 0, false),
+          VERTEX_ATTRIBUTE(PositionColorTexVertex, color, 1, false),
+          VERTEX_ATTRIBUTE(PositionColorTexVertex, texCoord, 7, false)
+     };
+};
+
+static_assert(vertexFormat<PositionColorTexVertex>().stride == 8 * sizeof(float), "PositionColorTexVertex has padding");
+static_assert(vertexLayoutFits<PositionColorTexVertex>(), "PositionColorTexVertex layout doesn't fit the struct");
+
+// What the vertex shader does to get a position back, position = bias + attribute * scale
+     // vec4s so they copy straight into DrawBlock, w is unused
+     // The default leaves float positions alone
+struct PositionQuantization {
+     float scale[4] = { 1.0f, 1.0f, 1.0f, 0.0f };
+     float bias[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+};
+
+// Same rule as createMesh, 16 bit indices whenever the mesh has few enough vertices (MeshPool and .mesh files)
+inline GLenum pooledIndexType(size_t vertexCount) {
+     return vertexCount <= 65535 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+}
+
+#endif
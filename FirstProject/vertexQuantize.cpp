@@ -0,0 +1,92 @@
+#include "vertexQuantize.h"
+#include <cmath>
+
+static uint16_t quantizeUnorm16(float value) {
+     value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+     return (uint16_t)std::lround(value * 65535.0f);
+}
+
+static uint8_t quantizeUnorm8(float value) {
+     value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+     return (uint8_t)std::lround(value * 255.0f);
+}
+
+// GL 4.2 and newer read a signed normalized short as max(c / 32767, -1), so -32768 is never needed
+static int16_t quantizeSnorm16(float value) {
+     value = value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value);
+     return (int16_t)std::lround(value * 32767.0f);
+}
+
+QuantizedVertices quantizeVertices(const PositionColorVertex* vertices, size_t vertexCount) {
+     QuantizedVertices result;
+     if (vertexCount == 0) {
+          return result;
+     }
+
+     float minimum[3], maximum[3];
+     for (int axis = 0; axis < 3; axis++) {
+          minimum[axis] = maximum[axis] = vertices[0].position[axis];
+     }
+     for (size_t i = 1; i < vertexCount; i++) {
+          for (int axis = 0; axis < 3; axis++) {
+               minimum[axis] = std::fmin(minimum[axis], vertices[i].position[axis]);
+               maximum[axis] = std::fmax(maximum[axis], vertices[i].position[axis]);
+          }
+     }
+
+     float inverseExtent[3];
+     for (int axis = 0; axis < 3; axis++) {
+          float extent = maximum[axis] - minimum[axis];
+          // A flat axis (every z is 0 in a 2D mesh) quantizes to 0 and only needs the bias
+          inverseExtent[axis] = extent > 0.0f ? 1.0f / extent : 0.0f;
+          result.quantization.scale[axis] = extent;
+          result.quantization.bias[axis] = minimum[axis];
+     }
+
+     result.vertices.resize(vertexCount);
+     for (size_t i = 0; i < vertexCount; i++) {
+          CompactVertex& compact = result.vertices[i];
+          for (int axis = 0; axis < 3; axis++) {
+               compact.position[axis] = quantizeUnorm16((vertices[i].position[axis] - minimum[axis]) * inverseExtent[axis]);
+               compact.color[axis] = quantizeUnorm8(vertices[i].color[axis]);
+          }
+          compact.color[3] = 255;
+     }
+     return result;
+}
+
+static float signNotZero(float value) {
+     return value >= 0.0f ? 1.0f : -1.0f;
+}
+
+void encodeOctahedral(const float normal[3], int16_t encoded[2]) {
+     // Project onto the octahedron |x| + |y| + |z| = 1, the top half is already a diamond in the xy plane
+     float length = std::fabs(normal[0]) + std::fabs(normal[1]) + std::fabs(normal[2]);
+     float x = length > 0.0f ? normal[0] / length : 0.0f;
+     float y = length > 0.0f ? normal[1] / length : 0.0f;
+     if (normal[2] < 0.0f) {
+          // The bottom half gets folded out over the diamond's edges to fill the square's corners
+          float foldedX = (1.0f - std::fabs(y)) * signNotZero(x);
+          float foldedY = (1.0f - std::fabs(x)) * signNotZero(y);
+          x = foldedX;
+          y = foldedY;
+     }
+     encoded[0] = quantizeSnorm16(x);
+     encoded[1] = quantizeSnorm16(y);
+}
+
+void decodeOctahedral(const int16_t encoded[2], float normal[3]) {
+     float x = std::fmax(encoded[0] / 32767.0f, -1.0f);
+     float y = std::fmax(encoded[1] / 32767.0f, -1.0f);
+     float z = 1.0f - std::fabs(x) - std::fabs(y);
+     if (z < 0.0f) {
+          float unfoldedX = (1.0f - std::fabs(y)) * signNotZero(x);
+          float unfoldedY = (1.0f - std::fabs(x)) * signNotZero(y);
+          x = unfoldedX;
+          y = unfoldedY;
+     }
+     float length = std::sqrt(x * x + y * y + z * z);
+     normal[0] = x / length;
+     normal[1] = y / length;
+     normal[2] = z / length;
+}
@@ -0,0 +1,26 @@
+#ifndef VERTEX_QUANTIZE_H
+#define VERTEX_QUANTIZE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "vertexFormat.h"
+
+// Shrinks float vertex data before it's uploaded, the vertex shader undoes it (see shaderCommon.txt)
+     // Positions : unsigned normalized 16 bit over the mesh's bounding box, with a per-mesh scale and bias
+     // Colors : unsigned normalized 8 bit
+     // Normals : octahedral, two signed normalized 16 bit values
+
+struct QuantizedVertices {
+     std::vector<CompactVertex> vertices;
+     PositionQuantization quantization;
+};
+
+QuantizedVertices quantizeVertices(const PositionColorVertex* vertices, size_t vertexCount);
+
+// Folds a unit normal onto the two faces of an octahedron, then flattens that to a square
+     // Decoding goes through the same steps backwards, no vertex stores a normal yet so there's no GLSL version until one does
+void encodeOctahedral(const float normal[3], int16_t encoded[2]);
+void decodeOctahedral(const int16_t encoded[2], float normal[3]);
+
+#endif
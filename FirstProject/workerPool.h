@@ -0,0 +1,121 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Threads that turn requests into results off the GL thread, for MeshLoader and TextureManager
+     // push() queues a request, any idle worker takes it and runs process on it
+     // Results wait in a queue of at most capacity, a worker with a result and no room waits, so work can't run far ahead of whoever pops them
+     // Results come out in the order they finish, which isn't always the order they were pushed in
+template<typename Request, typename Result>
+class WorkerPool {
+public:
+     WorkerPool() = default;
+     ~WorkerPool() { stop(); }
+     WorkerPool(const WorkerPool&) = delete;
+     WorkerPool& operator=(const WorkerPool&) = delete;
+
+     // count 0 picks one less than the hardware has (at least 1)
+     void start(int count, size_t capacity, std::function<Result(const Request&)> process) {
+          this->process = std::move(process);
+          this->capacity = capacity < 1 ? 1 : capacity;
+          if (count <= 0) {
+               count = (int)std::thread::hardware_concurrency() - 1;
+               count = count < 1 ? 1 : count;
+          }
+          stopping = false;
+          threadCount = count;
+          for (int i = 0; i < count; i++) {
+               workers.emplace_back(&WorkerPool::work, this);
+          }
+     }
+
+     // Joins the workers, requests and results still queued are dropped
+     void stop() {
+          if (workers.empty()) {
+               return;
+          }
+          {
+               std::lock_guard<std::mutex> lock(mutex);
+               stopping = true;
+          }
+          requestAdded.notify_all();
+          resultTaken.notify_all();
+          for (std::thread& worker : workers) {
+               worker.join();
+          }
+          workers.clear();
+          requests.clear();
+          results.clear();
+     }
+
+     void push(Request request) {
+          {
+               std::lock_guard<std::mutex> lock(mutex);
+               requests.push_back(std::move(request));
+          }
+          requestAdded.notify_one();
+     }
+
+     // Never waits, false when nothing has finished
+     bool pop(Result& result) {
+          {
+               std::lock_guard<std::mutex> lock(mutex);
+               if (results.empty()) {
+                    return false;
+               }
+               result = std::move(results.front());
+               results.pop_front();
+          }
+          resultTaken.notify_one();
+          return true;
+     }
+
+     bool running() const { return !workers.empty(); }
+     // How many start() made, still known after stop() so stats can be printed after shutting down
+     int workerCount() const { return threadCount; }
+
+private:
+     void work() {
+          while (true) {
+               Request request;
+               {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    requestAdded.wait(lock, [&] { return stopping || !requests.empty(); });
+                    if (stopping) {
+                         return;
+                    }
+                    request = std::move(requests.front());
+                    requests.pop_front();
+               }
+
+               Result result = process(request);
+
+               std::unique_lock<std::mutex> lock(mutex);
+               resultTaken.wait(lock, [&] { return stopping || results.size() < capacity; });
+               if (stopping) {
+                    return;
+               }
+               results.push_back(std::move(result));
+          }
+     }
+
+     std::function<Result(const Request&)> process;
+     size_t capacity = 1;
+     std::vector<std::thread> workers;
+     int threadCount = 0;
+     std::mutex mutex;
+     std::condition_variable requestAdded;
+     std::condition_variable resultTaken;
+     std::deque<Request> requests;
+     std::deque<Result> results; // Never more than capacity
+     bool stopping = false;
+};
+
+#endif
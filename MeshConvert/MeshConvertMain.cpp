@@ -0,0 +1,74 @@
+#include "meshFile.h"
+#include "meshOptimize.h"
+#include "objLoader.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Offline step for FirstProject: turns OBJ files into .mesh files (see meshFile.h) that load with a map instead of a parse
+     // MeshConvert [--float] [--no-optimize] input.obj [output.mesh]
+// The slow parts of loading an OBJ (parsing text, the optimization passes, quantizing) all happen here, once
+// --float keeps PositionColorVertex, by default vertices are quantized to CompactVertex
+
+int main(int argc, char* argv[]) {
+     bool compact = true;
+     bool optimize = true;
+     std::vector<std::string> paths;
+     for (int i = 1; i < argc; i++) {
+          std::string arg = argv[i];
+          if (arg == "--float") {
+               compact = false;
+          }
+          else if (arg == "--no-optimize") {
+               optimize = false;
+          }
+          else {
+               paths.push_back(arg);
+          }
+     }
+     if (paths.empty() || paths.size() > 2) {
+          std::cout << "Usage: MeshConvert [--float] [--no-optimize] input.obj [output.mesh]" << std::endl;
+          return 1;
+     }
+
+     std::string output = paths.size() == 2 ? paths[1] : paths[0];
+     if (paths.size() == 1) {
+          size_t dot = output.find_last_of('.');
+          size_t slash = output.find_last_of("/\\");
+          if (dot != std::string::npos && (slash == std::string::npos || dot > slash)) {
+               output.erase(dot);
+          }
+          output += ".mesh";
+     }
+
+     std::vector<PositionColorVertex> vertices;
+     std::vector<unsigned int> indices;
+     std::string error;
+     if (!loadObj(paths[0], vertices, indices, error)) {
+          std::cout << "ERROR::MESH_CONVERT::" << paths[0] << ": " << error << std::endl;
+          return 1;
+     }
+     if (optimize) {
+          MeshOptimizeStats stats = optimizeMesh(vertices, indices);
+          std::cout << "ACMR " << stats.acmrBefore << " -> " << stats.acmrAfter;
+          if (!stats.reordered) {
+               std::cout << " (reordering gave " << stats.acmrReordered << ", kept the input order)";
+          }
+          std::cout << std::endl;
+     }
+     if (!writeMeshFile(output, vertices.data(), vertices.size(), indices.data(), indices.size(), compact, error)) {
+          std::cout << "ERROR::MESH_CONVERT::" << output << ": " << error << std::endl;
+          return 1;
+     }
+
+     MeshFile file;
+     if (!file.open(output, error)) {
+          std::cout << "ERROR::MESH_CONVERT::" << output << " doesn't read back: " << error << std::endl;
+          return 1;
+     }
+     const MeshFileHeader& header = file.header();
+     std::cout << output << ": " << header.vertexCount << " vertices, " << header.indexCount / 3 << " triangles, "
+          << (compact ? "CompactVertex" : "PositionColorVertex") << ", vertices " << header.vertexBytes << " bytes, indices "
+          << header.indexBytes << " bytes (" << (header.indexType == GL_UNSIGNED_SHORT ? 16 : 32) << " bit)" << std::endl;
+     return 0;
+}
@@ -0,0 +1,109 @@
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Build step for FirstProject: turns shader files into a header of constexpr strings so they're compiled into the binary
+     // ShaderEmbed output.h file...
+// Entries are named by file name alone, so FirstProject looks them up the same way it would open them from its own folder
+// The header is only rewritten when its contents change, so unchanged shaders don't cause a rebuild
+
+static std::string fileName(const std::string& path) {
+     size_t slash = path.find_last_of("/\\");
+     return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+// One C string literal per source line, escaped
+static void writeLiteral(std::ostringstream& out, const std::string& text) {
+     if (text.empty()) {
+          out << "     \"\"";
+          return;
+     }
+     size_t start = 0;
+     while (start < text.size()) {
+          size_t end = text.find('\n', start);
+          end = end == std::string::npos ? text.size() : end + 1;
+          out << "     \"";
+          for (size_t i = start; i < end; i++) {
+               unsigned char c = (unsigned char)text[i];
+               switch (c) {
+               case '\\': out << "\\\\"; break;
+               case '"': out << "\\\""; break;
+               case '\n': out << "\\n"; break;
+               case '\r': out << "\\r"; break;
+               case '\t': out << "\\t"; break;
+               default:
+                    if (c < 0x20 || c >= 0x7f) {
+                         // Octal always stops after 3 digits, hex would swallow a following digit
+                         const char digits[] = "01234567";
+                         out << '\\' << digits[(c >> 6) & 7] << digits[(c >> 3) & 7] << digits[c & 7];
+                    }
+                    else {
+                         out << (char)c;
+                    }
+               }
+          }
+          out << "\"";
+          start = end;
+          if (start < text.size()) {
+               out << "\n";
+          }
+     }
+}
+
+int main(int argc, char* argv[]) {
+     if (argc < 2) {
+          std::cout << "Usage: ShaderEmbed output.h shader..." << std::endl;
+          return 1;
+     }
+
+     std::ostringstream out;
+     out << "// Generated by ShaderEmbed from the shader files in FirstProject, don't edit\n";
+     out << "// Included once, by embeddedShaders.cpp\n\n";
+
+     std::vector<std::string> names;
+     for (int i = 2; i < argc; i++) {
+          std::ifstream file(argv[i], std::ios::binary);
+          if (!file) {
+               std::cout << "ERROR::SHADER_EMBED::FILE_NOT_SUCCESFULLY_READ " << argv[i] << std::endl;
+               return 1;
+          }
+          std::stringstream stream;
+          stream << file.rdbuf();
+
+          int index = (int)names.size();
+          names.push_back(fileName(argv[i]));
+          out << "static constexpr char embeddedShader" << index << "[] =\n";
+          writeLiteral(out, stream.str());
+          out << ";\n\n";
+     }
+
+     out << "static constexpr EmbeddedShader embeddedShaderTable[] = {\n";
+     for (size_t i = 0; i < names.size(); i++) {
+          out << "     { \"" << names[i] << "\", embeddedShader" << i << ", sizeof(embeddedShader" << i << ") - 1, hashShaderSource(embeddedShader" << i << ", sizeof(embeddedShader" << i << ") - 1) },\n";
+     }
+     if (names.empty()) {
+          out << "     { \"\", \"\", 0, 0 },\n"; // Zero sized arrays aren't allowed
+     }
+     out << "};\n";
+     out << "static constexpr int embeddedShaderCount = " << names.size() << ";\n";
+
+     std::string header = out.str();
+     std::ifstream existing(argv[1], std::ios::binary);
+     if (existing) {
+          std::stringstream stream;
+          stream << existing.rdbuf();
+          if (stream.str() == header) {
+               return 0;
+          }
+     }
+     std::ofstream output(argv[1], std::ios::binary);
+     if (!output) {
+          std::cout << "ERROR::SHADER_EMBED::OUTPUT_NOT_WRITABLE " << argv[1] << std::endl;
+          return 1;
+     }
+     output << header;
+     std::cout << "Embedded " << names.size() << " shaders into " << argv[1] << std::endl;
+     return 0;
+}